@@ -0,0 +1 @@
+"""Benchmarks of the Python interface of Basix, run with airspeed velocity."""
@@ -0,0 +1,178 @@
+"""Overhead of the Python wrappers of FiniteElement.
+
+Each benchmark times the same operation through the wrapper in
+basix.finite_element (``python``), through the nanobind object that it
+wraps (``cpp``) and, where there is one, through the C interface in
+basix.c_api (``c_api``).
+"""
+
+import numpy as np
+
+import basix
+import basix.c_api
+from basix.codegen import DofTransformationType
+
+_elements = {
+    "P3-tetrahedron": (basix.ElementFamily.P, basix.CellType.tetrahedron, 3, basix.LagrangeVariant.gll_warped),
+    "N1E2-tetrahedron": (basix.ElementFamily.N1E, basix.CellType.tetrahedron, 2, basix.LagrangeVariant.legendre),
+    "RT2-hexahedron": (basix.ElementFamily.RT, basix.CellType.hexahedron, 2, basix.LagrangeVariant.legendre),
+}
+
+
+def _create(name):
+    family, cell, degree, variant = _elements[name]
+    return basix.create_element(family, cell, degree, variant)
+
+
+def _points(element, npoints):
+    tdim = len(basix.topology(element.cell_type)) - 1
+    return np.random.default_rng(0).random((npoints, tdim)) / tdim
+
+
+class Tabulate:
+    params = (list(_elements), [1, 100], ["python", "cpp", "c_api"])
+    param_names = ["element", "npoints", "interface"]
+
+    def setup(self, name, npoints, interface):
+        self.e = _create(name)
+        self.x = _points(self.e, npoints)
+        self.out = np.zeros(self.e._e.tabulate(1, self.x).shape)
+        if interface == "python":
+            self.f = lambda: self.e.tabulate(1, self.x, self.out)
+        elif interface == "cpp":
+            self.f = lambda: self.e._e.tabulate(1, self.x, self.out)
+        else:
+            handle, x, out = self.e.handle, self.x.ctypes.data, self.out.ctypes.data
+            self.f = lambda: basix.c_api.tabulate_float64(handle, 1, x, npoints, out)
+
+    def time_tabulate(self, name, npoints, interface):
+        self.f()
+
+    def time_tabulate_allocate(self, name, npoints, interface):
+        # Includes the allocation of the output and its conversion to a
+        # NumPy array
+        if interface == "python":
+            self.e.tabulate(1, self.x)
+        elif interface == "cpp":
+            self.e._e.tabulate(1, self.x)
+        else:
+            self.f()
+
+
+class TabulateBatch:
+    params = (list(_elements), [10, 1000], ["python", "cpp", "loop"])
+    param_names = ["element", "ncells", "interface"]
+
+    def setup(self, name, ncells, interface):
+        self.e = _create(name)
+        self.x = _points(self.e, 4 * ncells)
+        self.offsets = np.arange(0, 4 * ncells + 1, 4, dtype=np.uintp)
+
+    def time_tabulate_batch(self, name, ncells, interface):
+        if interface == "python":
+            self.e.tabulate_batch(1, self.x, self.offsets)
+        elif interface == "cpp":
+            self.e._e.tabulate_batch(1, self.x, self.offsets, 1)
+        else:
+            for c in range(len(self.offsets) - 1):
+                self.e.tabulate(1, self.x[self.offsets[c]:self.offsets[c + 1]])
+
+
+class DofTransformation:
+    params = (list(_elements), [1, 1000], ["python", "cpp", "c_api"])
+    param_names = ["element", "ncells", "interface"]
+
+    def setup(self, name, ncells, interface):
+        self.e = _create(name)
+        rng = np.random.default_rng(0)
+        self.data = rng.random((ncells, self.e.dim * 3))
+        self.cell_info = rng.integers(0, 2 ** 30, ncells, dtype=np.uint32)
+
+    def time_pre_apply(self, name, ncells, interface):
+        if interface == "python":
+            self.e.pre_apply_dof_transformation(self.data, 3, self.cell_info)
+        elif interface == "cpp":
+            self.e._e.pre_apply_dof_transformation(self.data, 3, self.cell_info)
+        else:
+            kind = int(DofTransformationType.pre_apply.value)
+            handle = self.e.handle
+            for data, cell_info in zip(self.data, self.cell_info):
+                basix.c_api.dof_transformation_float64(handle, kind, data.ctypes.data, 3, int(cell_info))
+
+    def time_pre_apply_cell_loop(self, name, ncells, interface):
+        # One call per cell, as done by code that does not batch cells
+        if interface == "python":
+            for data, cell_info in zip(self.data, self.cell_info):
+                self.e.pre_apply_dof_transformation(data, 3, int(cell_info))
+        elif interface == "cpp":
+            for data, cell_info in zip(self.data, self.cell_info):
+                self.e._e.pre_apply_dof_transformation(data, 3, int(cell_info))
+        else:
+            self.time_pre_apply(name, ncells, interface)
+
+
+class _Maps:
+    """Reference and physical values of an element at random points."""
+
+    def setup(self, name, npoints, interface):
+        self.e = _create(name)
+        tdim = len(basix.topology(self.e.cell_type)) - 1
+        rng = np.random.default_rng(0)
+        self.U = rng.random((npoints, self.e.dim, self.e.value_size))
+        self.J = rng.random((npoints, tdim, tdim)) + 2 * np.eye(tdim)
+        self.detJ = np.linalg.det(self.J)
+        self.K = np.linalg.inv(self.J)
+        self.u = np.zeros_like(self.e.push_forward(self.U, self.J, self.detJ, self.K))
+
+
+class PushForward(_Maps):
+    params = (list(_elements), [1, 100], ["python", "cpp", "c_api"])
+    param_names = ["element", "npoints", "interface"]
+
+    def time_push_forward(self, name, npoints, interface):
+        if interface == "python":
+            self.e.push_forward(self.U, self.J, self.detJ, self.K, self.u)
+        elif interface == "cpp":
+            self.e._e.push_forward(self.U, self.J, self.detJ, self.K, self.u)
+        else:
+            basix.c_api.push_forward_float64(self.e.handle, self.U.ctypes.data, self.J.ctypes.data,
+                                             self.detJ.ctypes.data, self.K.ctypes.data, self.U.shape[0],
+                                             self.U.shape[1], self.J.shape[1], self.u.ctypes.data)
+
+
+class PullBack(_Maps):
+    """Pull back, which the C interface does not have."""
+
+    params = (list(_elements), [1, 100], ["python", "cpp"])
+    param_names = ["element", "npoints", "interface"]
+
+    def time_pull_back(self, name, npoints, interface):
+        if interface == "python":
+            self.e.pull_back(self.u, self.J, self.detJ, self.K, self.U)
+        else:
+            self.e._e.pull_back(self.u, self.J, self.detJ, self.K, self.U)
+
+
+class Properties:
+    """Conversion of the data of an element to Python objects."""
+
+    params = (list(_elements), ["python", "cpp"])
+    param_names = ["element", "interface"]
+
+    def setup(self, name, interface):
+        self.e = _create(name) if interface == "python" else _create(name)._e
+
+    def time_entity_transformations(self, name, interface):
+        self.e.entity_transformations()
+
+    def time_x(self, name, interface):
+        self.e.x
+
+    def time_M(self, name, interface):
+        self.e.M
+
+    def time_coefficient_matrix(self, name, interface):
+        self.e.coefficient_matrix
+
+    def time_entity_dofs(self, name, interface):
+        self.e.entity_dofs
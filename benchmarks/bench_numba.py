@@ -0,0 +1,49 @@
+"""DOF transformations of many cells with the Numba helpers.
+
+The batched Numba helpers of basix.numba_helpers (``numba``) are
+compared with a single call to the batched DOF transformation of the
+nanobind object (``cpp``) and with a Python loop over the cells
+(``python_loop``).
+"""
+
+import numpy as np
+
+import basix
+
+try:
+    import basix.numba_helpers
+except ImportError:
+    # basix.numba_helpers requires Numba
+    pass
+
+_elements = {
+    "P4-tetrahedron": (basix.ElementFamily.P, basix.CellType.tetrahedron, 4, basix.LagrangeVariant.gll_warped),
+    "N1E3-tetrahedron": (basix.ElementFamily.N1E, basix.CellType.tetrahedron, 3, basix.LagrangeVariant.legendre),
+}
+
+
+class BatchedDofTransformation:
+    params = (list(_elements), [100, 10000], ["numba", "cpp", "python_loop"])
+    param_names = ["element", "ncells", "interface"]
+
+    def setup(self, name, ncells, interface):
+        if not hasattr(basix, "numba_helpers"):
+            raise NotImplementedError("Numba is not installed")
+        family, cell, degree, variant = _elements[name]
+        self.e = basix.create_element(family, cell, degree, variant)
+        rng = np.random.default_rng(0)
+        self.data = rng.random((ncells, self.e.dim, 3))
+        self.cell_info = rng.integers(0, 2 ** 30, ncells, dtype=np.uint32)
+        if interface == "numba":
+            self.apply = basix.numba_helpers.create_batched_pre_apply_dof_transformation(self.e, parallel=False)
+            # Compile before timing
+            self.apply(self.data[:1].copy(), self.cell_info[:1])
+
+    def time_pre_apply(self, name, ncells, interface):
+        if interface == "numba":
+            self.apply(self.data, self.cell_info)
+        elif interface == "cpp":
+            self.e._e.pre_apply_dof_transformation(self.data.reshape(self.data.shape[0], -1), 3, self.cell_info)
+        else:
+            for data, cell_info in zip(self.data, self.cell_info):
+                self.e._e.pre_apply_dof_transformation(data.reshape(-1), 3, int(cell_info))
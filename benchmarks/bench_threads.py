@@ -0,0 +1,70 @@
+"""Scaling of calls from several Python threads.
+
+The nanobind bindings release the GIL while they call into C++, so
+tabulating on several threads is faster than on one thread. If a change
+stops the GIL being released, the speed-up tracked here drops to one or
+less.
+"""
+
+import time
+from concurrent.futures import ThreadPoolExecutor
+
+import numpy as np
+
+import basix
+
+_nchunks = 32
+
+
+class ThreadedTabulate:
+    params = ([1, 2, 4], )
+    param_names = ["nthreads"]
+
+    def setup(self, nthreads):
+        self.e = basix.create_element(basix.ElementFamily.N1E, basix.CellType.tetrahedron, 3,
+                                      basix.LagrangeVariant.legendre)
+        rng = np.random.default_rng(0)
+        self.points = [rng.random((200, 3)) / 3 for _ in range(_nchunks)]
+        self.pool = ThreadPoolExecutor(max_workers=nthreads)
+
+    def teardown(self, nthreads):
+        self.pool.shutdown()
+
+    def _run(self):
+        list(self.pool.map(lambda x: self.e.tabulate(1, x), self.points))
+
+    def time_tabulate(self, nthreads):
+        self._run()
+
+    def track_speedup(self, nthreads):
+        serial = time.perf_counter()
+        for x in self.points:
+            self.e.tabulate(1, x)
+        serial = time.perf_counter() - serial
+
+        threaded = time.perf_counter()
+        self._run()
+        threaded = time.perf_counter() - threaded
+        return serial / threaded
+
+    track_speedup.unit = "speed-up"
+
+
+class ThreadedDofTransformation:
+    params = ([1, 2, 4], )
+    param_names = ["nthreads"]
+
+    def setup(self, nthreads):
+        self.e = basix.create_element(basix.ElementFamily.N1E, basix.CellType.tetrahedron, 3,
+                                      basix.LagrangeVariant.legendre)
+        rng = np.random.default_rng(0)
+        self.data = [rng.random((500, self.e.dim * 3)) for _ in range(_nchunks)]
+        self.cell_info = [rng.integers(0, 2 ** 30, 500, dtype=np.uint32) for _ in range(_nchunks)]
+        self.pool = ThreadPoolExecutor(max_workers=nthreads)
+
+    def teardown(self, nthreads):
+        self.pool.shutdown()
+
+    def time_pre_apply(self, nthreads):
+        list(self.pool.map(lambda args: self.e.pre_apply_dof_transformation(args[0], 3, args[1]),
+                           zip(self.data, self.cell_info)))
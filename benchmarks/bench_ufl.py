@@ -0,0 +1,69 @@
+"""Overhead of tabulating the elements of basix.ufl.
+
+Blocked and mixed elements whose sub-elements are Basix elements are
+tabulated by one call to a C++ BlockedElement or MixedElement, and the
+table is then reordered into the layout of basix.ufl. Each benchmark
+compares tabulating the element of basix.ufl (``ufl``) with tabulating
+its sub-elements with the nanobind objects that they wrap (``cpp``).
+"""
+
+import numpy as np
+
+import basix
+
+try:
+    import basix.ufl
+except ImportError:
+    # basix.ufl requires UFL
+    pass
+
+_cells = {"triangle": basix.CellType.triangle, "tetrahedron": basix.CellType.tetrahedron}
+
+
+def _points(cell, npoints):
+    tdim = len(basix.topology(cell)) - 1
+    return np.random.default_rng(0).random((npoints, tdim)) / tdim
+
+
+class BlockedElement:
+    params = (list(_cells), [1, 3], [1, 100], ["ufl", "cpp"])
+    param_names = ["cell", "degree", "npoints", "interface"]
+
+    def setup(self, cell, degree, npoints, interface):
+        if not hasattr(basix, "ufl"):
+            raise NotImplementedError("UFL is not installed")
+        celltype = _cells[cell]
+        tdim = len(basix.topology(celltype)) - 1
+        self.element = basix.ufl.blocked_element(
+            basix.ufl.element(basix.ElementFamily.P, cell, degree, basix.LagrangeVariant.gll_warped),
+            shape=(tdim, ))
+        self.sub_element = self.element.sub_elements[0].basix_element._e
+        self.x = _points(celltype, npoints)
+
+    def time_tabulate(self, cell, degree, npoints, interface):
+        if interface == "ufl":
+            self.element.tabulate(1, self.x)
+        else:
+            self.sub_element.tabulate(1, self.x)
+
+
+class MixedElement:
+    params = (list(_cells), [1, 3], [1, 100], ["ufl", "cpp"])
+    param_names = ["cell", "degree", "npoints", "interface"]
+
+    def setup(self, cell, degree, npoints, interface):
+        if not hasattr(basix, "ufl"):
+            raise NotImplementedError("UFL is not installed")
+        celltype = _cells[cell]
+        self.element = basix.ufl.mixed_element([
+            basix.ufl.element(basix.ElementFamily.N1E, cell, degree, basix.LagrangeVariant.legendre),
+            basix.ufl.element(basix.ElementFamily.P, cell, degree, basix.LagrangeVariant.gll_warped)])
+        self.sub_elements = [e.basix_element._e for e in self.element.sub_elements]
+        self.x = _points(celltype, npoints)
+
+    def time_tabulate(self, cell, degree, npoints, interface):
+        if interface == "ufl":
+            self.element.tabulate(1, self.x)
+        else:
+            for e in self.sub_elements:
+                e.tabulate(1, self.x)
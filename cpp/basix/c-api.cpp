@@ -0,0 +1,202 @@
+// Copyright (c) 2024 Basix contributors
+// FEniCS Project
+// SPDX-License-Identifier:    MIT
+
+#include "c-api.h"
+#include "codegen.h"
+#include "finite-element.h"
+#include "maps.h"
+#include <exception>
+#include <numeric>
+#include <span>
+#include <string>
+
+using namespace basix;
+
+namespace
+{
+//-----------------------------------------------------------------------------
+template <typename T, std::size_t d>
+using mdspan_t = MDSPAN_IMPL_STANDARD_NAMESPACE::mdspan<
+    T, MDSPAN_IMPL_STANDARD_NAMESPACE::dextents<std::size_t, d>>;
+//-----------------------------------------------------------------------------
+/// The opaque handle type of an element with scalar type T
+template <std::floating_point T>
+struct handle;
+template <>
+struct handle<double>
+{
+  using type = basix_element_float64;
+};
+template <>
+struct handle<float>
+{
+  using type = basix_element_float32;
+};
+template <std::floating_point T>
+using handle_t = typename handle<T>::type;
+//-----------------------------------------------------------------------------
+/// The element that a handle refers to
+template <std::floating_point T>
+const FiniteElement<T>& get_element(const handle_t<T>* element)
+{
+  if (!element)
+    throw std::runtime_error("Element handle is null.");
+  return *reinterpret_cast<const FiniteElement<T>*>(element);
+}
+//-----------------------------------------------------------------------------
+thread_local std::string last_error;
+//-----------------------------------------------------------------------------
+/// Call f, and convert any exception that it throws into an error code,
+/// as exceptions must not propagate through C code
+template <typename Fn>
+int try_call(Fn f) noexcept
+{
+  try
+  {
+    f();
+    return 0;
+  }
+  catch (const std::exception& e)
+  {
+    last_error = e.what();
+  }
+  catch (...)
+  {
+    last_error = "Unknown error";
+  }
+  return 1;
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point T>
+int tabulate(const handle_t<T>* element, int nd, const T* x,
+             std::size_t num_points, T* basis)
+{
+  return try_call(
+      [&]()
+      {
+        const FiniteElement<T>& e = get_element<T>(element);
+        const std::size_t tdim = cell::topological_dimension(e.cell_type());
+        e.tabulate(nd, mdspan_t<const T, 2>(x, num_points, tdim),
+                   mdspan_t<T, 4>(basis, e.tabulate_shape(nd, num_points)));
+      });
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point T>
+int dof_transformation(const handle_t<T>* element, int kind, T* data,
+                       int block_size, std::uint32_t cell_info)
+{
+  return try_call(
+      [&]()
+      {
+        const FiniteElement<T>& e = get_element<T>(element);
+        std::span<T> d(data, e.dim() * block_size);
+        switch (static_cast<codegen::transformation>(kind))
+        {
+        case codegen::transformation::pre_apply:
+          e.pre_apply_dof_transformation(d, block_size, cell_info);
+          break;
+        case codegen::transformation::pre_apply_transpose:
+          e.pre_apply_transpose_dof_transformation(d, block_size, cell_info);
+          break;
+        case codegen::transformation::pre_apply_inverse:
+          e.pre_apply_inverse_dof_transformation(d, block_size, cell_info);
+          break;
+        case codegen::transformation::pre_apply_inverse_transpose:
+          e.pre_apply_inverse_transpose_dof_transformation(d, block_size,
+                                                           cell_info);
+          break;
+        case codegen::transformation::post_apply:
+          e.post_apply_dof_transformation(d, block_size, cell_info);
+          break;
+        case codegen::transformation::post_apply_transpose:
+          e.post_apply_transpose_dof_transformation(d, block_size, cell_info);
+          break;
+        case codegen::transformation::post_apply_inverse:
+          e.post_apply_inverse_dof_transformation(d, block_size, cell_info);
+          break;
+        case codegen::transformation::post_apply_inverse_transpose:
+          e.post_apply_inverse_transpose_dof_transformation(d, block_size,
+                                                            cell_info);
+          break;
+        default:
+          throw std::runtime_error("Unsupported transformation");
+        }
+      });
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point T>
+int push_forward(const handle_t<T>* element, const T* U, const T* J,
+                 const T* detJ, const T* K, std::size_t num_points,
+                 std::size_t num_functions, std::size_t gdim, T* u)
+{
+  return try_call(
+      [&]()
+      {
+        const FiniteElement<T>& e = get_element<T>(element);
+        const std::size_t tdim = cell::topological_dimension(e.cell_type());
+        const std::vector<std::size_t>& vshape = e.value_shape();
+        const std::size_t ref_vs = std::accumulate(
+            vshape.begin(), vshape.end(), 1, std::multiplies{});
+        const std::size_t vs
+            = maps::physical_value_size(e.map_type(), ref_vs, gdim);
+        e.push_forward(
+            mdspan_t<const T, 3>(U, num_points, num_functions, ref_vs),
+            mdspan_t<const T, 3>(J, num_points, gdim, tdim),
+            std::span<const T>(detJ, num_points),
+            mdspan_t<const T, 3>(K, num_points, tdim, gdim),
+            mdspan_t<T, 3>(u, num_points, num_functions, vs));
+      });
+}
+//-----------------------------------------------------------------------------
+} // namespace
+
+//-----------------------------------------------------------------------------
+const char* basix_last_error(void) { return last_error.c_str(); }
+//-----------------------------------------------------------------------------
+int basix_tabulate_float64(const basix_element_float64* element, int nd,
+                           const double* x, size_t num_points, double* basis)
+{
+  return tabulate(element, nd, x, num_points, basis);
+}
+//-----------------------------------------------------------------------------
+int basix_tabulate_float32(const basix_element_float32* element, int nd,
+                           const float* x, size_t num_points, float* basis)
+{
+  return tabulate(element, nd, x, num_points, basis);
+}
+//-----------------------------------------------------------------------------
+int basix_dof_transformation_float64(const basix_element_float64* element,
+                                     int kind, double* data, int block_size,
+                                     uint32_t cell_info)
+{
+  return dof_transformation(element, kind, data, block_size, cell_info);
+}
+//-----------------------------------------------------------------------------
+int basix_dof_transformation_float32(const basix_element_float32* element,
+                                     int kind, float* data, int block_size,
+                                     uint32_t cell_info)
+{
+  return dof_transformation(element, kind, data, block_size, cell_info);
+}
+//-----------------------------------------------------------------------------
+int basix_push_forward_float64(const basix_element_float64* element,
+                               const double* U, const double* J,
+                               const double* detJ, const double* K,
+                               size_t num_points, size_t num_functions,
+                               size_t gdim, double* u)
+{
+  return push_forward(element, U, J, detJ, K, num_points, num_functions, gdim,
+                      u);
+}
+//-----------------------------------------------------------------------------
+int basix_push_forward_float32(const basix_element_float32* element,
+                               const float* U, const float* J,
+                               const float* detJ, const float* K,
+                               size_t num_points, size_t num_functions,
+                               size_t gdim, float* u)
+{
+  return push_forward(element, U, J, detJ, K, num_points, num_functions, gdim,
+                      u);
+}
+//-----------------------------------------------------------------------------
@@ -0,0 +1,114 @@
+// Copyright (c) 2024 Basix contributors
+// FEniCS Project
+// SPDX-License-Identifier:    MIT
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/// @file c-api.h
+/// @brief C interface to the runtime functions of a finite element.
+///
+/// The functions take a handle to a `basix::FiniteElement<double>` (a
+/// `basix_element_float64`) or a `basix::FiniteElement<float>` (a
+/// `basix_element_float32`), which is the address of the element. The
+/// handle types are distinct, so passing an element of the wrong scalar
+/// type is a compile error in C. The element must outlive all calls
+/// that use its handle.
+///
+/// The functions have C linkage and take only pointers and integers, so
+/// they can be called from C, from cffi, and from inside Numba-jitted
+/// code with no Python overhead. All arrays are C-contiguous.
+///
+/// Each function returns 0 on success. If an error occurs, the function
+/// returns a non-zero value and `basix_last_error` describes the error.
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+  /// @brief Opaque handle to a `basix::FiniteElement<double>`
+  typedef struct basix_element_float64 basix_element_float64;
+
+  /// @brief Opaque handle to a `basix::FiniteElement<float>`
+  typedef struct basix_element_float32 basix_element_float32;
+
+  /// @brief Description of the last error that occurred on the calling
+  /// thread.
+  ///
+  /// The string is valid until the next call to a function of this
+  /// interface on the same thread.
+  const char* basix_last_error(void);
+
+  /// @brief Tabulate basis functions and their derivatives.
+  /// @param[in] element Handle to the element
+  /// @param[in] nd The order of derivatives, up to and including, to
+  /// compute
+  /// @param[in] x The points, with shape (num_points, tdim)
+  /// @param[in] num_points The number of points
+  /// @param[out] basis The table, with shape
+  /// `FiniteElement::tabulate_shape(nd, num_points)`
+  /// @return 0 on success
+  int basix_tabulate_float64(const basix_element_float64* element, int nd,
+                             const double* x, size_t num_points,
+                             double* basis);
+
+  /// @brief Tabulate basis functions and their derivatives.
+  /// @see basix_tabulate_float64
+  int basix_tabulate_float32(const basix_element_float32* element, int nd,
+                             const float* x, size_t num_points, float* basis);
+
+  /// @brief Apply a DOF transformation in-place to the data of a cell.
+  /// @param[in] element Handle to the element
+  /// @param[in] kind The transformation, as the value of a
+  /// `basix::codegen::transformation`: 0 is
+  /// `pre_apply_dof_transformation`, 1 is
+  /// `pre_apply_transpose_dof_transformation`, and so on
+  /// @param[in,out] data The data
+  /// @param[in] block_size The number of data points per DOF
+  /// @param[in] cell_info The permutation info for the cell
+  /// @return 0 on success
+  int basix_dof_transformation_float64(const basix_element_float64* element,
+                                       int kind, double* data, int block_size,
+                                       uint32_t cell_info);
+
+  /// @brief Apply a DOF transformation in-place to the data of a cell.
+  /// @see basix_dof_transformation_float64
+  int basix_dof_transformation_float32(const basix_element_float32* element,
+                                       int kind, float* data, int block_size,
+                                       uint32_t cell_info);
+
+  /// @brief Map function values from the reference to a physical cell.
+  /// @param[in] element Handle to the element
+  /// @param[in] U The values on the reference, with shape (num_points,
+  /// num_functions, reference value size)
+  /// @param[in] J The Jacobians, with shape (num_points, gdim, tdim)
+  /// @param[in] detJ The determinants of the Jacobians, with shape
+  /// (num_points)
+  /// @param[in] K The inverse Jacobians, with shape (num_points, tdim,
+  /// gdim)
+  /// @param[in] num_points The number of points
+  /// @param[in] num_functions The number of functions at each point
+  /// @param[in] gdim The geometric dimension
+  /// @param[out] u The values on the cell, with shape (num_points,
+  /// num_functions, physical value size)
+  /// @return 0 on success
+  int basix_push_forward_float64(const basix_element_float64* element,
+                                 const double* U, const double* J,
+                                 const double* detJ, const double* K,
+                                 size_t num_points, size_t num_functions,
+                                 size_t gdim, double* u);
+
+  /// @brief Map function values from the reference to a physical cell.
+  /// @see basix_push_forward_float64
+  int basix_push_forward_float32(const basix_element_float32* element,
+                                 const float* U, const float* J,
+                                 const float* detJ, const float* K,
+                                 size_t num_points, size_t num_functions,
+                                 size_t gdim, float* u);
+
+#ifdef __cplusplus
+}
+#endif
@@ -19,386 +19,70 @@ template <std::floating_point T>
 std::pair<std::vector<T>, std::array<std::size_t, 2>>
 cell::geometry(cell::type celltype)
 {
-  switch (celltype)
-  {
-  case cell::type::point:
+  if (celltype == cell::type::point)
     return {{}, {0, 1}};
-  case cell::type::interval:
-    return {{0.0, 1.0}, {2, 1}};
-  case cell::type::triangle:
-    return {{0.0, 0.0, 1.0, 0.0, 0.0, 1.0}, {3, 2}};
-  case cell::type::quadrilateral:
-    return {{0.0, 0.0, 1.0, 0.0, 0.0, 1.0, 1.0, 1.0}, {4, 2}};
-  case cell::type::tetrahedron:
-    return {{0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0},
-            {4, 3}};
-  case cell::type::prism:
-    return {{0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0, 1.0,
-             0.0, 1.0, 0.0, 1.0, 1.0},
-            {6, 3}};
-  case cell::type::pyramid:
-    return {{0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 1.0, 1.0, 0.0, 0.0,
-             0.0, 1.0},
-            {5, 3}};
-  case cell::type::hexahedron:
-    return {{0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 1.0, 1.0, 0.0,
-             0.0, 0.0, 1.0, 1.0, 0.0, 1.0, 0.0, 1.0, 1.0, 1.0, 1.0, 1.0},
-            {8, 3}};
-  default:
-    throw std::runtime_error("Unsupported cell type");
-  }
+
+  const std::span<const T> x = cell::geometry_view<T>(celltype);
+  const std::size_t tdim = cell::topological_dimension(celltype);
+  return {std::vector<T>(x.begin(), x.end()), {x.size() / tdim, tdim}};
 }
 //-----------------------------------------------------------------------------
 std::vector<std::vector<std::vector<int>>> cell::topology(cell::type celltype)
 {
-  switch (celltype)
-  {
-  case cell::type::point:
-    return {{{0}}};
-  case cell::type::interval:
-    return {{{0}, {1}}, {{0, 1}}};
-  case cell::type::triangle:
-  {
-    std::vector<std::vector<std::vector<int>>> t(3);
-    // Vertices
-    t[0] = {{0}, {1}, {2}};
-    // Edges
-    t[1] = {{1, 2}, {0, 2}, {0, 1}};
-    // Cell
-    t[2] = {{0, 1, 2}};
-    return t;
-  }
-  case cell::type::quadrilateral:
-  {
-    std::vector<std::vector<std::vector<int>>> t(3);
-    // Vertices
-    t[0] = {{0}, {1}, {2}, {3}};
-    // Edges
-    t[1] = {{0, 1}, {0, 2}, {1, 3}, {2, 3}};
-    // Cell
-    t[2] = {{0, 1, 2, 3}};
-    return t;
-  }
-  case cell::type::tetrahedron:
-  {
-    std::vector<std::vector<std::vector<int>>> t(4);
-    // Vertices
-    t[0] = {{0}, {1}, {2}, {3}};
-    // Edges
-    t[1] = {{2, 3}, {1, 3}, {1, 2}, {0, 3}, {0, 2}, {0, 1}};
-    // Faces
-    t[2] = {{1, 2, 3}, {0, 2, 3}, {0, 1, 3}, {0, 1, 2}};
-    // Cell
-    t[3] = {{0, 1, 2, 3}};
-    return t;
-  }
-  case cell::type::prism:
-  {
-    std::vector<std::vector<std::vector<int>>> t(4);
-    // Vertices
-    t[0] = {{0}, {1}, {2}, {3}, {4}, {5}};
-    // Edges
-    t[1] = {{0, 1}, {0, 2}, {0, 3}, {1, 2}, {1, 4},
-            {2, 5}, {3, 4}, {3, 5}, {4, 5}};
-    // Faces
-    t[2] = {{0, 1, 2}, {0, 1, 3, 4}, {0, 2, 3, 5}, {1, 2, 4, 5}, {3, 4, 5}};
-    // Cell
-    t[3] = {{0, 1, 2, 3, 4, 5}};
-    return t;
-  }
-  case cell::type::pyramid:
-  {
-    std::vector<std::vector<std::vector<int>>> t(4);
-    // Vertices
-    t[0] = {{0}, {1}, {2}, {3}, {4}};
-    // Edges
-    t[1] = {{0, 1}, {0, 2}, {0, 4}, {1, 3}, {1, 4}, {2, 3}, {2, 4}, {3, 4}};
-    // Faces
-    t[2] = {{0, 1, 2, 3}, {0, 1, 4}, {0, 2, 4}, {1, 3, 4}, {2, 3, 4}};
-    // Cell
-    t[3] = {{0, 1, 2, 3, 4}};
-    return t;
-  }
-  case cell::type::hexahedron:
+  const int tdim = cell::topological_dimension(celltype);
+  std::vector<std::vector<std::vector<int>>> t(tdim + 1);
+  for (int d = 0; d <= tdim; ++d)
   {
-    std::vector<std::vector<std::vector<int>>> t(4);
-    // Vertices
-    t[0] = {{0}, {1}, {2}, {3}, {4}, {5}, {6}, {7}};
-    // Edges
-    t[1] = {{0, 1}, {0, 2}, {0, 4}, {1, 3}, {1, 5}, {2, 3},
-            {2, 6}, {3, 7}, {4, 5}, {4, 6}, {5, 7}, {6, 7}};
-    // Faces
-    t[2] = {{0, 1, 2, 3}, {0, 1, 4, 5}, {0, 2, 4, 6},
-            {1, 3, 5, 7}, {2, 3, 6, 7}, {4, 5, 6, 7}};
-    // Cell
-    t[3] = {{0, 1, 2, 3, 4, 5, 6, 7}};
-    return t;
-  }
-  default:
-    throw std::runtime_error("Unsupported cell type");
+    const cell::csr_view entities = cell::topology_view(celltype, d);
+    t[d].reserve(entities.size());
+    for (std::size_t e = 0; e < entities.size(); ++e)
+      t[d].emplace_back(entities[e].begin(), entities[e].end());
   }
+  return t;
 }
 //-----------------------------------------------------------------------------
 std::vector<std::vector<std::vector<std::vector<int>>>>
 cell::sub_entity_connectivity(cell::type celltype)
 {
-  switch (celltype)
-  {
-  case cell::type::point:
-    return {{{{0}}}};
-  case cell::type::interval:
-  {
-    std::vector<std::vector<std::vector<std::vector<int>>>> t(2);
-    // Vertices
-    t[0] = {{{0}, {0}}, {{1}, {0}}};
-    // Edge
-    t[1] = {{{0, 1}, {0}}};
-    return t;
-  }
-  case cell::type::triangle:
-  {
-    std::vector<std::vector<std::vector<std::vector<int>>>> t(3);
-    // Vertices
-    t[0] = {{{0}, {1, 2}, {0}}, {{1}, {0, 2}, {0}}, {{2}, {0, 1}, {0}}};
-    // Edges
-    t[1] = {{{1, 2}, {0}, {0}}, {{0, 2}, {1}, {0}}, {{0, 1}, {2}, {0}}};
-    // Face
-    t[2] = {{{0, 1, 2}, {0, 1, 2}, {0}}};
-    return t;
-  }
-  case cell::type::quadrilateral:
-  {
-    std::vector<std::vector<std::vector<std::vector<int>>>> t(3);
-    // Vertices
-    t[0] = {{{0}, {0, 1}, {0}},
-            {{1}, {0, 2}, {0}},
-            {{2}, {1, 3}, {0}},
-            {{3}, {2, 3}, {0}}};
-    // Edges
-    t[1] = {{{0, 1}, {0}, {0}},
-            {{0, 2}, {1}, {0}},
-            {{1, 3}, {2}, {0}},
-            {{2, 3}, {3}, {0}}};
-    // Face
-    t[2] = {{{0, 1, 2, 3}, {0, 1, 2, 3}, {0}}};
-    return t;
-  }
-  case cell::type::tetrahedron:
-  {
-    std::vector<std::vector<std::vector<std::vector<int>>>> t(4);
-    // Vertices
-    t[0] = {{{0}, {3, 4, 5}, {1, 2, 3}, {0}},
-            {{1}, {1, 2, 5}, {0, 2, 3}, {0}},
-            {{2}, {0, 2, 4}, {0, 1, 3}, {0}},
-            {{3}, {0, 1, 3}, {0, 1, 2}, {0}}};
-    // Edges
-    t[1] = {
-        {{2, 3}, {0}, {0, 1}, {0}}, {{1, 3}, {1}, {0, 2}, {0}},
-        {{1, 2}, {2}, {0, 3}, {0}}, {{0, 3}, {3}, {1, 2}, {0}},
-        {{0, 2}, {4}, {1, 3}, {0}}, {{0, 1}, {5}, {2, 3}, {0}},
-    };
-    // Faces
-    t[2] = {{{1, 2, 3}, {0, 1, 2}, {0}, {0}},
-            {{0, 2, 3}, {0, 3, 4}, {1}, {0}},
-            {{0, 1, 3}, {1, 3, 5}, {2}, {0}},
-            {{0, 1, 2}, {2, 4, 5}, {3}, {0}}};
-    // Volume
-    t[3] = {{{0, 1, 2, 3}, {0, 1, 2, 3, 4, 5}, {0, 1, 2, 3}, {0}}};
-    return t;
-  }
-  case cell::type::hexahedron:
-  {
-    std::vector<std::vector<std::vector<std::vector<int>>>> t(4);
-    // Vertices
-    t[0] = {
-        {{0}, {0, 1, 2}, {0, 1, 2}, {0}},  {{1}, {0, 3, 4}, {0, 1, 3}, {0}},
-        {{2}, {1, 5, 6}, {0, 2, 4}, {0}},  {{3}, {3, 5, 7}, {0, 3, 4}, {0}},
-        {{4}, {2, 8, 9}, {1, 2, 5}, {0}},  {{5}, {4, 8, 10}, {1, 3, 5}, {0}},
-        {{6}, {6, 9, 11}, {2, 4, 5}, {0}}, {{7}, {7, 10, 11}, {3, 4, 5}, {0}}};
-    // Edges
-    t[1] = {{{0, 1}, {0}, {0, 1}, {0}},  {{0, 2}, {1}, {0, 2}, {0}},
-            {{0, 4}, {2}, {1, 2}, {0}},  {{1, 3}, {3}, {0, 3}, {0}},
-            {{1, 5}, {4}, {1, 3}, {0}},  {{2, 3}, {5}, {0, 4}, {0}},
-            {{2, 6}, {6}, {2, 4}, {0}},  {{3, 7}, {7}, {3, 4}, {0}},
-            {{4, 5}, {8}, {1, 5}, {0}},  {{4, 6}, {9}, {2, 5}, {0}},
-            {{5, 7}, {10}, {3, 5}, {0}}, {{6, 7}, {11}, {4, 5}, {0}}};
-    // Faces
-    t[2] = {{{0, 1, 2, 3}, {0, 1, 3, 5}, {0}, {0}},
-            {{0, 1, 4, 5}, {0, 2, 4, 8}, {1}, {0}},
-            {{0, 2, 4, 6}, {1, 2, 6, 9}, {2}, {0}},
-            {{1, 3, 5, 7}, {3, 4, 7, 10}, {3}, {0}},
-            {{2, 3, 6, 7}, {5, 6, 7, 11}, {4}, {0}},
-            {{4, 5, 6, 7}, {8, 9, 10, 11}, {5}, {0}}};
-    // Volume
-    t[3] = {{{0, 1, 2, 3, 4, 5, 6, 7},
-             {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11},
-             {0, 1, 2, 3, 4, 5},
-             {0}}};
-    return t;
-  }
-  case cell::type::prism:
-  {
-    std::vector<std::vector<std::vector<std::vector<int>>>> t(4);
-    // Vertices
-    t[0] = {{{0}, {0, 1, 2}, {0, 1, 2}, {0}}, {{1}, {0, 3, 4}, {0, 1, 3}, {0}},
-            {{2}, {1, 3, 5}, {0, 2, 3}, {0}}, {{3}, {2, 6, 7}, {1, 2, 4}, {0}},
-            {{4}, {4, 6, 8}, {1, 3, 4}, {0}}, {{5}, {5, 7, 8}, {2, 3, 4}, {0}}};
-    // Edges
-    t[1] = {{{0, 1}, {0}, {0, 1}, {0}}, {{0, 2}, {1}, {0, 2}, {0}},
-            {{0, 3}, {2}, {1, 2}, {0}}, {{1, 2}, {3}, {0, 3}, {0}},
-            {{1, 4}, {4}, {1, 3}, {0}}, {{2, 5}, {5}, {2, 3}, {0}},
-            {{3, 4}, {6}, {1, 4}, {0}}, {{3, 5}, {7}, {2, 4}, {0}},
-            {{4, 5}, {8}, {3, 4}, {0}}};
-    // Faces
-    t[2] = {{{0, 1, 2}, {0, 1, 3}, {0}, {0}},
-            {{0, 1, 3, 4}, {0, 2, 4, 6}, {1}, {0}},
-            {{0, 2, 3, 5}, {1, 2, 5, 7}, {2}, {0}},
-            {{1, 2, 4, 5}, {3, 4, 5, 8}, {3}, {0}},
-            {{3, 4, 5}, {6, 7, 8}, {4}, {0}}};
-    // Volume
-    t[3] = {{{0, 1, 2, 3, 4, 5},
-             {0, 1, 2, 3, 4, 5, 6, 7, 8},
-             {0, 1, 2, 3, 4},
-             {0}}};
-    return t;
-  }
-  case cell::type::pyramid:
-  {
-    std::vector<std::vector<std::vector<std::vector<int>>>> t(4);
-    // Vertices
-    t[0] = {{{0}, {0, 1, 2}, {0, 1, 2}, {0}},
-            {{1}, {0, 3, 4}, {0, 1, 3}, {0}},
-            {{2}, {1, 5, 6}, {0, 2, 4}, {0}},
-            {{3}, {3, 5, 7}, {0, 3, 4}, {0}},
-            {{4}, {2, 4, 6, 7}, {1, 2, 3, 4}, {0}}};
-    // Edges
-    t[1] = {{{0, 1}, {0}, {0, 1}, {0}}, {{0, 2}, {1}, {0, 2}, {0}},
-            {{0, 4}, {2}, {1, 2}, {0}}, {{1, 3}, {3}, {0, 3}, {0}},
-            {{1, 4}, {4}, {1, 3}, {0}}, {{2, 3}, {5}, {0, 4}, {0}},
-            {{2, 4}, {6}, {2, 4}, {0}}, {{3, 4}, {7}, {3, 4}, {0}}};
-    // Faces
-    t[2] = {{{0, 1, 2, 3}, {0, 1, 3, 5}, {0}, {0}},
-            {{0, 1, 4}, {0, 2, 4}, {1}, {0}},
-            {{0, 2, 4}, {1, 2, 6}, {2}, {0}},
-            {{1, 3, 4}, {3, 4, 7}, {3}, {0}},
-            {{2, 3, 4}, {5, 6, 7}, {4}, {0}}};
-    // Volume
-    t[3] = {{{0, 1, 2, 3, 4}, {0, 1, 2, 3, 4, 5, 6, 7}, {0, 1, 2, 3, 4}, {0}}};
-    return t;
-  }
-  default:
-    throw std::runtime_error("Unsupported cell type");
-  }
-}
-//-----------------------------------------------------------------------------
-int cell::topological_dimension(cell::type cell_type)
-{
-  switch (cell_type)
+  const int tdim = cell::topological_dimension(celltype);
+  std::vector<std::vector<std::vector<std::vector<int>>>> t(tdim + 1);
+  for (int d = 0; d <= tdim; ++d)
   {
-  case cell::type::point:
-    return 0;
-  case cell::type::interval:
-    return 1;
-  case cell::type::triangle:
-    return 2;
-  case cell::type::quadrilateral:
-    return 2;
-  case cell::type::tetrahedron:
-    return 3;
-  case cell::type::hexahedron:
-    return 3;
-  case cell::type::prism:
-    return 3;
-  case cell::type::pyramid:
-    return 3;
-  default:
-    throw std::runtime_error("Unsupported cell type");
+    t[d].resize(cell::num_sub_entities(celltype, d));
+    for (std::size_t e = 0; e < t[d].size(); ++e)
+    {
+      const cell::csr_view c
+          = cell::sub_entity_connectivity_view(celltype, d, e);
+      t[d][e].reserve(c.size());
+      for (std::size_t i = 0; i < c.size(); ++i)
+        t[d][e].emplace_back(c[i].begin(), c[i].end());
+    }
   }
+  return t;
 }
 //-----------------------------------------------------------------------------
 template <std::floating_point T>
 std::pair<std::vector<T>, std::array<std::size_t, 2>>
 cell::sub_entity_geometry(cell::type celltype, int dim, int index)
 {
-  const std::vector<std::vector<std::vector<int>>> cell_topology
-      = cell::topology(celltype);
-  if (dim < 0 or dim >= (int)cell_topology.size())
-    throw std::runtime_error("Invalid dimension for sub-entity");
-
-  const std::vector<std::vector<int>>& t = cell_topology[dim];
+  const cell::csr_view t = cell::topology_view(celltype, dim);
   if (index < 0 or index >= (int)t.size())
     throw std::runtime_error("Invalid entity index");
 
-  const auto [cell_geometry, shape] = cell::geometry<T>(celltype);
-  mdspan_t<const T, 2> geometry(cell_geometry.data(), shape);
+  const std::size_t tdim = cell::topological_dimension(celltype);
+  mdspan_t<const T, 2> geometry(cell::geometry_view<T>(celltype).data(),
+                                cell::num_sub_entities(celltype, 0), tdim);
 
-  std::array<std::size_t, 2> subshape = {t[index].size(), geometry.extent(1)};
+  const std::span<const int> vertices = t[index];
+  std::array<std::size_t, 2> subshape = {vertices.size(), geometry.extent(1)};
   std::vector<T> sub_geometry(subshape[0] * subshape[1]);
   mdspan_t<T, 2> sub_entity(sub_geometry.data(), subshape);
   for (std::size_t i = 0; i < sub_entity.extent(0); ++i)
     for (std::size_t j = 0; j < sub_entity.extent(1); ++j)
-      sub_entity(i, j) = geometry(t[index][i], j);
+      sub_entity(i, j) = geometry(vertices[i], j);
 
   return {sub_geometry, subshape};
 }
-//----------------------------------------------------------------------------
-int cell::num_sub_entities(cell::type celltype, int dim)
-{
-  constexpr std::array<int, 4> point = {1, 0, 0, 0};
-  constexpr std::array<int, 4> interval = {2, 1, 0, 0};
-  constexpr std::array<int, 4> triangle = {3, 3, 1, 0};
-  constexpr std::array<int, 4> tetrahedron = {4, 6, 4, 1};
-  constexpr std::array<int, 4> quadrilateral = {4, 4, 1, 0};
-  constexpr std::array<int, 4> hexahedron = {8, 12, 6, 1};
-  constexpr std::array<int, 4> prism = {6, 9, 5, 1};
-  constexpr std::array<int, 4> pyramid = {5, 8, 5, 1};
-
-  switch (celltype)
-  {
-  case cell::type::point:
-    return point[dim];
-  case cell::type::interval:
-    return interval[dim];
-  case cell::type::triangle:
-    return triangle[dim];
-  case cell::type::tetrahedron:
-    return tetrahedron[dim];
-  case cell::type::quadrilateral:
-    return quadrilateral[dim];
-  case cell::type::hexahedron:
-    return hexahedron[dim];
-  case cell::type::prism:
-    return prism[dim];
-  case cell::type::pyramid:
-    return pyramid[dim];
-  default:
-    throw std::runtime_error("Unsupported cell type");
-  }
-}
-//----------------------------------------------------------------------------
-cell::type cell::sub_entity_type(cell::type celltype, int dim, int index)
-{
-  const int tdim = cell::topological_dimension(celltype);
-  assert(dim >= 0 and dim <= tdim);
-
-  if (dim == 0)
-    return cell::type::point;
-  else if (dim == 1)
-    return cell::type::interval;
-  else if (dim == tdim)
-    return celltype;
-
-  const std::vector<std::vector<std::vector<int>>> t = cell::topology(celltype);
-  switch (t[dim][index].size())
-  {
-  case 3:
-    return cell::type::triangle;
-  case 4:
-    return cell::type::quadrilateral;
-  default:
-    throw std::runtime_error("Error in sub_entity_type");
-  }
-}
 //-----------------------------------------------------------------------------
 template <std::floating_point T>
 T cell::volume(cell::type cell_type)
@@ -450,10 +134,9 @@ std::pair<std::vector<T>, std::array<std::size_t, 2>>
 cell::facet_normals(cell::type cell_type)
 {
   const std::size_t tdim = cell::topological_dimension(cell_type);
-  std::vector<std::vector<int>> facets = cell::topology(cell_type)[tdim - 1];
-  auto [xdata, xshape] = cell::geometry<T>(cell_type);
-
-  mdspan_t<const T, 2> x(xdata.data(), xshape);
+  const cell::csr_view facets = cell::topology_view(cell_type, tdim - 1);
+  mdspan_t<const T, 2> x(cell::geometry_view<T>(cell_type).data(),
+                         cell::num_sub_entities(cell_type, 0), tdim);
   std::array<std::size_t, 2> shape = {facets.size(), tdim};
   std::vector<T> normal(shape[0] * shape[1]);
   mdspan_t<T, 2> n(normal.data(), shape);
@@ -466,7 +149,7 @@ cell::facet_normals(cell::type cell_type)
   {
     for (std::size_t f = 0; f < facets.size(); ++f)
     {
-      const std::vector<int>& facet = facets[f];
+      const std::span<const int> facet = facets[f];
       assert(facet.size() == 2);
       n(f, 0) = x(facet[1], 1) - x(facet[0], 1);
       n(f, 1) = x(facet[0], 0) - x(facet[1], 0);
@@ -480,8 +163,8 @@ cell::facet_normals(cell::type cell_type)
   {
     for (std::size_t f = 0; f < facets.size(); ++f)
     {
-      const std::vector<int>& facet = facets[f];
-      assert(facets[f].size() == 3 or facets[f].size() == 4);
+      const std::span<const int> facet = facets[f];
+      assert(facet.size() == 3 or facet.size() == 4);
       std::array<T, 3> e0, e1;
       for (std::size_t i = 0; i < 3; ++i)
       {
@@ -505,9 +188,9 @@ cell::facet_normals(cell::type cell_type)
 std::vector<bool> cell::facet_orientations(cell::type cell_type)
 {
   const std::size_t tdim = cell::topological_dimension(cell_type);
-  const auto [_x, xshape] = cell::geometry<double>(cell_type);
-  mdspan_t<const double, 2> x(_x.data(), xshape);
-  std::vector<std::vector<int>> facets = topology(cell_type)[tdim - 1];
+  mdspan_t<const double, 2> x(cell::geometry_view<double>(cell_type).data(),
+                              cell::num_sub_entities(cell_type, 0), tdim);
+  const cell::csr_view facets = cell::topology_view(cell_type, tdim - 1);
 
   const auto [normals, shape] = cell::facet_normals<double>(cell_type);
   mdspan_t<const double, 2> n(normals.data(), shape);
@@ -535,74 +218,25 @@ std::vector<bool> cell::facet_orientations(cell::type cell_type)
 template <std::floating_point T>
 std::vector<T> cell::facet_reference_volumes(cell::type cell_type)
 {
-  int tdim = topological_dimension(cell_type);
-  std::vector<cell::type> facet_types = subentity_types(cell_type)[tdim - 1];
+  const int tdim = cell::topological_dimension(cell_type);
   std::vector<T> out;
-  for (auto& facet_type : facet_types)
+  for (cell::type facet_type : cell::subentity_types_view(cell_type, tdim - 1))
     out.push_back(cell::volume<T>(facet_type));
   return out;
 }
 //-----------------------------------------------------------------------------
 std::vector<std::vector<cell::type>> cell::subentity_types(cell::type cell_type)
 {
-  switch (cell_type)
+  const int tdim = cell::topological_dimension(cell_type);
+  std::vector<std::vector<cell::type>> types;
+  types.reserve(tdim + 1);
+  for (int d = 0; d <= tdim; ++d)
   {
-  case cell::type::point:
-    return {{cell::type::point}};
-  case cell::type::interval:
-    return {{cell::type::point, cell::type::point}, {cell::type::interval}};
-  case cell::type::triangle:
-    return {{cell::type::point, cell::type::point, cell::type::point},
-            {cell::type::interval, cell::type::interval, cell::type::interval},
-            {cell::type::triangle}};
-  case cell::type::quadrilateral:
-    return {{cell::type::point, cell::type::point, cell::type::point,
-             cell::type::point},
-            {cell::type::interval, cell::type::interval, cell::type::interval,
-             cell::type::interval},
-            {cell::type::quadrilateral}};
-  case cell::type::tetrahedron:
-    return {{cell::type::point, cell::type::point, cell::type::point,
-             cell::type::point},
-            {cell::type::interval, cell::type::interval, cell::type::interval,
-             cell::type::interval, cell::type::interval, cell::type::interval},
-            {cell::type::triangle, cell::type::triangle, cell::type::triangle,
-             cell::type::triangle},
-            {cell::type::tetrahedron}};
-  case cell::type::hexahedron:
-    return {{cell::type::point, cell::type::point, cell::type::point,
-             cell::type::point, cell::type::point, cell::type::point,
-             cell::type::point, cell::type::point},
-            {cell::type::interval, cell::type::interval, cell::type::interval,
-             cell::type::interval, cell::type::interval, cell::type::interval,
-             cell::type::interval, cell::type::interval, cell::type::interval,
-             cell::type::interval, cell::type::interval, cell::type::interval},
-            {cell::type::quadrilateral, cell::type::quadrilateral,
-             cell::type::quadrilateral, cell::type::quadrilateral,
-             cell::type::quadrilateral, cell::type::quadrilateral},
-            {cell::type::hexahedron}};
-  case cell::type::prism:
-    return {{cell::type::point, cell::type::point, cell::type::point,
-             cell::type::point, cell::type::point, cell::type::point},
-            {cell::type::interval, cell::type::interval, cell::type::interval,
-             cell::type::interval, cell::type::interval, cell::type::interval,
-             cell::type::interval, cell::type::interval, cell::type::interval},
-            {cell::type::triangle, cell::type::quadrilateral,
-             cell::type::quadrilateral, cell::type::quadrilateral,
-             cell::type::triangle},
-            {cell::type::prism}};
-  case cell::type::pyramid:
-    return {{cell::type::point, cell::type::point, cell::type::point,
-             cell::type::point, cell::type::point},
-            {cell::type::interval, cell::type::interval, cell::type::interval,
-             cell::type::interval, cell::type::interval, cell::type::interval,
-             cell::type::interval, cell::type::interval},
-            {cell::type::quadrilateral, cell::type::triangle,
-             cell::type::triangle, cell::type::triangle, cell::type::triangle},
-            {cell::type::pyramid}};
-  default:
-    throw std::runtime_error("Unsupported cell type");
+    const std::span<const cell::type> t
+        = cell::subentity_types_view(cell_type, d);
+    types.emplace_back(t.begin(), t.end());
   }
+  return types;
 }
 //-----------------------------------------------------------------------------
 template <std::floating_point T>
@@ -616,16 +250,16 @@ cell::facet_jacobians(cell::type cell_type)
         "Facet jacobians not supported for this cell type.");
   }
 
-  const auto [_x, xshape] = cell::geometry<T>(cell_type);
-  mdspan_t<const T, 2> x(_x.data(), xshape);
-  std::vector<std::vector<int>> facets = topology(cell_type)[tdim - 1];
+  mdspan_t<const T, 2> x(cell::geometry_view<T>(cell_type).data(),
+                         cell::num_sub_entities(cell_type, 0), tdim);
+  const cell::csr_view facets = cell::topology_view(cell_type, tdim - 1);
 
   std::array<std::size_t, 3> shape = {facets.size(), tdim, tdim - 1};
   std::vector<T> jacobians(shape[0] * shape[1] * shape[2]);
   mdspan_t<T, 3> J(jacobians.data(), shape);
   for (std::size_t f = 0; f < facets.size(); ++f)
   {
-    const std::vector<int>& facet = facets[f];
+    const std::span<const int> facet = facets[f];
     for (std::size_t j = 0; j < tdim - 1; ++j)
       for (std::size_t k = 0; k < J.extent(1); ++k)
         J(f, k, j) = x(facet[1 + j], k) - x(facet[0], k);
@@ -635,6 +269,17 @@ cell::facet_jacobians(cell::type cell_type)
 }
 //-----------------------------------------------------------------------------
 
+// The reference cell tables are evaluated at compile time
+static_assert(cell::topological_dimension(cell::type::prism) == 3);
+static_assert(cell::num_sub_entities(cell::type::hexahedron, 1) == 12);
+static_assert(cell::topology_view(cell::type::tetrahedron, 1)[0][1] == 3);
+static_assert(cell::sub_entity_connectivity_view(cell::type::pyramid, 0, 4)[1]
+                  .size()
+              == 4);
+static_assert(cell::sub_entity_type(cell::type::prism, 2, 1)
+              == cell::type::quadrilateral);
+static_assert(cell::geometry_view<double>(cell::type::pyramid)[14] == 1.0);
+
 /// @cond
 // Explicit instantiation for double and float
 template std::pair<std::vector<float>, std::array<std::size_t, 2>>
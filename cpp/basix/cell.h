@@ -6,6 +6,9 @@
 
 #include <array>
 #include <concepts>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
 #include <utility>
 #include <vector>
 
@@ -29,6 +32,497 @@ enum class type : int
   pyramid = 7
 };
 
+/// @brief Non-owning view of an adjacency list stored in compressed
+/// sparse row (CSR) form.
+///
+/// Row `i` holds the entries `data[offsets[i]], ...,
+/// data[offsets[i + 1] - 1]`. The offsets are positions in `data`, so a
+/// view of a range of rows shares the data array of the full table.
+struct csr_view
+{
+  /// Offsets of the rows. The size is the number of rows plus one.
+  std::span<const int> offsets;
+
+  /// Entries of the rows
+  std::span<const int> data;
+
+  /// Number of rows
+  constexpr std::size_t size() const noexcept
+  {
+    return offsets.empty() ? 0 : offsets.size() - 1;
+  }
+
+  /// Entries of a row
+  /// @param i Row index
+  /// @return The entries of row `i`
+  constexpr std::span<const int> operator[](std::size_t i) const
+  {
+    return data.subspan(offsets[i], offsets[i + 1] - offsets[i]);
+  }
+};
+
+namespace impl
+{
+/// @private Compile-time topology of a reference cell. The
+/// sub-entities of all dimensions are numbered consecutively, starting
+/// with the vertices.
+template <std::size_t NE, std::size_t NNZ>
+struct topology_table
+{
+  /// Topological dimension
+  int tdim;
+
+  /// Number of the first sub-entity of each dimension. Dimensions
+  /// greater than `tdim` are empty.
+  std::array<int, 5> entity_offsets;
+
+  /// Offsets into `vertices` for each sub-entity
+  std::array<int, NE + 1> offsets;
+
+  /// Vertices of each sub-entity
+  std::array<int, NNZ> vertices;
+
+  /// Cell type of each sub-entity
+  std::array<cell::type, NE> types;
+};
+
+/// @private Compile-time connectivity of a reference cell. Row
+/// `4 * e + d` lists the sub-entities of dimension `d` connected to
+/// sub-entity `e`.
+template <std::size_t NE, std::size_t NC>
+struct connectivity_table
+{
+  /// Offsets into `entities` for each row
+  std::array<int, 4 * NE + 1> offsets;
+
+  /// Local indices of the connected sub-entities
+  std::array<int, NC> entities;
+};
+
+/// @private Build the topology table of a reference cell from the
+/// number of vertices of each sub-entity and the flattened vertex
+/// lists.
+template <std::size_t NE, std::size_t NNZ>
+consteval topology_table<NE, NNZ>
+make_topology(cell::type celltype, int tdim, std::array<int, 4> num_entities,
+              std::array<int, NE> sizes, std::array<int, NNZ> vertices)
+{
+  topology_table<NE, NNZ> t{};
+  t.tdim = tdim;
+  for (int d = 0; d < 4; ++d)
+    t.entity_offsets[d + 1] = t.entity_offsets[d] + num_entities[d];
+  if (t.entity_offsets[4] != static_cast<int>(NE))
+    throw std::runtime_error("Inconsistent number of sub-entities");
+
+  for (std::size_t e = 0; e < NE; ++e)
+    t.offsets[e + 1] = t.offsets[e] + sizes[e];
+  if (t.offsets[NE] != static_cast<int>(NNZ))
+    throw std::runtime_error("Inconsistent sub-entity sizes");
+  t.vertices = vertices;
+
+  for (int d = 0; d <= tdim; ++d)
+  {
+    for (int e = t.entity_offsets[d]; e < t.entity_offsets[d + 1]; ++e)
+    {
+      if (d == 0)
+        t.types[e] = cell::type::point;
+      else if (d == 1)
+        t.types[e] = cell::type::interval;
+      else if (d == tdim)
+        t.types[e] = celltype;
+      else if (sizes[e] == 3)
+        t.types[e] = cell::type::triangle;
+      else if (sizes[e] == 4)
+        t.types[e] = cell::type::quadrilateral;
+      else
+        throw std::runtime_error("Unsupported sub-entity");
+    }
+  }
+
+  return t;
+}
+
+/// @private Check if every vertex of sub-entity `e1` is a vertex of
+/// sub-entity `e0`
+template <std::size_t NE, std::size_t NNZ>
+constexpr bool contains(const topology_table<NE, NNZ>& t, int e0, int e1)
+{
+  for (int i = t.offsets[e1]; i < t.offsets[e1 + 1]; ++i)
+  {
+    bool found = false;
+    for (int j = t.offsets[e0]; j < t.offsets[e0 + 1]; ++j)
+      found = found or t.vertices[i] == t.vertices[j];
+    if (!found)
+      return false;
+  }
+  return true;
+}
+
+/// @private Topological dimension of a sub-entity
+template <std::size_t NE, std::size_t NNZ>
+constexpr int entity_dim(const topology_table<NE, NNZ>& t, int e)
+{
+  int d = 0;
+  while (e >= t.entity_offsets[d + 1])
+    ++d;
+  return d;
+}
+
+/// @private Check if two sub-entities are connected, i.e. if one is a
+/// sub-entity of the other
+template <std::size_t NE, std::size_t NNZ>
+constexpr bool connected(const topology_table<NE, NNZ>& t, int e0, int e1)
+{
+  return entity_dim(t, e1) <= entity_dim(t, e0) ? contains(t, e0, e1)
+                                                : contains(t, e1, e0);
+}
+
+/// @private Number of entries in the connectivity table of a cell
+template <std::size_t NE, std::size_t NNZ>
+constexpr std::size_t connectivity_size(const topology_table<NE, NNZ>& t)
+{
+  std::size_t n = 0;
+  for (std::size_t e0 = 0; e0 < NE; ++e0)
+    for (std::size_t e1 = 0; e1 < NE; ++e1)
+      n += connected(t, e0, e1) ? 1 : 0;
+  return n;
+}
+
+/// @private Build the connectivity table of a reference cell from its
+/// topology table
+template <std::size_t NC, std::size_t NE, std::size_t NNZ>
+consteval connectivity_table<NE, NC>
+make_connectivity(const topology_table<NE, NNZ>& t)
+{
+  connectivity_table<NE, NC> c{};
+  int n = 0;
+  for (std::size_t e0 = 0; e0 < NE; ++e0)
+  {
+    for (int d = 0; d < 4; ++d)
+    {
+      c.offsets[4 * e0 + d] = n;
+      for (int e1 = t.entity_offsets[d]; e1 < t.entity_offsets[d + 1]; ++e1)
+        if (connected(t, e0, e1))
+          c.entities[n++] = e1 - t.entity_offsets[d];
+    }
+  }
+  c.offsets[4 * NE] = n;
+  return c;
+}
+
+/// @private
+inline constexpr auto point_topology
+    = make_topology(cell::type::point, 0, {1, 0, 0, 0}, std::array{1},
+                    std::array{0});
+
+/// @private
+inline constexpr auto interval_topology
+    = make_topology(cell::type::interval, 1, {2, 1, 0, 0},
+                    std::array{1, 1, 2}, std::array{0, 1, 0, 1});
+
+/// @private
+inline constexpr auto triangle_topology = make_topology(
+    cell::type::triangle, 2, {3, 3, 1, 0}, std::array{1, 1, 1, 2, 2, 2, 3},
+    std::array{0, 1, 2,             // Vertices
+               1, 2, 0, 2, 0, 1,    // Edges
+               0, 1, 2});           // Cell
+
+/// @private
+inline constexpr auto quadrilateral_topology = make_topology(
+    cell::type::quadrilateral, 2, {4, 4, 1, 0},
+    std::array{1, 1, 1, 1, 2, 2, 2, 2, 4},
+    std::array{0, 1, 2, 3,                // Vertices
+               0, 1, 0, 2, 1, 3, 2, 3,    // Edges
+               0, 1, 2, 3});              // Cell
+
+/// @private
+inline constexpr auto tetrahedron_topology = make_topology(
+    cell::type::tetrahedron, 3, {4, 6, 4, 1},
+    std::array{1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 4},
+    std::array{0, 1, 2, 3,                            // Vertices
+               2, 3, 1, 3, 1, 2, 0, 3, 0, 2, 0, 1,    // Edges
+               1, 2, 3, 0, 2, 3, 0, 1, 3, 0, 1, 2,    // Faces
+               0, 1, 2, 3});                          // Cell
+
+/// @private
+inline constexpr auto hexahedron_topology = make_topology(
+    cell::type::hexahedron, 3, {8, 12, 6, 1},
+    std::array{1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2,
+               2, 2, 2, 2, 2, 2, 4, 4, 4, 4, 4, 4, 8},
+    std::array{0, 1, 2, 3, 4, 5, 6, 7,                      // Vertices
+               0, 1, 0, 2, 0, 4, 1, 3, 1, 5, 2, 3,          // Edges
+               2, 6, 3, 7, 4, 5, 4, 6, 5, 7, 6, 7,          //
+               0, 1, 2, 3, 0, 1, 4, 5, 0, 2, 4, 6,          // Faces
+               1, 3, 5, 7, 2, 3, 6, 7, 4, 5, 6, 7,          //
+               0, 1, 2, 3, 4, 5, 6, 7});                    // Cell
+
+/// @private
+inline constexpr auto prism_topology = make_topology(
+    cell::type::prism, 3, {6, 9, 5, 1},
+    std::array{1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 4, 4, 4, 3, 6},
+    std::array{0, 1, 2, 3, 4, 5,                            // Vertices
+               0, 1, 0, 2, 0, 3, 1, 2, 1, 4, 2, 5, 3, 4,    // Edges
+               3, 5, 4, 5,                                  //
+               0, 1, 2, 0, 1, 3, 4, 0, 2, 3, 5,             // Faces
+               1, 2, 4, 5, 3, 4, 5,                         //
+               0, 1, 2, 3, 4, 5});                          // Cell
+
+/// @private
+inline constexpr auto pyramid_topology = make_topology(
+    cell::type::pyramid, 3, {5, 8, 5, 1},
+    std::array{1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 4, 3, 3, 3, 3, 5},
+    std::array{0, 1, 2, 3, 4,                               // Vertices
+               0, 1, 0, 2, 0, 4, 1, 3, 1, 4, 2, 3, 2, 4,    // Edges
+               3, 4,                                        //
+               0, 1, 2, 3, 0, 1, 4, 0, 2, 4, 1, 3, 4,       // Faces
+               2, 3, 4,                                     //
+               0, 1, 2, 3, 4});                             // Cell
+
+/// @private
+inline constexpr auto point_connectivity
+    = make_connectivity<connectivity_size(point_topology)>(point_topology);
+
+/// @private
+inline constexpr auto interval_connectivity
+    = make_connectivity<connectivity_size(interval_topology)>(
+        interval_topology);
+
+/// @private
+inline constexpr auto triangle_connectivity
+    = make_connectivity<connectivity_size(triangle_topology)>(
+        triangle_topology);
+
+/// @private
+inline constexpr auto quadrilateral_connectivity
+    = make_connectivity<connectivity_size(quadrilateral_topology)>(
+        quadrilateral_topology);
+
+/// @private
+inline constexpr auto tetrahedron_connectivity
+    = make_connectivity<connectivity_size(tetrahedron_topology)>(
+        tetrahedron_topology);
+
+/// @private
+inline constexpr auto hexahedron_connectivity
+    = make_connectivity<connectivity_size(hexahedron_topology)>(
+        hexahedron_topology);
+
+/// @private
+inline constexpr auto prism_connectivity
+    = make_connectivity<connectivity_size(prism_topology)>(prism_topology);
+
+/// @private
+inline constexpr auto pyramid_connectivity
+    = make_connectivity<connectivity_size(pyramid_topology)>(
+        pyramid_topology);
+
+/// @private
+template <std::floating_point T>
+inline constexpr std::array<T, 2> interval_geometry = {0.0, 1.0};
+
+/// @private
+template <std::floating_point T>
+inline constexpr std::array<T, 6> triangle_geometry
+    = {0.0, 0.0, 1.0, 0.0, 0.0, 1.0};
+
+/// @private
+template <std::floating_point T>
+inline constexpr std::array<T, 8> quadrilateral_geometry
+    = {0.0, 0.0, 1.0, 0.0, 0.0, 1.0, 1.0, 1.0};
+
+/// @private
+template <std::floating_point T>
+inline constexpr std::array<T, 12> tetrahedron_geometry
+    = {0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
+
+/// @private
+template <std::floating_point T>
+inline constexpr std::array<T, 24> hexahedron_geometry
+    = {0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 1.0, 1.0, 0.0,
+       0.0, 0.0, 1.0, 1.0, 0.0, 1.0, 0.0, 1.0, 1.0, 1.0, 1.0, 1.0};
+
+/// @private
+template <std::floating_point T>
+inline constexpr std::array<T, 18> prism_geometry
+    = {0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0,
+       0.0, 0.0, 1.0, 1.0, 0.0, 1.0, 0.0, 1.0, 1.0};
+
+/// @private
+template <std::floating_point T>
+inline constexpr std::array<T, 15> pyramid_geometry
+    = {0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0,
+       0.0, 1.0, 1.0, 0.0, 0.0, 0.0, 1.0};
+
+/// @private Call `f(topology, connectivity)` with the compile-time
+/// tables of a cell type
+template <typename Fn>
+constexpr auto visit_tables(cell::type celltype, Fn f)
+{
+  switch (celltype)
+  {
+  case cell::type::point:
+    return f(point_topology, point_connectivity);
+  case cell::type::interval:
+    return f(interval_topology, interval_connectivity);
+  case cell::type::triangle:
+    return f(triangle_topology, triangle_connectivity);
+  case cell::type::tetrahedron:
+    return f(tetrahedron_topology, tetrahedron_connectivity);
+  case cell::type::quadrilateral:
+    return f(quadrilateral_topology, quadrilateral_connectivity);
+  case cell::type::hexahedron:
+    return f(hexahedron_topology, hexahedron_connectivity);
+  case cell::type::prism:
+    return f(prism_topology, prism_connectivity);
+  case cell::type::pyramid:
+    return f(pyramid_topology, pyramid_connectivity);
+  default:
+    throw std::runtime_error("Unsupported cell type");
+  }
+}
+} // namespace impl
+
+/// @brief Get the topological dimension for a given cell type.
+/// @param celltype Cell type
+/// @return the topological dimension
+constexpr int topological_dimension(cell::type celltype)
+{
+  return impl::visit_tables(celltype,
+                            [](auto& t, auto&) { return t.tdim; });
+}
+
+/// @brief Number of sub-entities of a cell by topological dimension.
+/// @param celltype The cell::type
+/// @param dim Dimension of sub-entity
+/// @return The number of sub-entities of the given dimension
+constexpr int num_sub_entities(cell::type celltype, int dim)
+{
+  return impl::visit_tables(
+      celltype, [dim](auto& t, auto&)
+      { return t.entity_offsets[dim + 1] - t.entity_offsets[dim]; });
+}
+
+/// @brief Vertex coordinates of a reference cell, without allocation.
+/// @param celltype Cell type
+/// @return View of the vertex coordinates of the cell. The points are
+/// stored in row-major format and the shape is (nvertices, tdim). The
+/// view is empty for a point.
+template <std::floating_point T>
+constexpr std::span<const T> geometry_view(cell::type celltype)
+{
+  switch (celltype)
+  {
+  case cell::type::point:
+    return {};
+  case cell::type::interval:
+    return impl::interval_geometry<T>;
+  case cell::type::triangle:
+    return impl::triangle_geometry<T>;
+  case cell::type::tetrahedron:
+    return impl::tetrahedron_geometry<T>;
+  case cell::type::quadrilateral:
+    return impl::quadrilateral_geometry<T>;
+  case cell::type::hexahedron:
+    return impl::hexahedron_geometry<T>;
+  case cell::type::prism:
+    return impl::prism_geometry<T>;
+  case cell::type::pyramid:
+    return impl::pyramid_geometry<T>;
+  default:
+    throw std::runtime_error("Unsupported cell type");
+  }
+}
+
+/// @brief Vertices of the sub-entities of a given dimension, without
+/// allocation.
+/// @param celltype Cell type
+/// @param dim Dimension of the sub-entities
+/// @return View with one row per sub-entity listing its vertices
+constexpr csr_view topology_view(cell::type celltype, int dim)
+{
+  return impl::visit_tables(
+      celltype,
+      [dim](auto& t, auto&)
+      {
+        if (dim < 0 or dim > t.tdim)
+          throw std::runtime_error("Invalid dimension for sub-entity");
+        const std::span<const int> offsets(t.offsets);
+        return csr_view{
+            offsets.subspan(t.entity_offsets[dim],
+                            t.entity_offsets[dim + 1] - t.entity_offsets[dim]
+                                + 1),
+            t.vertices};
+      });
+}
+
+/// @brief Sub-entities connected to a sub-entity of a cell, without
+/// allocation.
+///
+/// Row `connected_dim` of the returned view lists the numbers of the
+/// entities of dimension `connected_dim` that are connected to the
+/// entity of dimension `dim` and number `index`. This is the same data
+/// as `sub_entity_connectivity(celltype)[dim][index]`.
+///
+/// @param celltype Cell type
+/// @param dim Dimension of the sub-entity
+/// @param index Local index of the sub-entity
+/// @return View with one row per dimension (0..tdim)
+constexpr csr_view sub_entity_connectivity_view(cell::type celltype, int dim,
+                                                int index)
+{
+  return impl::visit_tables(
+      celltype,
+      [dim, index](auto& t, auto& c)
+      {
+        if (dim < 0 or dim > t.tdim)
+          throw std::runtime_error("Invalid dimension for sub-entity");
+        if (index < 0
+            or index >= t.entity_offsets[dim + 1] - t.entity_offsets[dim])
+        {
+          throw std::runtime_error("Invalid entity index");
+        }
+        const std::span<const int> offsets(c.offsets);
+        return csr_view{
+            offsets.subspan(4 * (t.entity_offsets[dim] + index), t.tdim + 2),
+            c.entities};
+      });
+}
+
+/// @brief Types of the sub-entities of a given dimension, without
+/// allocation.
+/// @param celltype Cell type
+/// @param dim Dimension of the sub-entities
+/// @return The sub-entity types
+constexpr std::span<const cell::type> subentity_types_view(cell::type celltype,
+                                                           int dim)
+{
+  return impl::visit_tables(
+      celltype,
+      [dim](auto& t, auto&)
+      {
+        if (dim < 0 or dim > t.tdim)
+          throw std::runtime_error("Invalid dimension for sub-entity");
+        return std::span<const cell::type>(t.types).subspan(
+            t.entity_offsets[dim],
+            t.entity_offsets[dim + 1] - t.entity_offsets[dim]);
+      });
+}
+
+/// @brief Get the cell type of a sub-entity of given dimension and
+/// index.
+/// @param celltype Type of cell
+/// @param dim Topological dimension of sub-entity
+/// @param index Index of sub-entity
+/// @return cell type of sub-entity
+constexpr cell::type sub_entity_type(cell::type celltype, int dim, int index)
+{
+  const std::span<const cell::type> types
+      = subentity_types_view(celltype, dim);
+  if (index < 0 or index >= static_cast<int>(types.size()))
+    throw std::runtime_error("Invalid entity index");
+  return types[index];
+}
+
 /// Cell geometry
 /// @param celltype Cell Type
 /// @return (0) Vertex point data of the cell and (1) the shape of the
@@ -65,24 +559,6 @@ template <std::floating_point T>
 std::pair<std::vector<T>, std::array<std::size_t, 2>>
 sub_entity_geometry(cell::type celltype, int dim, int index);
 
-/// Number of sub-entities of a cell by topological dimension
-/// @param celltype The cell::type
-/// @param dim Dimension of sub-entity
-/// @return The number of sub-entities of the given dimension
-int num_sub_entities(cell::type celltype, int dim);
-
-/// Get the topological dimension for a given cell type
-/// @param celltype Cell type
-/// @return the topological dimension
-int topological_dimension(cell::type celltype);
-
-/// Get the cell type of a sub-entity of given dimension and index
-/// @param celltype Type of cell
-/// @param dim Topological dimension of sub-entity
-/// @param index Index of sub-entity
-/// @return cell type of sub-entity
-cell::type sub_entity_type(cell::type celltype, int dim, int index);
-
 /// Get the volume of a reference cell
 /// @param cell_type Type of cell
 /// @return The volume of the cell
@@ -0,0 +1,507 @@
+// Copyright (c) 2024 Basix contributors
+// FEniCS Project
+// SPDX-License-Identifier:    MIT
+
+#include "codegen.h"
+#include "cell.h"
+#include "static-element.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <type_traits>
+#include <vector>
+
+using namespace basix;
+
+namespace
+{
+//-----------------------------------------------------------------------------
+template <std::floating_point T>
+std::string scalar_name()
+{
+  if constexpr (std::is_same_v<T, float>)
+    return "float";
+  else
+    return "double";
+}
+//-----------------------------------------------------------------------------
+/// Write a floating point literal that can be parsed exactly
+template <std::floating_point T>
+std::string literal(T value)
+{
+  std::ostringstream s;
+  s.precision(std::numeric_limits<T>::max_digits10);
+  s << value;
+  std::string out = s.str();
+  if (out.find_first_of(".en") == std::string::npos)
+    out += ".0";
+  if constexpr (std::is_same_v<T, float>)
+    out += "f";
+  return out;
+}
+//-----------------------------------------------------------------------------
+/// Product of two square matrices stored row-major
+template <std::floating_point T>
+std::vector<T> matmul(const std::vector<T>& A, const std::vector<T>& B,
+                      std::size_t n)
+{
+  std::vector<T> C(n * n, 0);
+  for (std::size_t i = 0; i < n; ++i)
+    for (std::size_t k = 0; k < n; ++k)
+      for (std::size_t j = 0; j < n; ++j)
+        C[i * n + j] += A[i * n + k] * B[k * n + j];
+  return C;
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point T>
+std::vector<T> transpose(const std::vector<T>& A, std::size_t n)
+{
+  std::vector<T> AT(n * n);
+  for (std::size_t i = 0; i < n; ++i)
+    for (std::size_t j = 0; j < n; ++j)
+      AT[j * n + i] = A[i * n + j];
+  return AT;
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point T>
+std::vector<T> identity(std::size_t n)
+{
+  std::vector<T> I(n * n, 0);
+  for (std::size_t i = 0; i < n; ++i)
+    I[i * n + i] = 1;
+  return I;
+}
+//-----------------------------------------------------------------------------
+/// Matrix that a kernel applies to the DOFs of an entity, given the
+/// matrix A = R^r S^s that the DOF transformation applies to them
+/// (where R is the rotation and S is the reflection) and its inverse
+template <std::floating_point T>
+std::vector<T> kernel_matrix(codegen::transformation kind,
+                             const std::vector<T>& A,
+                             const std::vector<T>& Ainv, std::size_t n)
+{
+  switch (kind)
+  {
+  case codegen::transformation::pre_apply:
+  case codegen::transformation::post_apply_transpose:
+    return A;
+  case codegen::transformation::pre_apply_transpose:
+  case codegen::transformation::post_apply:
+    return transpose(A, n);
+  case codegen::transformation::pre_apply_inverse:
+  case codegen::transformation::post_apply_inverse_transpose:
+    return Ainv;
+  case codegen::transformation::pre_apply_inverse_transpose:
+  case codegen::transformation::post_apply_inverse:
+    return transpose(Ainv, n);
+  default:
+    throw std::runtime_error("Unsupported transformation");
+  }
+}
+//-----------------------------------------------------------------------------
+/// Write the code that applies the matrix M to the DOFs of an entity.
+/// Rows of M that are rows of the identity are skipped.
+template <std::floating_point T>
+void write_matrix(std::ostringstream& s, const std::vector<T>& M,
+                  const std::vector<int>& dofs, bool post, std::size_t ndofs,
+                  const std::string& scalar, const std::string& indent)
+{
+  constexpr T eps = 10 * std::numeric_limits<T>::epsilon();
+  const std::size_t n = dofs.size();
+
+  std::vector<bool> row_needed(n, false);
+  std::vector<bool> col_needed(n, false);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    for (std::size_t j = 0; j < n; ++j)
+    {
+      if (std::abs(M[i * n + j] - (i == j ? 1 : 0)) > eps)
+        row_needed[i] = true;
+    }
+    if (row_needed[i])
+    {
+      for (std::size_t j = 0; j < n; ++j)
+        if (std::abs(M[i * n + j]) > eps)
+          col_needed[j] = true;
+    }
+  }
+  if (std::ranges::find(row_needed, true) == row_needed.end())
+    return;
+
+  auto entry = [post, ndofs](int dof)
+  {
+    return post ? "data[" + std::to_string(ndofs) + " * b + "
+                      + std::to_string(dof) + "]"
+                : "data[block_size * " + std::to_string(dof) + " + b]";
+  };
+
+  s << indent << "for (int b = 0; b < block_size; ++b)\n";
+  s << indent << "{\n";
+  for (std::size_t j = 0; j < n; ++j)
+  {
+    if (col_needed[j])
+    {
+      s << indent << "  const " << scalar << " w" << j << " = "
+        << entry(dofs[j]) << ";\n";
+    }
+  }
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    if (!row_needed[i])
+      continue;
+    std::string expr;
+    for (std::size_t j = 0; j < n; ++j)
+    {
+      const T a = M[i * n + j];
+      if (std::abs(a) <= eps)
+        continue;
+      const std::string w = "w" + std::to_string(j);
+      bool negative = a < 0;
+      std::string term;
+      if (std::abs(std::abs(a) - 1) <= eps)
+        term = w;
+      else
+        term = literal<T>(std::abs(a)) + " * " + w;
+      if (expr.empty())
+        expr = negative ? "-" + term : term;
+      else
+        expr += (negative ? " - " : " + ") + term;
+    }
+    s << indent << "  " << entry(dofs[i]) << " = "
+      << (expr.empty() ? "0" : expr) << ";\n";
+  }
+  s << indent << "}\n";
+}
+//-----------------------------------------------------------------------------
+/// Write the entries of an array as a brace-enclosed list
+template <typename U>
+void write_list(std::ostringstream& s, const std::vector<U>& v)
+{
+  s << "{";
+  for (std::size_t i = 0; i < v.size(); ++i)
+  {
+    if (i > 0)
+      s << (i % 3 == 0 ? ",\n     " : ", ");
+    if constexpr (std::is_floating_point_v<U>)
+      s << literal(v[i]);
+    else
+      s << v[i];
+  }
+  s << "}";
+}
+//-----------------------------------------------------------------------------
+std::string cell_name(cell::type celltype)
+{
+  switch (celltype)
+  {
+  case cell::type::interval:
+    return "interval";
+  case cell::type::triangle:
+    return "triangle";
+  case cell::type::tetrahedron:
+    return "tetrahedron";
+  case cell::type::quadrilateral:
+    return "quadrilateral";
+  case cell::type::hexahedron:
+    return "hexahedron";
+  case cell::type::prism:
+    return "prism";
+  case cell::type::pyramid:
+    return "pyramid";
+  default:
+    throw std::runtime_error("Unsupported cell type");
+  }
+}
+//-----------------------------------------------------------------------------
+std::string family_name(element::family family)
+{
+  switch (family)
+  {
+  case element::family::P:
+    return "P";
+  case element::family::RT:
+    return "RT";
+  case element::family::N1E:
+    return "N1E";
+  default:
+    throw std::runtime_error("Family not supported by StaticElement");
+  }
+}
+//-----------------------------------------------------------------------------
+std::string variant_name(element::lagrange_variant variant)
+{
+  switch (variant)
+  {
+  case element::lagrange_variant::unset:
+    return "unset";
+  case element::lagrange_variant::equispaced:
+    return "equispaced";
+  case element::lagrange_variant::gll_warped:
+    return "gll_warped";
+  case element::lagrange_variant::gll_isaac:
+    return "gll_isaac";
+  case element::lagrange_variant::gll_centroid:
+    return "gll_centroid";
+  case element::lagrange_variant::chebyshev_warped:
+    return "chebyshev_warped";
+  case element::lagrange_variant::chebyshev_isaac:
+    return "chebyshev_isaac";
+  case element::lagrange_variant::chebyshev_centroid:
+    return "chebyshev_centroid";
+  case element::lagrange_variant::gl_warped:
+    return "gl_warped";
+  case element::lagrange_variant::gl_isaac:
+    return "gl_isaac";
+  case element::lagrange_variant::gl_centroid:
+    return "gl_centroid";
+  case element::lagrange_variant::legendre:
+    return "legendre";
+  case element::lagrange_variant::bernstein:
+    return "bernstein";
+  default:
+    throw std::runtime_error("Unsupported Lagrange variant");
+  }
+}
+//-----------------------------------------------------------------------------
+} // namespace
+
+//-----------------------------------------------------------------------------
+std::string codegen::preamble(language lang)
+{
+  switch (lang)
+  {
+  case language::C:
+    return "#include <stdint.h>\n";
+  case language::CPP:
+    return "#include <cstdint>\n";
+  default:
+    throw std::runtime_error("Unsupported language");
+  }
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point T>
+std::string codegen::tabulate(const FiniteElement<T>& element, int nd,
+                              impl::mdspan_t<const T, 2> x,
+                              const std::string& name, language lang)
+{
+  const auto [tab, shape] = element.tabulate(nd, x);
+
+  std::ostringstream s;
+  s << "// Basis functions tabulated at " << shape[1]
+    << " points, with derivatives up to order " << nd << ".\n";
+  s << "// Shape is (derivative, point, DOF, value component).\n";
+  if (lang == language::C)
+    s << "static const " << scalar_name<T>() << " " << name;
+  else
+    s << "constexpr " << scalar_name<T>() << " " << name;
+  for (std::size_t i : shape)
+    s << "[" << i << "]";
+  s << "\n    = {";
+
+  std::size_t k = 0;
+  for (std::size_t p = 0; p < shape[0]; ++p)
+  {
+    s << (p == 0 ? "{" : ",\n       {");
+    for (std::size_t pt = 0; pt < shape[1]; ++pt)
+    {
+      s << (pt == 0 ? "{" : ",\n        {");
+      for (std::size_t i = 0; i < shape[2]; ++i)
+      {
+        s << (i == 0 ? "{" : ", {");
+        for (std::size_t j = 0; j < shape[3]; ++j)
+          s << (j == 0 ? "" : ", ") << literal(tab[k++]);
+        s << "}";
+      }
+      s << "}";
+    }
+    s << "}";
+  }
+  s << "};\n";
+
+  return s.str();
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point T>
+std::string codegen::dof_transformation(const FiniteElement<T>& element,
+                                        transformation kind,
+                                        const std::string& name, language lang)
+{
+  const bool post = static_cast<int>(kind) >= 4;
+  const std::string scalar = lang == language::C ? scalar_name<T>() : "T";
+
+  std::ostringstream s;
+  if (lang == language::C)
+  {
+    s << "static inline void " << name << "(" << scalar
+      << "* restrict data, int block_size, uint32_t cell_info)\n";
+  }
+  else
+  {
+    s << "template <typename T>\n";
+    s << "void " << name
+      << "(T* data, int block_size, std::uint32_t cell_info)\n";
+  }
+  s << "{\n";
+
+  const cell::type celltype = element.cell_type();
+  const int tdim = cell::topological_dimension(celltype);
+  if (element.dof_transformations_are_identity() or tdim < 2)
+  {
+    s << "  // The DOF transformations of this element are identities\n";
+    s << "  (void)data;\n";
+    s << "  (void)block_size;\n";
+    s << "  (void)cell_info;\n";
+    s << "}\n";
+    return s.str();
+  }
+
+  const std::size_t ndofs = element.dim();
+  const std::vector<std::vector<std::vector<int>>>& edofs
+      = element.entity_dofs();
+  const auto& etrans = element.entity_transformations();
+
+  // This assumes 3 bits are used per face
+  const int nfaces = tdim == 3 ? cell::num_sub_entities(celltype, 2) : 0;
+  const int face_start = 3 * nfaces;
+
+  // Edges
+  {
+    const auto& [M, mshape] = etrans.at(cell::type::interval);
+    const std::size_t n = mshape[1];
+    if (n > 0)
+    {
+      const std::vector<T> S(M.begin(), M.begin() + n * n);
+      const std::vector<T> K = kernel_matrix(kind, S, S, n);
+      for (int e = 0; e < cell::num_sub_entities(celltype, 1); ++e)
+      {
+        std::ostringstream block;
+        write_matrix(block, K, edofs[1][e], post, ndofs, scalar, "    ");
+        if (block.str().empty())
+          continue;
+        s << "  // Reverse edge " << e << "\n";
+        s << "  if (cell_info >> " << face_start + e << " & 1)\n";
+        s << "  {\n" << block.str() << "  }\n";
+      }
+    }
+  }
+
+  // Faces
+  for (int f = 0; f < nfaces; ++f)
+  {
+    const cell::type ftype = cell::sub_entity_type(celltype, 2, f);
+    const auto& [M, mshape] = etrans.at(ftype);
+    const std::size_t n = mshape[1];
+    if (n == 0)
+      continue;
+
+    const std::vector<T> R(M.begin(), M.begin() + n * n);
+    const std::vector<T> S(M.begin() + n * n, M.begin() + 2 * n * n);
+
+    // For a triangular face R^3 = I, and for a quadrilateral face
+    // R^4 = I
+    std::vector<T> Rinv = ftype == cell::type::triangle
+                              ? matmul(R, R, n)
+                              : matmul(R, matmul(R, R, n), n);
+
+    std::ostringstream cases;
+    for (int pattern = 1; pattern < 8; ++pattern)
+    {
+      const bool reflect = pattern & 1;
+      const int rotations = pattern >> 1;
+
+      // A = R^r S^s and A^{-1} = S^s R^{-r}
+      std::vector<T> A = reflect ? S : identity<T>(n);
+      std::vector<T> Ainv = identity<T>(n);
+      for (int r = 0; r < rotations; ++r)
+      {
+        A = matmul(R, A, n);
+        Ainv = matmul(Rinv, Ainv, n);
+      }
+      if (reflect)
+        Ainv = matmul(S, Ainv, n);
+
+      std::ostringstream block;
+      write_matrix(block, kernel_matrix(kind, A, Ainv, n), edofs[2][f], post,
+                   ndofs, scalar, "    ");
+      if (block.str().empty())
+        continue;
+      cases << "  case " << pattern << ": // " << rotations << " rotation"
+            << (rotations == 1 ? "" : "s")
+            << (reflect ? " and a reflection" : "") << "\n";
+      cases << "  {\n" << block.str() << "    break;\n  }\n";
+    }
+
+    if (!cases.str().empty())
+    {
+      s << "  // Rotate and reflect face " << f << "\n";
+      s << "  switch (cell_info >> " << 3 * f << " & 7)\n";
+      s << "  {\n" << cases.str() << "  default:\n    break;\n  }\n";
+    }
+  }
+
+  s << "}\n";
+  return s.str();
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point T>
+std::string codegen::static_element_tables(const FiniteElement<T>& element,
+                                           const std::string& name)
+{
+  const impl::static_element_data<T> data
+      = impl::compute_static_element_data(element);
+
+  std::ostringstream s;
+  s << "// Tables of a StaticElement, generated from a runtime element.\n";
+  s << "constexpr basix::StaticElement<\n    basix::cell::type::"
+    << cell_name(element.cell_type()) << ", basix::element::family::"
+    << family_name(element.family()) << ", "
+    << element.embedded_superdegree()
+    << ",\n    basix::element::lagrange_variant::"
+    << variant_name(element.lagrange_variant()) << ", " << scalar_name<T>()
+    << ">::tables\n    " << name << " = {";
+  write_list(s, data.coeffs);
+  s << ",\n    ";
+  write_list(s, data.entity_dofs_offsets);
+  s << ",\n    ";
+  write_list(s, data.entity_dofs);
+  s << ",\n    ";
+  write_list(s, std::vector<int>(data.entity_size.begin(),
+                                 data.entity_size.end()));
+  s << ",\n    ";
+  write_list(s, data.edge_reflection);
+  s << ",\n    ";
+  write_list(s, data.triangle);
+  s << ",\n    ";
+  write_list(s, data.quadrilateral);
+  s << ",\n    " << (data.transformations_are_identity ? "true" : "false")
+    << "};\n";
+
+  return s.str();
+}
+//-----------------------------------------------------------------------------
+
+/// @cond
+// Explicit instantiation for double and float
+template std::string codegen::tabulate(const FiniteElement<float>&, int,
+                                       impl::mdspan_t<const float, 2>,
+                                       const std::string&, language);
+template std::string codegen::tabulate(const FiniteElement<double>&, int,
+                                       impl::mdspan_t<const double, 2>,
+                                       const std::string&, language);
+
+template std::string codegen::dof_transformation(const FiniteElement<float>&,
+                                                 transformation,
+                                                 const std::string&, language);
+template std::string codegen::dof_transformation(const FiniteElement<double>&,
+                                                 transformation,
+                                                 const std::string&, language);
+
+template std::string
+codegen::static_element_tables(const FiniteElement<float>&,
+                               const std::string&);
+template std::string
+codegen::static_element_tables(const FiniteElement<double>&,
+                               const std::string&);
+/// @endcond
+//-----------------------------------------------------------------------------
@@ -0,0 +1,103 @@
+// Copyright (c) 2024 Basix contributors
+// FEniCS Project
+// SPDX-License-Identifier:    MIT
+
+#pragma once
+
+#include "finite-element.h"
+#include "mdspan.hpp"
+#include <concepts>
+#include <string>
+
+/// Generation of C and C++ code for finite elements
+
+/// The functions in this namespace emit straight-line code that can be
+/// inlined into generated kernels, such as those created by form
+/// compilers. The generated code has no dependency on Basix.
+namespace basix::codegen
+{
+/// Language of the generated code
+enum class language
+{
+  C = 0,
+  CPP = 1,
+};
+
+/// DOF transformation kernel. The names match the corresponding
+/// FiniteElement member functions.
+enum class transformation
+{
+  pre_apply = 0,
+  pre_apply_transpose = 1,
+  pre_apply_inverse = 2,
+  pre_apply_inverse_transpose = 3,
+  post_apply = 4,
+  post_apply_transpose = 5,
+  post_apply_inverse = 6,
+  post_apply_inverse_transpose = 7,
+};
+
+/// @brief Lines that the generated code needs to be preceded by.
+/// @param[in] lang The language
+/// @return The `#include` lines
+std::string preamble(language lang);
+
+/// @brief Generate a table of the basis functions of an element
+/// tabulated at a fixed set of points.
+///
+/// The table is a static array with shape (number of derivatives,
+/// number of points, number of DOFs, value size), with the same layout
+/// as the output of FiniteElement::tabulate.
+///
+/// @param[in] element The element
+/// @param[in] nd The order of derivatives, up to and including, to
+/// compute. Use 0 for the basis functions only.
+/// @param[in] x The points at which to compute the basis functions. The
+/// shape of x is (number of points, geometric dimension).
+/// @param[in] name The name of the array
+/// @param[in] lang The language of the generated code
+/// @return The generated code
+template <std::floating_point T>
+std::string tabulate(const FiniteElement<T>& element, int nd,
+                     impl::mdspan_t<const T, 2> x, const std::string& name,
+                     language lang = language::C);
+
+/// @brief Generate a DOF transformation kernel for an element.
+///
+/// The kernel has the signature `void name(T* data, int block_size,
+/// uint32_t cell_info)` and has the same effect as the corresponding
+/// FiniteElement member function. In C, `T` is the scalar type of the
+/// element. In C++, the kernel is a function template over the type of
+/// the data.
+///
+/// All transformation matrices are written out explicitly. A branch is
+/// generated for each edge and for each of the reflection and rotation
+/// patterns of each face that `cell_info` can encode, so the kernel
+/// contains no loops over DOFs and no lookups of transformation data.
+///
+/// @param[in] element The element
+/// @param[in] kind The transformation to generate
+/// @param[in] name The name of the function
+/// @param[in] lang The language of the generated code
+/// @return The generated code
+template <std::floating_point T>
+std::string dof_transformation(const FiniteElement<T>& element,
+                               transformation kind, const std::string& name,
+                               language lang = language::C);
+
+/// @brief Generate the tables of a StaticElement.
+///
+/// The generated code is a `constexpr` initialiser of
+/// StaticElement::tables, which can be passed to the StaticElement
+/// constructor in a `constexpr` context. Unlike the other generated
+/// code, it must be compiled with `basix/static-element.h` included.
+///
+/// @param[in] element The element. This must be a Lagrange (P),
+/// Raviart-Thomas (RT) or Nédélec first kind (N1E) element.
+/// @param[in] name The name of the variable
+/// @return The generated C++ code
+template <std::floating_point T>
+std::string static_element_tables(const FiniteElement<T>& element,
+                                  const std::string& name);
+
+} // namespace basix::codegen
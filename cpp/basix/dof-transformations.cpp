@@ -38,7 +38,8 @@ namespace
 int find_first_subentity(cell::type cell_type, cell::type entity_type)
 {
   const int edim = cell::topological_dimension(entity_type);
-  std::vector<cell::type> entities = cell::subentity_types(cell_type)[edim];
+  std::span<const cell::type> entities
+      = cell::subentity_types_view(cell_type, edim);
   if (auto it = std::find(entities.begin(), entities.end(), entity_type);
       it != entities.end())
   {
@@ -58,4 +58,21 @@ enum class family
   Hermite = 12,
   iso = 13,
 };
+
+/// Operators that can be applied to the basis functions of vector- and
+/// matrix-valued elements by FiniteElement::tabulate_operator
+enum class differential_operator
+{
+  /// The divergence of a vector-valued function, or the row-wise
+  /// divergence of a matrix-valued function
+  divergence = 0,
+  /// The curl of a vector-valued function. In 2D, this is the scalar
+  /// curl `du_1/dx - du_0/dy`
+  curl = 1,
+  /// The symmetric part of the gradient of a vector-valued function,
+  /// stored as a full (tdim, tdim) matrix
+  symmetric_gradient = 2,
+  /// The trace of a matrix-valued function
+  trace = 3,
+};
 } // namespace basix::element
@@ -17,11 +17,18 @@
 #include "e-serendipity.h"
 #include "math.h"
 #include "polyset.h"
+#include "quadrature.h"
+#include "stats.h"
 #include <basix/version.h>
+#include <bit>
+#include <chrono>
 #include <cmath>
 #include <concepts>
+#include <exception>
 #include <limits>
 #include <numeric>
+#include <thread>
+#include <type_traits>
 
 #define str_macro(X) #X
 #define str(X) str_macro(X)
@@ -40,25 +47,6 @@ using mdarray_t
 
 namespace
 {
-//----------------------------------------------------------------------------
-constexpr int compute_value_size(maps::type map_type, int dim)
-{
-  switch (map_type)
-  {
-  case maps::type::identity:
-    return 1;
-  case maps::type::covariantPiola:
-    return dim;
-  case maps::type::contravariantPiola:
-    return dim;
-  case maps::type::doubleCovariantPiola:
-    return dim * dim;
-  case maps::type::doubleContravariantPiola:
-    return dim * dim;
-  default:
-    throw std::runtime_error("Mapping not yet implemented");
-  }
-}
 //-----------------------------------------------------------------------------
 constexpr int num_transformations(cell::type cell_type)
 {
@@ -182,6 +170,344 @@ std::pair<std::vector<T>, std::array<std::size_t, 2>> compute_dual_matrix(
   return {std::move(C), shape};
 }
 //-----------------------------------------------------------------------------
+/// 64-bit FNV-1a hash. Values are fed in one byte at a time, least
+/// significant byte first, so the result does not depend on the
+/// endianness of the platform.
+class fnv1a
+{
+public:
+  void add(std::uint64_t v)
+  {
+    for (int i = 0; i < 8; ++i)
+    {
+      _hash ^= (v >> (8 * i)) & 0xff;
+      _hash *= 1099511628211ull;
+    }
+  }
+
+  template <std::floating_point T>
+  void add(T v)
+  {
+    // Floats are widened to double (which is exact), and -0.0 is hashed
+    // as 0.0 as the two compare equal
+    add(std::bit_cast<std::uint64_t>(v == 0 ? 0.0 : static_cast<double>(v)));
+  }
+
+  std::uint64_t value() const { return _hash; }
+
+private:
+  std::uint64_t _hash = 14695981039346656037ull;
+};
+//-----------------------------------------------------------------------------
+template <typename T>
+concept trivial_value = std::is_arithmetic_v<T> or std::is_enum_v<T>;
+
+template <typename T>
+concept tuple_like = requires { std::tuple_size<T>::value; };
+
+template <typename T>
+concept map_like = requires { typename T::mapped_type; };
+//-----------------------------------------------------------------------------
+/// Archive that appends values to a byte array. Arithmetic values and
+/// enums are copied as they are, containers are written as their size
+/// followed by their entries, and pairs, tuples and arrays are written
+/// entry by entry.
+class writer
+{
+public:
+  template <typename... T>
+  void operator()(const T&... v)
+  {
+    (write(v), ...);
+  }
+
+  std::vector<std::uint8_t> data;
+
+private:
+  void write_bytes(const void* p, std::size_t n)
+  {
+    auto b = static_cast<const std::uint8_t*>(p);
+    data.insert(data.end(), b, b + n);
+  }
+
+  template <typename T>
+  void write(const T& v)
+  {
+    if constexpr (trivial_value<T>)
+      write_bytes(&v, sizeof(T));
+    else if constexpr (tuple_like<T>)
+      std::apply([this](const auto&... x) { (write(x), ...); }, v);
+    else if constexpr (map_like<T>)
+    {
+      write(static_cast<std::uint64_t>(v.size()));
+      for (auto& [key, value] : v)
+        (*this)(key, value);
+    }
+    else
+    {
+      write(static_cast<std::uint64_t>(v.size()));
+      if constexpr (trivial_value<typename T::value_type>)
+        write_bytes(v.data(), v.size() * sizeof(typename T::value_type));
+      else
+      {
+        for (auto& x : v)
+          write(x);
+      }
+    }
+  }
+};
+//-----------------------------------------------------------------------------
+/// Archive that reads values written by a writer from a byte array
+class reader
+{
+public:
+  explicit reader(std::span<const std::uint8_t> data) : _data(data) {}
+
+  template <typename... T>
+  void operator()(T&... v)
+  {
+    (read(v), ...);
+  }
+
+  /// Check if all the data has been read
+  bool at_end() const { return _pos == _data.size(); }
+
+private:
+  void read_bytes(void* p, std::size_t n)
+  {
+    if (n > _data.size() - _pos)
+      throw std::runtime_error("Serialized element data is truncated.");
+    std::copy_n(_data.data() + _pos, n, static_cast<std::uint8_t*>(p));
+    _pos += n;
+  }
+
+  std::size_t read_size()
+  {
+    std::uint64_t n;
+    read_bytes(&n, sizeof(n));
+    // Each entry of a container takes at least one byte
+    if (n > _data.size() - _pos)
+      throw std::runtime_error("Serialized element data is truncated.");
+    return n;
+  }
+
+  template <typename T>
+  void read(T& v)
+  {
+    if constexpr (trivial_value<T>)
+      read_bytes(&v, sizeof(T));
+    else if constexpr (tuple_like<T>)
+      std::apply([this](auto&... x) { (read(x), ...); }, v);
+    else if constexpr (map_like<T>)
+    {
+      v.clear();
+      const std::size_t n = read_size();
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        typename T::key_type key;
+        typename T::mapped_type value;
+        (*this)(key, value);
+        v.emplace(std::move(key), std::move(value));
+      }
+    }
+    else
+    {
+      const std::size_t n = read_size();
+      using V = typename T::value_type;
+      if constexpr (trivial_value<V>)
+      {
+        if (n > (_data.size() - _pos) / sizeof(V))
+          throw std::runtime_error("Serialized element data is truncated.");
+        v.resize(n);
+        read_bytes(v.data(), n * sizeof(V));
+      }
+      else
+      {
+        v.resize(n);
+        for (auto& x : v)
+          read(x);
+      }
+    }
+  }
+
+  std::span<const std::uint8_t> _data;
+  std::size_t _pos = 0;
+};
+//-----------------------------------------------------------------------------
+/// Number of bytes of heap memory held by a value. The memory held by a
+/// container is its capacity plus the memory held by its entries. Map
+/// entries are counted as the size of a key-value pair, ignoring the
+/// overhead of the nodes of the map.
+template <typename T>
+std::size_t heap_bytes(const T& v)
+{
+  if constexpr (trivial_value<T>)
+    return 0;
+  else if constexpr (tuple_like<T>)
+  {
+    return std::apply([](const auto&... x)
+                      { return (std::size_t(0) + ... + heap_bytes(x)); },
+                      v);
+  }
+  else if constexpr (map_like<T>)
+  {
+    std::size_t n = 0;
+    for (auto& [key, value] : v)
+    {
+      n += sizeof(typename T::value_type) + heap_bytes(key)
+           + heap_bytes(value);
+    }
+    return n;
+  }
+  else
+  {
+    std::size_t n = v.capacity() * sizeof(typename T::value_type);
+    if constexpr (!trivial_value<typename T::value_type>)
+    {
+      for (auto& x : v)
+        n += heap_bytes(x);
+    }
+    return n;
+  }
+}
+//-----------------------------------------------------------------------------
+/// Compute the expansion coefficients of the first derivatives of the
+/// shape functions. The derivatives of the orthonormal polyset are
+/// projected onto the polyset using a quadrature rule, so this must only
+/// be used when the derivatives are in the span of the polyset.
+/// @return The coefficients with shape (tdim, num dofs, coeffs.extent(1))
+template <std::floating_point T>
+std::pair<std::vector<T>, std::array<std::size_t, 3>>
+compute_derivative_coefficients(cell::type cell_type, polyset::type poly_type,
+                                int degree, mdspan_t<const T, 2> coeffs)
+{
+  const std::size_t tdim = cell::topological_dimension(cell_type);
+  const std::size_t psize = polyset::dim(cell_type, poly_type, degree);
+  const std::size_t vs = coeffs.extent(1) / psize;
+
+  const auto [pts, wts] = quadrature::make_quadrature<T>(
+      quadrature::type::Default, cell_type, poly_type, 2 * degree);
+  const std::size_t npts = wts.size();
+  const auto [Pb, Pshape] = polyset::tabulate(
+      cell_type, poly_type, degree, 1,
+      mdspan_t<const T, 2>(pts.data(), npts, tdim));
+  mdspan_t<const T, 3> P(Pb.data(), Pshape);
+
+  // Weighted values of the polyset, shape (num points, psize)
+  std::vector<T> Pw_b(npts * psize);
+  mdspan_t<T, 2> Pw(Pw_b.data(), npts, psize);
+  for (std::size_t q = 0; q < npts; ++q)
+    for (std::size_t k = 0; k < psize; ++k)
+      Pw(q, k) = wts[q] * P(0, k, q);
+
+  std::array<std::size_t, 3> shape = {tdim, coeffs.extent(0), coeffs.extent(1)};
+  std::vector<T> dcoeffs_b(shape[0] * shape[1] * shape[2]);
+  mdspan_t<T, 3> dcoeffs(dcoeffs_b.data(), shape);
+  std::vector<T> D_b(psize * psize);
+  mdspan_t<T, 2> D(D_b.data(), psize, psize);
+  std::vector<T> C_b(coeffs.extent(0) * psize);
+  mdspan_t<T, 2> C(C_b.data(), coeffs.extent(0), psize);
+  std::vector<T> result_b(coeffs.extent(0) * psize);
+  mdspan_t<T, 2> result(result_b.data(), coeffs.extent(0), psize);
+  for (std::size_t d = 0; d < tdim; ++d)
+  {
+    // D(j, k) is the coefficient of polynomial k in the derivative of
+    // polynomial j
+    math::dot(mdspan_t<const T, 2>(Pb.data() + (d + 1) * psize * npts, psize,
+                                   npts),
+              Pw, D);
+    for (std::size_t c = 0; c < vs; ++c)
+    {
+      for (std::size_t i = 0; i < C.extent(0); ++i)
+        for (std::size_t j = 0; j < psize; ++j)
+          C(i, j) = coeffs(i, c * psize + j);
+      math::dot(C, D, result);
+      for (std::size_t i = 0; i < C.extent(0); ++i)
+        for (std::size_t k = 0; k < psize; ++k)
+          dcoeffs(d, i, c * psize + k) = result(i, k);
+    }
+  }
+
+  return {std::move(dcoeffs_b), shape};
+}
+//-----------------------------------------------------------------------------
+/// A term `weight * D u_component` of a component of an operator, where
+/// D is the value (deriv = 0) or the derivative in direction deriv - 1
+struct operator_term
+{
+  std::size_t component;
+  std::size_t deriv;
+  double weight;
+};
+//-----------------------------------------------------------------------------
+/// The terms of each component of an operator applied to a function
+/// with the given value shape
+std::vector<std::vector<operator_term>>
+operator_terms(element::differential_operator op, std::size_t tdim,
+               const std::vector<std::size_t>& value_shape)
+{
+  const bool vector = value_shape.size() == 1 and value_shape[0] == tdim;
+  const bool matrix = value_shape.size() == 2 and value_shape[0] == tdim
+                      and value_shape[1] == tdim;
+
+  std::vector<std::vector<operator_term>> terms;
+  switch (op)
+  {
+  case element::differential_operator::divergence:
+    if (vector)
+    {
+      auto& t = terms.emplace_back();
+      for (std::size_t i = 0; i < tdim; ++i)
+        t.push_back({i, i + 1, 1.0});
+    }
+    else if (matrix)
+    {
+      for (std::size_t i = 0; i < tdim; ++i)
+      {
+        auto& t = terms.emplace_back();
+        for (std::size_t j = 0; j < tdim; ++j)
+          t.push_back({i * tdim + j, j + 1, 1.0});
+      }
+    }
+    break;
+  case element::differential_operator::curl:
+    if (vector and tdim == 2)
+      terms = {{{1, 1, 1.0}, {0, 2, -1.0}}};
+    else if (vector and tdim == 3)
+    {
+      terms = {{{2, 2, 1.0}, {1, 3, -1.0}},
+               {{0, 3, 1.0}, {2, 1, -1.0}},
+               {{1, 1, 1.0}, {0, 2, -1.0}}};
+    }
+    break;
+  case element::differential_operator::symmetric_gradient:
+    if (vector)
+    {
+      for (std::size_t i = 0; i < tdim; ++i)
+        for (std::size_t j = 0; j < tdim; ++j)
+          terms.push_back({{i, j + 1, 0.5}, {j, i + 1, 0.5}});
+    }
+    break;
+  case element::differential_operator::trace:
+    if (matrix)
+    {
+      auto& t = terms.emplace_back();
+      for (std::size_t i = 0; i < tdim; ++i)
+        t.push_back({i * tdim + i, 0, 1.0});
+    }
+    break;
+  default:
+    throw std::runtime_error("Unknown operator");
+  }
+
+  if (terms.empty())
+  {
+    throw std::runtime_error(
+        "Operator is not defined for the value shape of this element.");
+  }
+  return terms;
+}
+//-----------------------------------------------------------------------------
 } // namespace
 //-----------------------------------------------------------------------------
 template <std::floating_point T>
@@ -557,6 +883,22 @@ FiniteElement<F>::FiniteElement(
       _discontinuous(discontinuous), _tensor_factors(tensor_factors),
       _dof_ordering(dof_ordering)
 {
+  // Record the wall time since the end of the previous stage, if
+  // statistics are collected
+  const bool record_times = stats::enabled();
+  auto t0 = std::chrono::steady_clock::time_point();
+  if (record_times)
+    t0 = std::chrono::steady_clock::now();
+  auto end_stage = [this, record_times, &t0](const std::string& name)
+  {
+    if (!record_times)
+      return;
+    auto t1 = std::chrono::steady_clock::now();
+    _construction_times.emplace_back(
+        name, std::chrono::duration<double>(t1 - t0).count());
+    t0 = t1;
+  };
+
   // Check that discontinuous elements only have DOFs on interior
   if (discontinuous)
   {
@@ -581,6 +923,7 @@ FiniteElement<F>::FiniteElement(
   _dual_matrix
       = compute_dual_matrix<F>(cell_type, poly_type, wcoeffs, x, M,
                                embedded_superdegree, interpolation_nderivs);
+  end_stage("dual_matrix");
 
   // Copy x
   for (std::size_t i = 0; i < x.size(); ++i)
@@ -646,10 +989,22 @@ FiniteElement<F>::FiniteElement(
         "Number of entity dofs does not match total number of dofs");
   }
 
+  // The derivatives of the shape functions are used to apply operators
+  // to vector- and matrix-valued elements. They are computed when they
+  // are first needed.
+  if (!value_shape.empty() and _cell_tdim > 0
+      and poly_type == polyset::type::standard
+      and cell_type != cell::type::pyramid)
+  {
+    _dcoeffs = std::make_shared<derivative_coefficients_t>();
+  }
+  end_stage("coefficients");
+
   _entity_transformations = doftransforms::compute_entity_transformations(
       cell_type, x, M,
       mdspan_t<const F, 2>(_coeffs.first.data(), _coeffs.second),
       embedded_superdegree, value_size, map_type, poly_type);
+  end_stage("entity_transformations");
 
   const std::size_t nderivs
       = polyset::nderivs(cell_type, interpolation_nderivs);
@@ -677,6 +1032,7 @@ FiniteElement<F>::FiniteElement(
       point_offset += Me.extent(2);
     }
   }
+  end_stage("interpolation_matrix");
 
   // Compute number of dofs for each cell entity (computed from
   // interpolation data)
@@ -726,8 +1082,6 @@ FiniteElement<F>::FiniteElement(
     _points = {new_points, _points.second};
   }
 
-  const std::vector<std::vector<std::vector<std::vector<int>>>> connectivity
-      = cell::sub_entity_connectivity(cell_type);
   for (std::size_t d = 0; d < _cell_tdim + 1; ++d)
   {
     auto& edofs_d
@@ -735,9 +1089,11 @@ FiniteElement<F>::FiniteElement(
     for (std::size_t e = 0; e < _e_closure_dofs[d].size(); ++e)
     {
       auto& closure_dofs = edofs_d[e];
+      const cell::csr_view connectivity
+          = cell::sub_entity_connectivity_view(cell_type, d, e);
       for (std::size_t dim = 0; dim <= d; ++dim)
       {
-        for (int c : connectivity[d][e][dim])
+        for (int c : connectivity[dim])
         {
           closure_dofs.insert(closure_dofs.end(), _edofs[dim][c].begin(),
                               _edofs[dim][c].end());
@@ -747,6 +1103,7 @@ FiniteElement<F>::FiniteElement(
       std::sort(_e_closure_dofs[d][e].begin(), _e_closure_dofs[d][e].end());
     }
   }
+  end_stage("entity_dofs");
 
   // Check if base transformations are all permutations
   _dof_transformations_are_permutations = true;
@@ -954,6 +1311,57 @@ FiniteElement<F>::FiniteElement(
       }
     }
   }
+
+  // Compute the fingerprint. Elements from a family other than custom
+  // are fully defined by their parameters. The inputs that define custom
+  // elements are included, as these are not. The coefficient matrix is
+  // not used, as it is computed by LAPACK and may differ in the last
+  // bits between platforms.
+  fnv1a h;
+  h.add(static_cast<std::uint64_t>(sizeof(F)));
+  for (int v : {static_cast<int>(_family), static_cast<int>(_cell_type),
+                static_cast<int>(_poly_type), _degree,
+                static_cast<int>(_lagrange_variant),
+                static_cast<int>(_dpc_variant), static_cast<int>(_map_type),
+                static_cast<int>(_sobolev_space),
+                static_cast<int>(_discontinuous), _interpolation_nderivs,
+                _embedded_subdegree, _embedded_superdegree})
+  {
+    h.add(static_cast<std::uint64_t>(v));
+  }
+  h.add(static_cast<std::uint64_t>(_value_shape.size()));
+  for (std::size_t v : _value_shape)
+    h.add(static_cast<std::uint64_t>(v));
+  h.add(static_cast<std::uint64_t>(_dof_ordering.size()));
+  for (int v : _dof_ordering)
+    h.add(static_cast<std::uint64_t>(v));
+  if (_family == element::family::custom)
+  {
+    auto add_array = [&h](auto& a)
+    {
+      for (std::size_t n : a.second)
+        h.add(static_cast<std::uint64_t>(n));
+      for (F c : a.first)
+        h.add(c);
+    };
+
+    for (auto& edofs : _edofs)
+    {
+      h.add(static_cast<std::uint64_t>(edofs.size()));
+      for (auto& dofs : edofs)
+        h.add(static_cast<std::uint64_t>(dofs.size()));
+    }
+    add_array(_wcoeffs);
+    for (std::size_t d = 0; d < 4; ++d)
+    {
+      for (auto& x : _x[d])
+        add_array(x);
+      for (auto& M : _M[d])
+        add_array(M);
+    }
+  }
+  _fingerprint = h.value();
+  end_stage("dof_transformations");
 }
 /// @endcond
 //-----------------------------------------------------------------------------
@@ -965,6 +1373,8 @@ bool FiniteElement<F>::operator==(const FiniteElement& e) const
   else if (family() == element::family::custom
            and e.family() == element::family::custom)
   {
+    // The coefficients of custom elements are compared up to a
+    // tolerance, so elements with different fingerprints may be equal
     bool coeff_equal = false;
     if (_coeffs.first.size() == e.coefficient_matrix().first.size()
         and _coeffs.second == e.coefficient_matrix().second
@@ -985,6 +1395,13 @@ bool FiniteElement<F>::operator==(const FiniteElement& e) const
            and entity_dofs() == e.entity_dofs()
            and dof_ordering() == e.dof_ordering();
   }
+  else if (_fingerprint != e._fingerprint)
+  {
+    // The fingerprint of an element from a family other than custom
+    // includes all the properties that define it, so elements with
+    // different fingerprints are different
+    return false;
+  }
   else
   {
     return cell_type() == e.cell_type() and family() == e.family()
@@ -1029,6 +1446,9 @@ void FiniteElement<F>::tabulate(int nd, impl::mdspan_t<const F, 2> x,
                              + std::to_string(_cell_tdim) + ").");
   }
 
+  stats::record_tabulate(_fingerprint, x.extent(0),
+                         basis_data.size() * sizeof(F));
+
   const std::size_t psize
       = polyset::dim(_cell_type, _poly_type, _embedded_superdegree);
   const std::array<std::size_t, 3> bsize
@@ -1089,6 +1509,493 @@ void FiniteElement<F>::tabulate(int nd, std::span<const F> x,
 }
 //-----------------------------------------------------------------------------
 template <std::floating_point F>
+void FiniteElement<F>::tabulate_batch(int nd, impl::mdspan_t<const F, 2> x,
+                                      std::span<const std::size_t> offsets,
+                                      std::span<F> basis, int num_threads) const
+{
+  if (x.extent(1) != _cell_tdim)
+  {
+    throw std::runtime_error("Point dim (" + std::to_string(x.extent(1))
+                             + ") does not match element dim ("
+                             + std::to_string(_cell_tdim) + ").");
+  }
+  if (offsets.empty() or offsets.front() != 0
+      or offsets.back() != x.extent(0)
+      or !std::ranges::is_sorted(offsets))
+  {
+    throw std::runtime_error("Invalid offsets.");
+  }
+  if (num_threads < 1)
+    throw std::runtime_error("Number of threads must be positive.");
+
+  const std::array<std::size_t, 4> shape = tabulate_shape(nd, 1);
+  const std::size_t ndofs = shape[2];
+  const std::size_t vs = shape[3];
+  const std::size_t size_per_point = shape[0] * ndofs * vs;
+  if (basis.size() != x.extent(0) * size_per_point)
+    throw std::runtime_error("Basis array has the wrong size.");
+
+  stats::record_tabulate(_fingerprint, x.extent(0), basis.size() * sizeof(F));
+
+  const std::size_t psize
+      = polyset::dim(_cell_type, _poly_type, _embedded_superdegree);
+
+  // Split the coefficients into a (ndofs, psize) block for each value
+  // component. The blocks are shared by all the threads.
+  mdspan_t<const F, 2> coeffs(_coeffs.first.data(), _coeffs.second);
+  std::vector<F> C_b(vs * ndofs * psize);
+  mdspan_t<F, 3> C(C_b.data(), vs, ndofs, psize);
+  for (std::size_t j = 0; j < vs; ++j)
+    for (std::size_t k0 = 0; k0 < ndofs; ++k0)
+      for (std::size_t k1 = 0; k1 < psize; ++k1)
+        C(j, k0, k1) = coeffs(k0, k1 + psize * j);
+
+  // Tabulate the cells c0 to c1 (not inclusive). The cells are
+  // processed in blocks of at least block_size points, and the work
+  // arrays are allocated once for all the blocks.
+  constexpr std::size_t block_size = 1024;
+  auto tabulate_cells = [&](std::size_t c0, std::size_t c1)
+  {
+    // The end of the block that starts at cell b0
+    auto block_end = [&](std::size_t b0)
+    {
+      std::size_t b1 = b0 + 1;
+      while (b1 < c1 and offsets[b1] - offsets[b0] < block_size)
+        ++b1;
+      return b1;
+    };
+
+    std::size_t max_npoints = 0;
+    for (std::size_t b0 = c0, b1; b0 < c1; b0 = b1)
+    {
+      b1 = block_end(b0);
+      max_npoints = std::max(max_npoints, offsets[b1] - offsets[b0]);
+    }
+    if (max_npoints == 0)
+      return;
+
+    std::vector<F> P_b(shape[0] * psize * max_npoints);
+    std::vector<F> result_b(ndofs * max_npoints);
+    for (std::size_t b0 = c0, b1; b0 < c1; b0 = b1)
+    {
+      b1 = block_end(b0);
+      const std::size_t p0 = offsets[b0];
+      const std::size_t npoints = offsets[b1] - p0;
+      if (npoints == 0)
+        continue;
+
+      // Evaluate the polynomial set at all the points of the block
+      mdspan_t<F, 3> P(P_b.data(), shape[0], psize, npoints);
+      polyset::tabulate(
+          P, _cell_type, _poly_type, _embedded_superdegree, nd,
+          mdspan_t<const F, 2>(x.data_handle() + p0 * x.extent(1), npoints,
+                               x.extent(1)));
+
+      mdspan_t<F, 2> result(result_b.data(), ndofs, npoints);
+      for (std::size_t j = 0; j < vs; ++j)
+      {
+        mdspan_t<const F, 2> Cj(C_b.data() + j * ndofs * psize, ndofs,
+                                psize);
+        for (std::size_t d = 0; d < shape[0]; ++d)
+        {
+          math::dot(Cj,
+                    mdspan_t<const F, 2>(P_b.data() + d * psize * npoints,
+                                         psize, npoints),
+                    result);
+
+          // Copy into the table of each cell
+          for (std::size_t c = b0; c < b1; ++c)
+          {
+            const std::size_t nc = offsets[c + 1] - offsets[c];
+            mdspan_t<F, 4> B(basis.data() + offsets[c] * size_per_point,
+                             shape[0], nc, ndofs, vs);
+            for (std::size_t q = 0; q < nc; ++q)
+            {
+              const std::size_t r = offsets[c] - p0 + q;
+              if (_dof_ordering.empty())
+              {
+                for (std::size_t k = 0; k < ndofs; ++k)
+                  B(d, q, k, j) = result(k, r);
+              }
+              else
+              {
+                for (std::size_t k = 0; k < ndofs; ++k)
+                  B(d, q, _dof_ordering[k], j) = result(k, r);
+              }
+            }
+          }
+        }
+      }
+    }
+  };
+
+  const std::size_t num_cells = offsets.size() - 1;
+  if (num_threads == 1 or num_cells < 2)
+    tabulate_cells(0, num_cells);
+  else
+  {
+    // Split the cells into chunks with similar numbers of points
+    std::vector<std::size_t> chunks = {0};
+    for (int t = 1; t < num_threads; ++t)
+    {
+      const std::size_t target = x.extent(0) * t / num_threads;
+      auto it = std::ranges::lower_bound(offsets.first(num_cells), target);
+      std::size_t c = std::distance(offsets.begin(), it);
+      chunks.push_back(std::max(chunks.back(), c));
+    }
+    chunks.push_back(num_cells);
+
+    // Exceptions cannot leave a thread, so they are stored and the
+    // first one is rethrown once all the threads have finished
+    std::vector<std::exception_ptr> errors(chunks.size() - 1);
+    {
+      std::vector<std::jthread> threads;
+      for (std::size_t t = 1; t < chunks.size(); ++t)
+      {
+        if (chunks[t] > chunks[t - 1])
+        {
+          threads.emplace_back(
+              [&, t]
+              {
+                try
+                {
+                  tabulate_cells(chunks[t - 1], chunks[t]);
+                }
+                catch (...)
+                {
+                  errors[t - 1] = std::current_exception();
+                }
+              });
+        }
+      }
+    }
+
+    for (std::exception_ptr& e : errors)
+    {
+      if (e)
+        std::rethrow_exception(e);
+    }
+  }
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+std::vector<F>
+FiniteElement<F>::tabulate_batch(int nd, impl::mdspan_t<const F, 2> x,
+                                 std::span<const std::size_t> offsets,
+                                 int num_threads) const
+{
+  const std::array<std::size_t, 4> shape = tabulate_shape(nd, x.extent(0));
+  std::vector<F> basis(shape[0] * shape[1] * shape[2] * shape[3]);
+  tabulate_batch(nd, x, offsets, basis, num_threads);
+  return basis;
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+std::array<std::size_t, 3>
+FiniteElement<F>::tabulate_operator_shape(element::differential_operator op,
+                                          std::size_t num_points) const
+{
+  return {num_points, static_cast<std::size_t>(_coeffs.second[0]),
+          operator_terms(op, _cell_tdim, _value_shape).size()};
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+std::pair<std::vector<F>, std::array<std::size_t, 3>>
+FiniteElement<F>::tabulate_operator(element::differential_operator op,
+                                    impl::mdspan_t<const F, 2> x) const
+{
+  std::array<std::size_t, 3> shape = tabulate_operator_shape(op, x.extent(0));
+  std::vector<F> data(shape[0] * shape[1] * shape[2]);
+  tabulate_operator(op, x, mdspan_t<F, 3>(data.data(), shape));
+  return {std::move(data), shape};
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+void FiniteElement<F>::tabulate_operator(element::differential_operator op,
+                                         impl::mdspan_t<const F, 2> x,
+                                         mdspan_t<F, 3> basis_data) const
+{
+  if (x.extent(1) != _cell_tdim)
+  {
+    throw std::runtime_error("Point dim (" + std::to_string(x.extent(1))
+                             + ") does not match element dim ("
+                             + std::to_string(_cell_tdim) + ").");
+  }
+
+  const std::vector<std::vector<operator_term>> terms
+      = operator_terms(op, _cell_tdim, _value_shape);
+  const std::size_t ndofs = _coeffs.second[0];
+  if (basis_data.extent(0) != x.extent(0) or basis_data.extent(1) != ndofs
+      or basis_data.extent(2) != terms.size())
+  {
+    throw std::runtime_error("Basis array has the wrong shape.");
+  }
+
+  stats::record_tabulate(_fingerprint, x.extent(0),
+                         basis_data.size() * sizeof(F));
+
+  // If the derivative coefficients are available, the derivatives are
+  // applied to the coefficients and only the values of the polyset are
+  // needed. Otherwise, the blocks d0 to d1 (not inclusive) of the
+  // derivatives of the polyset are used.
+  const bool folded = _dcoeffs != nullptr;
+  std::size_t d0 = 0, d1 = 1;
+  if (!folded)
+  {
+    d0 = _cell_tdim + 1;
+    d1 = 0;
+    for (auto& t : terms)
+    {
+      for (auto& term : t)
+      {
+        d0 = std::min(d0, term.deriv);
+        d1 = std::max(d1, term.deriv + 1);
+      }
+    }
+  }
+
+  const std::size_t psize
+      = polyset::dim(_cell_type, _poly_type, _embedded_superdegree);
+  const int nd = d1 > 1 ? 1 : 0;
+  const std::size_t npoints = x.extent(0);
+  std::vector<F> P_b(polyset::nderivs(_cell_type, nd) * psize * npoints);
+  polyset::tabulate(mdspan_t<F, 3>(P_b.data(), polyset::nderivs(_cell_type, nd),
+                                   psize, npoints),
+                    _cell_type, _poly_type, _embedded_superdegree, nd, x);
+  mdspan_t<const F, 2> P(P_b.data() + d0 * psize * npoints, (d1 - d0) * psize,
+                         npoints);
+
+  mdspan_t<const F, 2> coeffs(_coeffs.first.data(), _coeffs.second);
+  mdspan_t<const F, 3> dcoeffs;
+  if (folded)
+  {
+    const auto& [dcoeffs_b, dshape] = derivative_coefficients();
+    dcoeffs = mdspan_t<const F, 3>(dcoeffs_b.data(), dshape);
+  }
+  std::vector<F> C_b(ndofs * P.extent(0));
+  mdspan_t<F, 2> C(C_b.data(), ndofs, P.extent(0));
+  std::vector<F> result_b(ndofs * npoints);
+  mdspan_t<F, 2> result(result_b.data(), ndofs, npoints);
+  for (std::size_t j = 0; j < terms.size(); ++j)
+  {
+    // Combine the coefficients of the terms of component j
+    std::ranges::fill(C_b, 0);
+    for (auto& [c, d, w] : terms[j])
+    {
+      const std::size_t block = folded ? 0 : d - d0;
+      for (std::size_t k0 = 0; k0 < ndofs; ++k0)
+      {
+        for (std::size_t k1 = 0; k1 < psize; ++k1)
+        {
+          const F a = (folded and d > 0) ? dcoeffs(d - 1, k0, k1 + psize * c)
+                                         : coeffs(k0, k1 + psize * c);
+          C(k0, k1 + psize * block) += static_cast<F>(w) * a;
+        }
+      }
+    }
+
+    math::dot(C, P, result);
+
+    if (_dof_ordering.empty())
+    {
+      for (std::size_t k0 = 0; k0 < npoints; ++k0)
+        for (std::size_t k1 = 0; k1 < ndofs; ++k1)
+          basis_data(k0, k1, j) = result(k1, k0);
+    }
+    else
+    {
+      for (std::size_t k0 = 0; k0 < npoints; ++k0)
+        for (std::size_t k1 = 0; k1 < ndofs; ++k1)
+          basis_data(k0, _dof_ordering[k1], j) = result(k1, k0);
+    }
+  }
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+std::pair<std::vector<F>, std::array<std::size_t, 4>>
+FiniteElement<F>::tabulate_directional_derivative(
+    impl::mdspan_t<const F, 2> x, impl::mdspan_t<const F, 3> directions) const
+{
+  std::array<std::size_t, 4> shape = tabulate_directional_derivative_shape(
+      directions.extent(0), x.extent(0));
+  std::vector<F> data(shape[0] * shape[1] * shape[2] * shape[3]);
+  tabulate_directional_derivative(x, directions,
+                                  mdspan_t<F, 4>(data.data(), shape));
+  return {std::move(data), shape};
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+void FiniteElement<F>::tabulate_directional_derivative(
+    impl::mdspan_t<const F, 2> x, impl::mdspan_t<const F, 3> directions,
+    mdspan_t<F, 4> basis_data) const
+{
+  if (x.extent(1) != _cell_tdim)
+  {
+    throw std::runtime_error("Point dim (" + std::to_string(x.extent(1))
+                             + ") does not match element dim ("
+                             + std::to_string(_cell_tdim) + ").");
+  }
+  if (directions.extent(1) != x.extent(0)
+      or directions.extent(2) != _cell_tdim)
+  {
+    throw std::runtime_error("Directions array has the wrong shape.");
+  }
+
+  const std::size_t ncells = directions.extent(0);
+  const std::size_t npoints = x.extent(0);
+  const std::array<std::size_t, 4> shape
+      = tabulate_directional_derivative_shape(ncells, npoints);
+  for (std::size_t i = 0; i < 4; ++i)
+  {
+    if (basis_data.extent(i) != shape[i])
+      throw std::runtime_error("Basis array has the wrong shape.");
+  }
+
+  stats::record_tabulate(_fingerprint, ncells * npoints,
+                         basis_data.size() * sizeof(F));
+
+  const std::size_t psize
+      = polyset::dim(_cell_type, _poly_type, _embedded_superdegree);
+  const std::size_t nderivs = polyset::nderivs(_cell_type, 1);
+  std::vector<F> P_b(nderivs * psize * npoints);
+  mdspan_t<F, 3> P(P_b.data(), nderivs, psize, npoints);
+  polyset::tabulate(P, _cell_type, _poly_type, _embedded_superdegree, 1, x);
+
+  // Contract the first derivatives of the polyset with the directions.
+  // Column c * npoints + p of D is the derivative of the polyset at
+  // point p in the direction of cell c.
+  std::vector<F> D_b(psize * ncells * npoints, 0);
+  mdspan_t<F, 2> D(D_b.data(), psize, ncells * npoints);
+  for (std::size_t j = 0; j < psize; ++j)
+    for (std::size_t c = 0; c < ncells; ++c)
+      for (std::size_t p = 0; p < npoints; ++p)
+        for (std::size_t d = 0; d < _cell_tdim; ++d)
+          D(j, c * npoints + p) += directions(c, p, d) * P(d + 1, j, p);
+
+  const std::size_t ndofs = shape[2];
+  mdspan_t<const F, 2> coeffs(_coeffs.first.data(), _coeffs.second);
+  std::vector<F> C_b(ndofs * psize);
+  mdspan_t<F, 2> C(C_b.data(), ndofs, psize);
+  std::vector<F> result_b(ndofs * ncells * npoints);
+  mdspan_t<F, 2> result(result_b.data(), ndofs, ncells * npoints);
+  for (std::size_t j = 0; j < shape[3]; ++j)
+  {
+    for (std::size_t k0 = 0; k0 < ndofs; ++k0)
+      for (std::size_t k1 = 0; k1 < psize; ++k1)
+        C(k0, k1) = coeffs(k0, k1 + psize * j);
+
+    math::dot(C, D, result);
+
+    for (std::size_t c = 0; c < ncells; ++c)
+    {
+      for (std::size_t p = 0; p < npoints; ++p)
+      {
+        if (_dof_ordering.empty())
+        {
+          for (std::size_t k = 0; k < ndofs; ++k)
+            basis_data(c, p, k, j) = result(k, c * npoints + p);
+        }
+        else
+        {
+          for (std::size_t k = 0; k < ndofs; ++k)
+            basis_data(c, p, _dof_ordering[k], j) = result(k, c * npoints + p);
+        }
+      }
+    }
+  }
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+std::size_t
+FiniteElement<F>::physical_operator_size(element::differential_operator op,
+                                         std::size_t gdim) const
+{
+  const std::size_t size = operator_terms(op, _cell_tdim, _value_shape).size();
+  if (op == element::differential_operator::divergence
+      and _map_type == maps::type::contravariantPiola)
+  {
+    return size;
+  }
+  else if (op == element::differential_operator::curl
+           and _map_type == maps::type::covariantPiola)
+  {
+    if (size == 1)
+      return 1;
+    else if (gdim == 3)
+      return 3;
+  }
+  else if (op == element::differential_operator::trace
+           and _map_type == maps::type::identity)
+  {
+    return size;
+  }
+
+  throw std::runtime_error(
+      "Operator cannot be mapped to a physical cell for this map type.");
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+std::pair<std::vector<F>, std::array<std::size_t, 3>>
+FiniteElement<F>::push_forward_operator(element::differential_operator op,
+                                        impl::mdspan_t<const F, 3> U,
+                                        impl::mdspan_t<const F, 3> J,
+                                        std::span<const F> detJ,
+                                        impl::mdspan_t<const F, 3> K) const
+{
+  std::array<std::size_t, 3> shape
+      = {U.extent(0), U.extent(1), physical_operator_size(op, J.extent(1))};
+  std::vector<F> ub(shape[0] * shape[1] * shape[2]);
+  push_forward_operator(op, U, J, detJ, K, mdspan_t<F, 3>(ub.data(), shape));
+  return {std::move(ub), shape};
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+void FiniteElement<F>::push_forward_operator(
+    element::differential_operator op, impl::mdspan_t<const F, 3> U,
+    impl::mdspan_t<const F, 3> J, std::span<const F> detJ,
+    impl::mdspan_t<const F, 3>, mdspan_t<F, 3> u) const
+{
+  const std::size_t size = physical_operator_size(op, J.extent(1));
+  if (U.extent(2) != tabulate_operator_shape(op, 0)[2])
+    throw std::runtime_error("Operator values have the wrong shape.");
+  if (u.extent(0) != U.extent(0) or u.extent(1) != U.extent(1)
+      or u.extent(2) != size)
+  {
+    throw std::runtime_error("Output array has the wrong shape.");
+  }
+
+  for (std::size_t i = 0; i < U.extent(0); ++i)
+  {
+    if (op == element::differential_operator::trace)
+    {
+      for (std::size_t p = 0; p < U.extent(1); ++p)
+        u(i, p, 0) = U(i, p, 0);
+    }
+    else if (op == element::differential_operator::divergence or size == 1)
+    {
+      // div u = div U / detJ, or curl u = curl U / detJ in 2D
+      for (std::size_t p = 0; p < U.extent(1); ++p)
+        for (std::size_t k = 0; k < size; ++k)
+          u(i, p, k) = U(i, p, k) / detJ[i];
+    }
+    else
+    {
+      // curl u = J curl U / detJ
+      for (std::size_t p = 0; p < U.extent(1); ++p)
+      {
+        for (std::size_t k = 0; k < size; ++k)
+        {
+          F value = 0;
+          for (std::size_t l = 0; l < U.extent(2); ++l)
+            value += J(i, k, l) * U(i, p, l);
+          u(i, p, k) = value / detJ[i];
+        }
+      }
+    }
+  }
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
 std::pair<std::vector<F>, std::array<std::size_t, 3>>
 FiniteElement<F>::base_transformations() const
 {
@@ -1164,13 +2071,32 @@ FiniteElement<F>::push_forward(impl::mdspan_t<const F, 3> U,
                                std::span<const F> detJ,
                                impl::mdspan_t<const F, 3> K) const
 {
-  const std::size_t physical_value_size
-      = compute_value_size(_map_type, J.extent(1));
-
+  const std::size_t vs = std::accumulate(
+      _value_shape.begin(), _value_shape.end(), 1, std::multiplies{});
   std::array<std::size_t, 3> shape
-      = {U.extent(0), U.extent(1), physical_value_size};
+      = {U.extent(0), U.extent(1),
+         maps::physical_value_size(_map_type, vs, J.extent(1))};
   std::vector<F> ub(shape[0] * shape[1] * shape[2]);
-  mdspan_t<F, 3> u(ub.data(), shape);
+  push_forward(U, J, detJ, K, mdspan_t<F, 3>(ub.data(), shape));
+  return {std::move(ub), shape};
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+void FiniteElement<F>::push_forward(impl::mdspan_t<const F, 3> U,
+                                    impl::mdspan_t<const F, 3> J,
+                                    std::span<const F> detJ,
+                                    impl::mdspan_t<const F, 3> K,
+                                    mdspan_t<F, 3> u) const
+{
+  const std::size_t vs = std::accumulate(
+      _value_shape.begin(), _value_shape.end(), 1, std::multiplies{});
+  if (U.extent(2) != vs)
+    throw std::runtime_error("Reference values have the wrong shape.");
+  if (u.extent(0) != U.extent(0) or u.extent(1) != U.extent(1)
+      or u.extent(2) != maps::physical_value_size(_map_type, vs, J.extent(1)))
+  {
+    throw std::runtime_error("Output array has the wrong shape.");
+  }
 
   using u_t = MDSPAN_IMPL_STANDARD_NAMESPACE::mdspan<
       F, MDSPAN_IMPL_STANDARD_NAMESPACE::dextents<std::size_t, 2>>;
@@ -1193,8 +2119,6 @@ FiniteElement<F>::push_forward(impl::mdspan_t<const F, 3> U,
            K.extent(2));
     map(_u, _U, _J, detJ[i], _K);
   }
-
-  return {std::move(ub), shape};
 }
 //-----------------------------------------------------------------------------
 template <std::floating_point F>
@@ -1210,7 +2134,26 @@ FiniteElement<F>::pull_back(impl::mdspan_t<const F, 3> u,
   std::array<std::size_t, 3> shape
       = {u.extent(0), u.extent(1), reference_value_size};
   std::vector<F> Ub(shape[0] * shape[1] * shape[2]);
-  mdspan_t<F, 3> U(Ub.data(), shape);
+  pull_back(u, J, detJ, K, mdspan_t<F, 3>(Ub.data(), shape));
+  return {std::move(Ub), shape};
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+void FiniteElement<F>::pull_back(impl::mdspan_t<const F, 3> u,
+                                 impl::mdspan_t<const F, 3> J,
+                                 std::span<const F> detJ,
+                                 impl::mdspan_t<const F, 3> K,
+                                 mdspan_t<F, 3> U) const
+{
+  const std::size_t vs = std::accumulate(
+      _value_shape.begin(), _value_shape.end(), 1, std::multiplies{});
+  if (u.extent(2) != maps::physical_value_size(_map_type, vs, J.extent(1)))
+    throw std::runtime_error("Physical values have the wrong shape.");
+  if (U.extent(0) != u.extent(0) or U.extent(1) != u.extent(1)
+      or U.extent(2) != vs)
+  {
+    throw std::runtime_error("Output array has the wrong shape.");
+  }
 
   using u_t = MDSPAN_IMPL_STANDARD_NAMESPACE::mdspan<
       const F, MDSPAN_IMPL_STANDARD_NAMESPACE::dextents<std::size_t, 2>>;
@@ -1233,8 +2176,148 @@ FiniteElement<F>::pull_back(impl::mdspan_t<const F, 3> u,
            K.extent(2));
     map(_U, _u, _K, 1.0 / detJ[i], _J);
   }
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+const std::pair<std::vector<F>, std::array<std::size_t, 3>>&
+FiniteElement<F>::derivative_coefficients() const
+{
+  std::call_once(_dcoeffs->flag,
+                 [this]
+                 {
+                   _dcoeffs->data = compute_derivative_coefficients<F>(
+                       _cell_type, _poly_type, _embedded_superdegree,
+                       mdspan_t<const F, 2>(_coeffs.first.data(),
+                                            _coeffs.second));
+                   _dcoeffs->computed = true;
+                 });
+  return _dcoeffs->data;
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+std::map<std::string, std::size_t> FiniteElement<F>::memory_footprint() const
+{
+  std::size_t tensor_factors
+      = _tensor_factors.capacity() * sizeof(_tensor_factors[0]);
+  for (auto& [elements, perm] : _tensor_factors)
+  {
+    tensor_factors += elements.capacity() * sizeof(FiniteElement)
+                      + heap_bytes(perm);
+    for (auto& sub : elements)
+      for (auto& [name, n] : sub.memory_footprint())
+        tensor_factors += n;
+  }
 
-  return {std::move(Ub), shape};
+  return {{"coeffs", heap_bytes(_coeffs)},
+          {"dcoeffs", (_dcoeffs and _dcoeffs->computed)
+                          ? heap_bytes(_dcoeffs->data)
+                          : 0},
+          {"matM", heap_bytes(_matM)},
+          {"dual_matrix", heap_bytes(_dual_matrix)},
+          {"wcoeffs", heap_bytes(_wcoeffs)},
+          {"x", heap_bytes(_x)},
+          {"M", heap_bytes(_M)},
+          {"points", heap_bytes(_points)},
+          {"entity_transformations", heap_bytes(_entity_transformations)},
+          {"etrans", heap_bytes(_etrans)},
+          {"etransT", heap_bytes(_etransT)},
+          {"etrans_inv", heap_bytes(_etrans_inv)},
+          {"etrans_invT", heap_bytes(_etrans_invT)},
+          {"eperm", heap_bytes(_eperm)},
+          {"eperm_rev", heap_bytes(_eperm_rev)},
+          {"edofs", heap_bytes(_edofs) + heap_bytes(_e_closure_dofs)},
+          {"tensor_factors", tensor_factors},
+          {"other", heap_bytes(_cell_subentity_types) + heap_bytes(_value_shape)
+                        + heap_bytes(_dof_ordering)
+                        + heap_bytes(_construction_times)}};
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+template <typename E, typename Archive>
+void FiniteElement<F>::serialize_members(E& e, Archive& ar)
+{
+  ar(e._cell_type, e._poly_type, e._cell_tdim, e._cell_subentity_types,
+     e._family, e._lagrange_variant, e._dpc_variant, e._degree,
+     e._interpolation_nderivs, e._embedded_superdegree,
+     e._embedded_subdegree, e._value_shape, e._map_type, e._sobolev_space,
+     e._coeffs, e._edofs, e._e_closure_dofs,
+     e._entity_transformations, e._points, e._x, e._matM,
+     e._dof_transformations_are_permutations,
+     e._dof_transformations_are_identity, e._eperm, e._eperm_rev, e._etrans,
+     e._etransT, e._etrans_inv, e._etrans_invT, e._discontinuous,
+     e._dual_matrix, e._dof_ordering, e._interpolation_is_identity,
+     e._fingerprint, e._wcoeffs, e._M);
+
+  // The derivative coefficients are not stored, as they are computed
+  // when they are first used
+  bool dcoeffs = e._dcoeffs != nullptr;
+  ar(dcoeffs);
+  if constexpr (!std::is_const_v<E>)
+  {
+    if (dcoeffs)
+      e._dcoeffs = std::make_shared<derivative_coefficients_t>();
+  }
+
+  // The elements in the tensor product factors are stored as their own
+  // binary representations
+  using factors_t = std::vector<
+      std::pair<std::vector<std::vector<std::uint8_t>>, std::vector<int>>>;
+  factors_t factors;
+  if constexpr (std::is_const_v<E>)
+  {
+    for (auto& [elements, perm] : e._tensor_factors)
+    {
+      auto& [data, p] = factors.emplace_back();
+      for (auto& sub : elements)
+        data.push_back(sub.serialize());
+      p = perm;
+    }
+    ar(factors);
+  }
+  else
+  {
+    ar(factors);
+    e._tensor_factors.clear();
+    for (auto& [data, perm] : factors)
+    {
+      std::vector<FiniteElement> elements;
+      for (auto& d : data)
+        elements.push_back(FiniteElement::deserialize(d));
+      e._tensor_factors.emplace_back(std::move(elements), std::move(perm));
+    }
+  }
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+std::vector<std::uint8_t> FiniteElement<F>::serialize() const
+{
+  writer ar;
+  ar(basix::version(), static_cast<std::uint64_t>(sizeof(F)));
+  serialize_members(*this, ar);
+  return std::move(ar.data);
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+FiniteElement<F>
+FiniteElement<F>::deserialize(std::span<const std::uint8_t> data)
+{
+  reader ar(data);
+  std::string version;
+  std::uint64_t size;
+  ar(version, size);
+  if (version != basix::version())
+  {
+    throw std::runtime_error(
+        "Serialized element was created by a different version of Basix.");
+  }
+  if (size != sizeof(F))
+    throw std::runtime_error("Serialized element has a different float type.");
+
+  FiniteElement e;
+  serialize_members(e, ar);
+  if (!ar.at_end())
+    throw std::runtime_error("Serialized element data has trailing bytes.");
+  return e;
 }
 //-----------------------------------------------------------------------------
 std::string basix::version()
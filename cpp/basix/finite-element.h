@@ -12,10 +12,13 @@
 #include "precompute.h"
 #include "sobolev-spaces.h"
 #include <array>
+#include <atomic>
 #include <concepts>
 #include <cstdint>
 #include <functional>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <numeric>
 #include <span>
 #include <string>
@@ -134,6 +137,10 @@ make_discontinuous(const std::array<std::vector<mdspan_t<const T, 2>>, 4>& x,
 /// The basis of a finite element is stored as a set of coefficients,
 /// which are applied to the underlying expansion set for that cell
 /// type, when tabulating.
+///
+/// A FiniteElement is not modified after it is created, and its const
+/// member functions do not modify any shared state. They can therefore
+/// be called concurrently on the same element from multiple threads.
 template <std::floating_point F>
 class FiniteElement
 {
@@ -348,7 +355,9 @@ public:
 
   /// Check if two elements are the same
   /// @note This operator compares the element properties, e.g. family,
-  /// degree, etc, and not computed numerical data
+  /// degree, etc, and not computed numerical data. Elements from a
+  /// family other than custom with different fingerprints are rejected
+  /// without comparing their properties.
   /// @return True if elements are the same
   bool operator==(const FiniteElement& e) const;
 
@@ -482,6 +491,224 @@ public:
   void tabulate(int nd, std::span<const F> x, std::array<std::size_t, 2> xshape,
                 std::span<F> basis) const;
 
+  /// @brief Compute basis values and derivatives for a batch of cells,
+  /// each with its own set of points.
+  ///
+  /// The points of all the cells are concatenated. The points of cell
+  /// `c` are the rows `offsets[c]` to `offsets[c + 1]` of `x`. The
+  /// polynomial set is evaluated for many cells at once, which is
+  /// faster than calling FiniteElement::tabulate for each cell when
+  /// each cell has few points.
+  ///
+  /// @param[in] nd The order of derivatives, up to and including, to
+  /// compute. Use 0 for the basis functions only.
+  /// @param[in] x The points of all the cells. The shape of x is (total
+  /// number of points, geometric dimension).
+  /// @param[in] offsets The offsets into `x` of the points of each
+  /// cell. The size of `offsets` is one more than the number of cells,
+  /// and `offsets.back()` is the number of rows of `x`.
+  /// @param [out] basis Memory location to fill. The table for cell `c`
+  /// is stored contiguously starting at `offsets[c] * n`, where `n =
+  /// shape[0] * shape[2] * shape[3]` and `shape =
+  /// tabulate_shape(nd, 1)`. It has the shape and layout of the output of
+  /// FiniteElement::tabulate for the points of that cell. The size of
+  /// `basis` must be `offsets.back() * n`.
+  /// @param[in] num_threads The number of threads to use. The cells are
+  /// divided into this number of chunks with similar numbers of points.
+  void tabulate_batch(int nd, impl::mdspan_t<const F, 2> x,
+                      std::span<const std::size_t> offsets, std::span<F> basis,
+                      int num_threads = 1) const;
+
+  /// @brief Compute basis values and derivatives for a batch of cells,
+  /// each with its own set of points.
+  ///
+  /// See the version of `FiniteElement::tabulate_batch` with the basis
+  /// data as an out argument for a description of the arguments and
+  /// the layout of the output.
+  ///
+  /// @param[in] nd The order of derivatives, up to and including, to
+  /// compute. Use 0 for the basis functions only.
+  /// @param[in] x The points of all the cells. The shape of x is (total
+  /// number of points, geometric dimension).
+  /// @param[in] offsets The offsets into `x` of the points of each cell.
+  /// @param[in] num_threads The number of threads to use.
+  /// @return The tables of all the cells, concatenated
+  std::vector<F> tabulate_batch(int nd, impl::mdspan_t<const F, 2> x,
+                                std::span<const std::size_t> offsets,
+                                int num_threads = 1) const;
+
+  /// Array shape for the values of an operator applied to the basis
+  /// functions at a set of points.
+  ///
+  /// @param[in] op The operator
+  /// @param[in] num_points Number of points
+  /// @return The shape (num_points, num basis functions, operator
+  /// value size) of the array filled by
+  /// `FiniteElement::tabulate_operator`
+  std::array<std::size_t, 3>
+  tabulate_operator_shape(element::differential_operator op,
+                          std::size_t num_points) const;
+
+  /// @brief Compute an operator applied to the basis functions at a set
+  /// of points.
+  ///
+  /// See the version of `FiniteElement::tabulate_operator` with the
+  /// basis data as an out argument.
+  ///
+  /// @param[in] op The operator
+  /// @param[in] x The points at which to compute the basis functions.
+  /// The shape of x is (number of points, geometric dimension).
+  /// @return The operator applied to the basis functions. The shape is
+  /// (point, basis fn index, operator value index).
+  std::pair<std::vector<F>, std::array<std::size_t, 3>>
+  tabulate_operator(element::differential_operator op,
+                    impl::mdspan_t<const F, 2> x) const;
+
+  /// @brief Compute an operator applied to the basis functions at a set
+  /// of points.
+  ///
+  /// This computes the same values as contracting the first derivatives
+  /// returned by `FiniteElement::tabulate`, but only the requested
+  /// operator is computed. Where the derivatives of the polyset are in
+  /// its span, the operator is applied to the expansion coefficients of
+  /// the basis functions, so only the values of the polyset are
+  /// evaluated at the points.
+  ///
+  /// The operator is applied on the reference cell.
+  /// `FiniteElement::push_forward_operator` maps the values to a
+  /// physical cell.
+  ///
+  /// @param[in] op The operator. The divergence and curl require a
+  /// vector-valued element (the divergence can also be applied to a
+  /// matrix-valued element), the symmetric gradient requires a
+  /// vector-valued element and the trace requires a matrix-valued
+  /// element.
+  /// @param[in] x The points at which to compute the basis functions.
+  /// The shape of x is (number of points, geometric dimension).
+  /// @param [out] basis Memory location to fill. It must be allocated
+  /// with the shape returned by `FiniteElement::tabulate_operator_shape`.
+  void tabulate_operator(element::differential_operator op,
+                         impl::mdspan_t<const F, 2> x,
+                         mdspan_t<F, 3> basis) const;
+
+  /// @brief The value size of an operator applied to the basis
+  /// functions after they are mapped to a physical cell.
+  ///
+  /// @param[in] op The operator
+  /// @param[in] gdim The geometric dimension of the physical cell
+  /// @return The value size
+  std::size_t physical_operator_size(element::differential_operator op,
+                                     std::size_t gdim) const;
+
+  /// @brief Map the values of an operator applied to the basis
+  /// functions from the reference to a physical cell.
+  ///
+  /// See the version of `FiniteElement::push_forward_operator` with
+  /// the output as an out argument.
+  ///
+  /// @param[in] op The operator
+  /// @param[in] U The values on the reference
+  /// @param[in] J The Jacobian of the mapping
+  /// @param[in] detJ The determinant of the Jacobian of the mapping
+  /// @param[in] K The inverse of the Jacobian of the mapping
+  /// @return The values on the cell. The indices are [Jacobian index,
+  /// point index, components].
+  std::pair<std::vector<F>, std::array<std::size_t, 3>>
+  push_forward_operator(element::differential_operator op,
+                        impl::mdspan_t<const F, 3> U,
+                        impl::mdspan_t<const F, 3> J, std::span<const F> detJ,
+                        impl::mdspan_t<const F, 3> K) const;
+
+  /// @brief Map the values of an operator applied to the basis
+  /// functions from the reference to a physical cell.
+  ///
+  /// The physical operator is available when it only depends on the
+  /// reference operator, which is the case for the divergence of
+  /// contravariant Piola mapped elements (`div u = div U / detJ`), the
+  /// curl of covariant Piola mapped elements (`curl u = J curl U /
+  /// detJ`, or `curl U / detJ` in 2D) and the trace of identity mapped
+  /// elements. For other operators and maps, tabulate the derivatives
+  /// and use `FiniteElement::push_forward`.
+  ///
+  /// @param[in] op The operator
+  /// @param[in] U The values on the reference, as returned by
+  /// `FiniteElement::tabulate_operator`. The indices are [Jacobian
+  /// index, point index, components].
+  /// @param[in] J The Jacobian of the mapping. The indices are
+  /// [Jacobian index, J_i, J_j].
+  /// @param[in] detJ The determinant of the Jacobian of the mapping. It
+  /// has length `J.shape(0)`
+  /// @param[in] K The inverse of the Jacobian of the mapping. The
+  /// indices are [Jacobian index, K_i, K_j].
+  /// @param[out] u The values on the cell. It must be allocated with
+  /// shape (U.extent(0), U.extent(1), physical_operator_size(op,
+  /// J.extent(1))).
+  void push_forward_operator(element::differential_operator op,
+                             impl::mdspan_t<const F, 3> U,
+                             impl::mdspan_t<const F, 3> J,
+                             std::span<const F> detJ,
+                             impl::mdspan_t<const F, 3> K,
+                             mdspan_t<F, 3> u) const;
+
+  /// Array shape for the directional derivatives of the basis functions
+  /// computed by `FiniteElement::tabulate_directional_derivative`.
+  ///
+  /// @param[in] num_cells Number of cells (sets of directions)
+  /// @param[in] num_points Number of points
+  /// @return The shape (num_cells, num_points, num basis functions,
+  /// value_size)
+  std::array<std::size_t, 4>
+  tabulate_directional_derivative_shape(std::size_t num_cells,
+                                        std::size_t num_points) const
+  {
+    std::size_t vs = std::accumulate(_value_shape.begin(), _value_shape.end(),
+                                     1, std::multiplies{});
+    return {num_cells, num_points, (std::size_t)_coeffs.second[0], vs};
+  }
+
+  /// @brief Compute directional derivatives of the basis functions at a
+  /// set of points.
+  ///
+  /// See the version of `FiniteElement::tabulate_directional_derivative`
+  /// with the basis data as an out argument.
+  ///
+  /// @param[in] x The points at which to compute the derivatives. The
+  /// shape of x is (number of points, tdim).
+  /// @param[in] directions The direction at each point of each cell.
+  /// The shape is (number of cells, number of points, tdim).
+  /// @return The directional derivatives. The shape is (cell, point,
+  /// basis fn index, value index).
+  std::pair<std::vector<F>, std::array<std::size_t, 4>>
+  tabulate_directional_derivative(impl::mdspan_t<const F, 2> x,
+                                  impl::mdspan_t<const F, 3> directions) const;
+
+  /// @brief Compute directional derivatives of the basis functions at a
+  /// set of points.
+  ///
+  /// For each cell `c`, point `p` and basis function `i`, this computes
+  /// `b . grad(phi_i)(x_p)`, where `b = directions(c, p, :)`. The
+  /// directions are contracted with the derivatives of the polyset
+  /// before the basis functions are computed, so the gradients of the
+  /// basis functions are never stored and the cost is similar to
+  /// tabulating the values of the basis functions. The polyset is
+  /// evaluated once for all the cells.
+  ///
+  /// The directions are on the reference cell. For a direction `b` on a
+  /// physical cell, pass `K b`, where `K` is the inverse of the Jacobian
+  /// of the mapping; for elements that are not identity mapped, the
+  /// result is then mapped with `FiniteElement::push_forward`.
+  ///
+  /// @param[in] x The points at which to compute the derivatives. The
+  /// shape of x is (number of points, tdim).
+  /// @param[in] directions The direction at each point of each cell.
+  /// The shape is (number of cells, number of points, tdim).
+  /// @param [out] basis Memory location to fill. It must be allocated
+  /// with the shape returned by
+  /// `FiniteElement::tabulate_directional_derivative_shape`.
+  void tabulate_directional_derivative(impl::mdspan_t<const F, 2> x,
+                                       impl::mdspan_t<const F, 3> directions,
+                                       mdspan_t<F, 4> basis) const;
+
   /// Get the element cell type
   /// @return The cell type
   cell::type cell_type() const { return _cell_type; }
@@ -585,6 +812,40 @@ public:
   pull_back(impl::mdspan_t<const F, 3> u, impl::mdspan_t<const F, 3> J,
             std::span<const F> detJ, impl::mdspan_t<const F, 3> K) const;
 
+  /// Map function values from the reference to a physical cell. This
+  /// function can perform the mapping for multiple points, grouped by
+  /// points that share a common Jacobian.
+  /// @note This function is designed to be called at runtime, so its
+  /// performance is critical.
+  /// @param[in] U The function values on the reference. The indices are
+  /// [Jacobian index, point index, components].
+  /// @param[in] J The Jacobian of the mapping. The indices are
+  /// [Jacobian index, J_i, J_j].
+  /// @param[in] detJ The determinant of the Jacobian of the mapping. It
+  /// has length `J.shape(0)`
+  /// @param[in] K The inverse of the Jacobian of the mapping. The
+  /// indices are [Jacobian index, K_i, K_j].
+  /// @param[out] u The function values on the cell. The indices are
+  /// [Jacobian index, point index, components]. It must be allocated
+  /// with shape (U.extent(0), U.extent(1), physical value size).
+  void push_forward(impl::mdspan_t<const F, 3> U, impl::mdspan_t<const F, 3> J,
+                    std::span<const F> detJ, impl::mdspan_t<const F, 3> K,
+                    mdspan_t<F, 3> u) const;
+
+  /// Map function values from a physical cell to the reference
+  /// @note This function is designed to be called at runtime, so its
+  /// performance is critical.
+  /// @param[in] u The function values on the cell
+  /// @param[in] J The Jacobian of the mapping
+  /// @param[in] detJ The determinant of the Jacobian of the mapping
+  /// @param[in] K The inverse of the Jacobian of the mapping
+  /// @param[out] U The function values on the reference. The indices are
+  /// [Jacobian index, point index, components]. It must be allocated
+  /// with shape (u.extent(0), u.extent(1), reference value size).
+  void pull_back(impl::mdspan_t<const F, 3> u, impl::mdspan_t<const F, 3> J,
+                 std::span<const F> detJ, impl::mdspan_t<const F, 3> K,
+                 mdspan_t<F, 3> U) const;
+
   /// Return a function that performs the appropriate
   /// push-forward/pull-back for the element type
   ///
@@ -758,7 +1019,8 @@ public:
   /// @return The entity transformations for the sub-entities of this
   /// element. The shape for each cell is (ntransformations, ndofs,
   /// ndofs)
-  std::map<cell::type, std::pair<std::vector<F>, std::array<std::size_t, 3>>>
+  const std::map<cell::type,
+                 std::pair<std::vector<F>, std::array<std::size_t, 3>>>&
   entity_transformations() const
   {
     return _entity_transformations;
@@ -1127,7 +1389,95 @@ public:
   /// Get dof layout
   const std::vector<int>& dof_ordering() const { return _dof_ordering; }
 
+  /// @brief A 64-bit fingerprint of the element.
+  ///
+  /// The fingerprint is a hash of the family, cell type, degree,
+  /// variants, map type, Sobolev space, value shape, DOF ordering and
+  /// scalar type of the element. For custom elements, the entity DOF
+  /// layout and the inputs that define the element (the coefficients
+  /// of the polynomial set, and the interpolation points and matrices)
+  /// are also included. It is computed when the element is created.
+  ///
+  /// The fingerprint does not depend on the process or the platform,
+  /// so it can be used as the key of an on-disk cache. It may change
+  /// between releases of Basix.
+  ///
+  /// @return The fingerprint
+  std::uint64_t fingerprint() const { return _fingerprint; }
+
+  /// @brief Wall time spent in each stage of the constructor.
+  ///
+  /// The stages are, in order, `dual_matrix`, `coefficients`,
+  /// `entity_transformations`, `interpolation_matrix`, `entity_dofs` and
+  /// `dof_transformations`. The time taken to define the element
+  /// (compute its polynomial set and interpolation data) before the
+  /// constructor is called is not included. The times are only
+  /// recorded while statistics are collected (see stats::set_enabled),
+  /// and are not serialized, so this is empty for an element created
+  /// while collection is disabled and for a deserialized element.
+  ///
+  /// @return Pairs of the stage name and the time in seconds
+  const std::vector<std::pair<std::string, double>>&
+  construction_times() const
+  {
+    return _construction_times;
+  }
+
+  /// @brief The memory held by the element, broken down by member.
+  ///
+  /// The entries are the number of bytes of heap memory held by the
+  /// coefficients (`coeffs`), the coefficients of the derivatives
+  /// (`dcoeffs`, which is zero until they are first used), the
+  /// interpolation matrix (`matM`), the dual matrix, the polynomial
+  /// coefficients (`wcoeffs`), the
+  /// interpolation points and matrices of each entity (`x` and `M`), the
+  /// interpolation points, the entity transformations, the precomputed
+  /// transformations and permutations (`etrans`, `etransT`,
+  /// `etrans_inv`, `etrans_invT`, `eperm` and `eperm_rev`), the entity
+  /// DOFs and closure DOFs (`edofs`), the elements of the tensor product
+  /// factorisation (`tensor_factors`) and all other members (`other`).
+  /// The size of the FiniteElement object itself is not included.
+  ///
+  /// @return Map from the name of a member to its number of bytes
+  std::map<std::string, std::size_t> memory_footprint() const;
+
+  /// @brief Serialize the element to a compact binary representation.
+  ///
+  /// The representation contains all the data of the element, so the
+  /// element can be recreated from it by `FiniteElement::deserialize`
+  /// without repeating the work done when the element was created.
+  /// Custom elements can be serialized too.
+  ///
+  /// The representation can only be read by the same version of Basix
+  /// on a platform with the same endianness.
+  ///
+  /// @return The binary representation
+  std::vector<std::uint8_t> serialize() const;
+
+  /// @brief Create an element from the binary representation created by
+  /// `FiniteElement::serialize`.
+  ///
+  /// The cost is linear in the size of the representation.
+  ///
+  /// @param[in] data The binary representation
+  /// @return The element
+  static FiniteElement deserialize(std::span<const std::uint8_t> data);
+
 private:
+  // Create an element with no data. This is used by deserialize
+  FiniteElement() = default;
+
+  // Pass each data member of an element to an archive. This is used to
+  // write (E is const) and read (E is not const) the binary
+  // representation of an element
+  template <typename E, typename Archive>
+  static void serialize_members(E& e, Archive& ar);
+
+  // The expansion coefficients of the first derivatives of the shape
+  // functions. They are computed on the first call.
+  const std::pair<std::vector<F>, std::array<std::size_t, 3>>&
+  derivative_coefficients() const;
+
   // Data permutation
   // @param data Data to be permuted
   // @param block_size
@@ -1205,6 +1555,22 @@ private:
   // (@f$\psi_{i}@f$).
   std::pair<std::vector<F>, std::array<std::size_t, 2>> _coeffs;
 
+  // Expansion coefficients of the first derivatives of the shape
+  // functions. The shape is (tdim, num dofs, value size * polyset
+  // size), and data(d, i, :) are the coefficients of the derivative of
+  // shape function i in direction d. The coefficients are computed
+  // when they are first used, and are shared by copies of the element.
+  struct derivative_coefficients_t
+  {
+    std::once_flag flag;
+    std::atomic<bool> computed = false;
+    std::pair<std::vector<F>, std::array<std::size_t, 3>> data;
+  };
+
+  // This is null for scalar elements and for polysets whose derivatives
+  // are not in their span (pyramids and macro polysets)
+  std::shared_ptr<derivative_coefficients_t> _dcoeffs;
+
   // Dofs associated with each cell (sub-)entity
   std::vector<std::vector<std::vector<int>>> _edofs;
 
@@ -1285,6 +1651,12 @@ private:
   // Is the interpolation matrix an identity?
   bool _interpolation_is_identity;
 
+  // Hash of the properties that define the element
+  std::uint64_t _fingerprint;
+
+  // Wall time (in seconds) of each stage of the constructor
+  std::vector<std::pair<std::string, double>> _construction_times;
+
   // The coefficients that define the polynomial set in terms of the
   // orthonormal polynomials
   std::pair<std::vector<F>, std::array<std::size_t, 2>> _wcoeffs;
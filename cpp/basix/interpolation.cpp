@@ -3,9 +3,15 @@
 // SPDX-License-Identifier:    MIT
 
 #include "interpolation.h"
+#include "cell.h"
 #include "finite-element.h"
+#include "maps.h"
+#include <algorithm>
+#include <cmath>
 #include <concepts>
 #include <exception>
+#include <limits>
+#include <span>
 
 using namespace basix;
 
@@ -15,6 +21,153 @@ template <typename T, std::size_t D>
 using mdspan_t = MDSPAN_IMPL_STANDARD_NAMESPACE::mdspan<
     T, MDSPAN_IMPL_STANDARD_NAMESPACE::dextents<std::size_t, D>>;
 
+namespace
+{
+//----------------------------------------------------------------------------
+/// Number of sub-facets of a facet when it is uniformly refined once
+int num_subfacets(cell::type facet_type)
+{
+  switch (facet_type)
+  {
+  case cell::type::point:
+    return 0;
+  case cell::type::interval:
+    return 2;
+  case cell::type::triangle:
+  case cell::type::quadrilateral:
+    return 4;
+  default:
+    throw std::runtime_error("Unsupported facet type.");
+  }
+}
+//----------------------------------------------------------------------------
+/// Number of orientations that a facet can have relative to another
+int num_orientations(cell::type facet_type)
+{
+  switch (facet_type)
+  {
+  case cell::type::point:
+    return 1;
+  case cell::type::interval:
+    return 2;
+  case cell::type::triangle:
+    return 6;
+  case cell::type::quadrilateral:
+    return 8;
+  default:
+    throw std::runtime_error("Unsupported facet type.");
+  }
+}
+//----------------------------------------------------------------------------
+/// Compute the weight of each vertex of a facet at a point t in the
+/// reference coordinates of the facet
+template <std::floating_point T>
+void facet_vertex_weights(cell::type facet_type, std::span<const T> t,
+                          std::span<T> w)
+{
+  switch (facet_type)
+  {
+  case cell::type::point:
+    w[0] = 1;
+    return;
+  case cell::type::interval:
+    w[0] = 1 - t[0];
+    w[1] = t[0];
+    return;
+  case cell::type::triangle:
+    w[0] = 1 - t[0] - t[1];
+    w[1] = t[0];
+    w[2] = t[1];
+    return;
+  case cell::type::quadrilateral:
+    w[0] = (1 - t[0]) * (1 - t[1]);
+    w[1] = t[0] * (1 - t[1]);
+    w[2] = (1 - t[0]) * t[1];
+    w[3] = t[0] * t[1];
+    return;
+  default:
+    throw std::runtime_error("Unsupported facet type.");
+  }
+}
+//----------------------------------------------------------------------------
+/// The vertices of a sub-facet in the reference coordinates of the
+/// facet, with shape (number of vertices, facet dimension). If subfacet
+/// is -1, the vertices of the facet are returned.
+template <std::floating_point T>
+std::vector<T> subfacet_vertices(cell::type facet_type, int subfacet)
+{
+  if (subfacet == -1)
+    return cell::geometry<T>(facet_type).first;
+
+  switch (facet_type)
+  {
+  case cell::type::interval:
+    return {T(0.5) * subfacet, T(0.5) * (subfacet + 1)};
+  case cell::type::triangle:
+    switch (subfacet)
+    {
+    case 0:
+      return {0, 0, 0.5, 0, 0, 0.5};
+    case 1:
+      return {0.5, 0, 1, 0, 0.5, 0.5};
+    case 2:
+      return {0, 0.5, 0.5, 0.5, 0, 1};
+    default:
+      return {0.5, 0.5, 0, 0.5, 0.5, 0};
+    }
+  case cell::type::quadrilateral:
+  {
+    const T x0 = T(0.5) * (subfacet % 2);
+    const T y0 = T(0.5) * (subfacet / 2);
+    return {x0, y0, x0 + T(0.5), y0, x0, y0 + T(0.5), x0 + T(0.5),
+            y0 + T(0.5)};
+  }
+  default:
+    throw std::runtime_error("Unsupported facet type.");
+  }
+}
+//----------------------------------------------------------------------------
+/// The vertex of the (sub-)facet of the coarse cell that each vertex of
+/// the facet of the fine cell is at, for an orientation
+/// 2 * rotations + reflection
+std::vector<int> orientation_permutation(cell::type facet_type,
+                                         int orientation)
+{
+  std::vector<int> rotation, reflection;
+  switch (facet_type)
+  {
+  case cell::type::point:
+    return {0};
+  case cell::type::interval:
+    rotation = {0, 1};
+    reflection = {1, 0};
+    break;
+  case cell::type::triangle:
+    rotation = {1, 2, 0};
+    reflection = {0, 2, 1};
+    break;
+  case cell::type::quadrilateral:
+    rotation = {1, 3, 0, 2};
+    reflection = {0, 2, 1, 3};
+    break;
+  default:
+    throw std::runtime_error("Unsupported facet type.");
+  }
+
+  std::vector<int> perm(rotation.size());
+  for (std::size_t i = 0; i < perm.size(); ++i)
+  {
+    perm[i] = i;
+    for (int r = 0; r < orientation / 2; ++r)
+      perm[i] = rotation[perm[i]];
+    if (orientation % 2 == 1)
+      perm[i] = reflection[perm[i]];
+  }
+  return perm;
+}
+//----------------------------------------------------------------------------
+} // namespace
+
 //----------------------------------------------------------------------------
 template <std::floating_point T>
 std::pair<std::vector<T>, std::array<std::size_t, 2>>
@@ -96,6 +249,242 @@ basix::compute_interpolation_operator(const FiniteElement<T>& element_from,
   }
 }
 //----------------------------------------------------------------------------
+template <std::floating_point T>
+interface_constraint<T> basix::compute_interface_constraint(
+    const FiniteElement<T>& coarse, int coarse_facet,
+    const FiniteElement<T>& fine, int fine_facet, int subfacet,
+    int orientation)
+{
+  const cell::type cell_type = coarse.cell_type();
+  if (fine.cell_type() != cell_type)
+  {
+    throw std::runtime_error(
+        "Elements must be defined on the same cell type.");
+  }
+  if (fine.value_shape() != coarse.value_shape())
+    throw std::runtime_error("Elements must have the same value shape.");
+  if (coarse.map_type() != maps::type::identity
+      or fine.map_type() != maps::type::identity)
+  {
+    throw std::runtime_error("Interface constraints are only supported "
+                             "for elements with an identity map.");
+  }
+  if (fine.interpolation_nderivs() > 0)
+  {
+    throw std::runtime_error("Interface constraints are not supported "
+                             "for elements with derivative DOFs.");
+  }
+
+  const int tdim = cell::topological_dimension(cell_type);
+  const int fdim = tdim - 1;
+  const int num_facets = cell::num_sub_entities(cell_type, fdim);
+  if (coarse_facet < 0 or coarse_facet >= num_facets or fine_facet < 0
+      or fine_facet >= num_facets)
+  {
+    throw std::runtime_error("Invalid facet index.");
+  }
+  const cell::type facet_type
+      = cell::sub_entity_type(cell_type, fdim, coarse_facet);
+  if (cell::sub_entity_type(cell_type, fdim, fine_facet) != facet_type)
+    throw std::runtime_error("Facets must have the same cell type.");
+  if (subfacet < -1 or subfacet >= num_subfacets(facet_type))
+    throw std::runtime_error("Invalid sub-facet.");
+  if (orientation < 0 or orientation >= num_orientations(facet_type))
+    throw std::runtime_error("Invalid facet orientation.");
+
+  interface_constraint<T> constraint;
+  constraint.dofs = fine.entity_closure_dofs()[fdim][fine_facet];
+  constraint.offsets.push_back(0);
+  if (constraint.dofs.empty())
+    return constraint;
+
+  const auto [cv_b, cvshape]
+      = cell::sub_entity_geometry<T>(cell_type, fdim, coarse_facet);
+  mdspan_t<const T, 2> cv(cv_b.data(), cvshape);
+  const auto [fv_b, fvshape]
+      = cell::sub_entity_geometry<T>(cell_type, fdim, fine_facet);
+  mdspan_t<const T, 2> fv(fv_b.data(), fvshape);
+  const std::size_t nv = cvshape[0];
+
+  // The point of the coarse cell that each vertex of the facet of the
+  // fine cell is at
+  const std::vector<T> sub = subfacet_vertices<T>(facet_type, subfacet);
+  const std::vector<int> perm = orientation_permutation(facet_type,
+                                                        orientation);
+  std::vector<T> w(nv);
+  std::vector<T> Z_b(nv * tdim, 0);
+  mdspan_t<T, 2> Z(Z_b.data(), nv, tdim);
+  for (std::size_t i = 0; i < nv; ++i)
+  {
+    facet_vertex_weights<T>(
+        facet_type, std::span(sub.data() + perm[i] * fdim, fdim), w);
+    for (std::size_t k = 0; k < nv; ++k)
+      for (int j = 0; j < tdim; ++j)
+        Z(i, j) += w[k] * cv(k, j);
+  }
+
+  // Map the interpolation points of the fine element on its facet to
+  // the coarse cell. The reference facets are affine images of the
+  // facet reference cell, so the facet coordinates of a point are
+  // found by a least squares fit.
+  const auto& [xb, xshape] = fine.points();
+  mdspan_t<const T, 2> x(xb.data(), xshape);
+  const std::size_t npts = xshape[0];
+  const T tol = 1000 * std::numeric_limits<T>::epsilon();
+  std::vector<std::size_t> facet_points;
+  std::vector<T> mapped_b;
+  std::array<T, 2> t;
+  for (std::size_t p = 0; p < npts; ++p)
+  {
+    // Solve the normal equations E^T E t = E^T (x - v_0), where column
+    // k of E is v_{k + 1} - v_0
+    std::array<T, 4> G = {0, 0, 0, 0};
+    std::array<T, 2> b = {0, 0};
+    for (int k = 0; k < fdim; ++k)
+    {
+      for (int j = 0; j < tdim; ++j)
+      {
+        const T ek = fv(k + 1, j) - fv(0, j);
+        b[k] += ek * (x(p, j) - fv(0, j));
+        for (int l = 0; l < fdim; ++l)
+          G[2 * k + l] += ek * (fv(l + 1, j) - fv(0, j));
+      }
+    }
+    if (fdim == 1)
+      t[0] = b[0] / G[0];
+    else if (fdim == 2)
+    {
+      const T det = G[0] * G[3] - G[1] * G[2];
+      t[0] = (G[3] * b[0] - G[1] * b[1]) / det;
+      t[1] = (G[0] * b[1] - G[2] * b[0]) / det;
+    }
+
+    T r = 0;
+    for (int j = 0; j < tdim; ++j)
+    {
+      T y = fv(0, j);
+      for (int k = 0; k < fdim; ++k)
+        y += t[k] * (fv(k + 1, j) - fv(0, j));
+      r += (x(p, j) - y) * (x(p, j) - y);
+    }
+    bool inside = std::sqrt(r) < tol;
+    for (int k = 0; k < fdim; ++k)
+      inside = inside and t[k] > -tol and t[k] < 1 + tol;
+    if (facet_type == cell::type::triangle)
+      inside = inside and t[0] + t[1] < 1 + tol;
+
+    if (inside)
+    {
+      facet_points.push_back(p);
+      facet_vertex_weights<T>(facet_type, std::span<const T>(t.data(), fdim),
+                              w);
+      for (int j = 0; j < tdim; ++j)
+      {
+        T y = 0;
+        for (std::size_t i = 0; i < nv; ++i)
+          y += w[i] * Z(i, j);
+        mapped_b.push_back(y);
+      }
+    }
+  }
+
+  // Evaluate the coarse element at the mapped points and apply the
+  // interpolation matrix of the fine element, as in
+  // compute_interpolation_operator. Only the points on the facet are
+  // needed, as the facet DOFs do not depend on the other points.
+  const std::size_t nfpts = facet_points.size();
+  const auto [tab_b, tab_shape] = coarse.tabulate(
+      0, mdspan_t<const T, 2>(mapped_b.data(), nfpts, tdim));
+  mdspan_t<const T, 4> tab(tab_b.data(), tab_shape);
+  const auto& [imb, imshape] = fine.interpolation_matrix();
+  mdspan_t<const T, 2> i_m(imb.data(), imshape);
+  const std::size_t vs = imshape[1] / npts;
+  const std::size_t dim_coarse = coarse.dim();
+
+  std::vector<T> row(dim_coarse);
+  for (int dof : constraint.dofs)
+  {
+    T norm = 0;
+    for (std::size_t k = 0; k < vs; ++k)
+      for (std::size_t p = 0; p < npts; ++p)
+        norm += std::abs(i_m(dof, k * npts + p));
+
+    std::fill(row.begin(), row.end(), 0);
+    T facet_norm = 0;
+    for (std::size_t k = 0; k < vs; ++k)
+    {
+      for (std::size_t q = 0; q < nfpts; ++q)
+      {
+        const T c = i_m(dof, k * npts + facet_points[q]);
+        facet_norm += std::abs(c);
+        for (std::size_t j = 0; j < dim_coarse; ++j)
+          row[j] += c * tab(0, q, j, k);
+      }
+    }
+    if (norm - facet_norm > tol * norm)
+    {
+      throw std::runtime_error(
+          "The facet DOFs of the fine element are not defined by "
+          "point evaluations on the facet.");
+    }
+
+    const T scale
+        = std::max<T>(1, std::abs(*std::max_element(
+                             row.begin(), row.end(), [](T a, T b)
+                             { return std::abs(a) < std::abs(b); })));
+    for (std::size_t j = 0; j < dim_coarse; ++j)
+    {
+      if (std::abs(row[j]) > tol * scale)
+      {
+        constraint.columns.push_back(j);
+        constraint.values.push_back(row[j]);
+      }
+    }
+    constraint.offsets.push_back(constraint.columns.size());
+  }
+
+  return constraint;
+}
+//----------------------------------------------------------------------------
+template <std::floating_point T>
+InterfaceConstraints<T>::InterfaceConstraints(const FiniteElement<T>& coarse,
+                                              const FiniteElement<T>& fine)
+{
+  const cell::type cell_type = coarse.cell_type();
+  const int fdim = cell::topological_dimension(cell_type) - 1;
+  const int num_facets = cell::num_sub_entities(cell_type, fdim);
+  for (int f0 = 0; f0 < num_facets; ++f0)
+  {
+    const cell::type facet_type = cell::sub_entity_type(cell_type, fdim, f0);
+    for (int f1 = 0; f1 < num_facets; ++f1)
+    {
+      if (cell::sub_entity_type(cell_type, fdim, f1) != facet_type)
+        continue;
+      for (int s = -1; s < num_subfacets(facet_type); ++s)
+      {
+        for (int o = 0; o < num_orientations(facet_type); ++o)
+        {
+          _constraints.emplace(
+              std::array{f0, f1, s, o},
+              compute_interface_constraint(coarse, f0, fine, f1, s, o));
+        }
+      }
+    }
+  }
+}
+//----------------------------------------------------------------------------
+template <std::floating_point T>
+const interface_constraint<T>&
+InterfaceConstraints<T>::constraint(int coarse_facet, int fine_facet,
+                                    int subfacet, int orientation) const
+{
+  auto it = _constraints.find(
+      std::array{coarse_facet, fine_facet, subfacet, orientation});
+  if (it == _constraints.end())
+    throw std::runtime_error("Invalid facets, sub-facet or orientation.");
+  return it->second;
+}
+//----------------------------------------------------------------------------
 /// @cond
 template std::pair<std::vector<float>, std::array<std::size_t, 2>>
 basix::compute_interpolation_operator(const FiniteElement<float>&,
@@ -103,5 +492,15 @@ basix::compute_interpolation_operator(const FiniteElement<float>&,
 template std::pair<std::vector<double>, std::array<std::size_t, 2>>
 basix::compute_interpolation_operator(const FiniteElement<double>&,
                                       const FiniteElement<double>&);
+template interface_constraint<float>
+basix::compute_interface_constraint(const FiniteElement<float>&, int,
+                                    const FiniteElement<float>&, int, int,
+                                    int);
+template interface_constraint<double>
+basix::compute_interface_constraint(const FiniteElement<double>&, int,
+                                    const FiniteElement<double>&, int, int,
+                                    int);
+template class basix::InterfaceConstraints<float>;
+template class basix::InterfaceConstraints<double>;
 /// @endcond
 //-----------------------------------------------------------------------------
@@ -6,6 +6,7 @@
 
 #include <array>
 #include <concepts>
+#include <map>
 #include <utility>
 #include <vector>
 
@@ -49,4 +50,116 @@ std::pair<std::vector<T>, std::array<std::size_t, 2>>
 compute_interpolation_operator(const FiniteElement<T>& element_from,
                                const FiniteElement<T>& element_to);
 
+/// @brief A sparse constraint between the DOFs of two elements on a
+/// shared facet.
+///
+/// Row `i` of the constraint expresses DOF `dofs[i]` of the fine
+/// element as a linear combination of DOFs of the coarse element. The
+/// DOFs and coefficients of row `i` are `columns[j]` and `values[j]`
+/// for `j` from `offsets[i]` to `offsets[i + 1]` (not inclusive).
+template <std::floating_point T>
+struct interface_constraint
+{
+  /// The DOFs of the fine element that are constrained
+  std::vector<int> dofs;
+
+  /// The offset of each row in `columns` and `values`. The size is
+  /// `dofs.size() + 1`.
+  std::vector<int> offsets;
+
+  /// The DOFs of the coarse element that each row depends on
+  std::vector<int> columns;
+
+  /// The coefficients of the DOFs of the coarse element
+  std::vector<T> values;
+};
+
+/// @brief Compute the constraint that makes a function in a fine
+/// element continuous with a function in a coarse element across a
+/// nonconforming facet.
+///
+/// The coarse and fine elements are defined on neighbouring cells that
+/// share (part of) a facet. The facet of the fine cell may be the whole
+/// of the facet of the coarse cell, for example if the two elements
+/// have different degrees, or one of the sub-facets obtained by
+/// uniformly refining it once, for example if the fine cell has a
+/// hanging node. The constraint expresses the DOFs of the fine element
+/// associated with the closure of its facet in terms of the DOFs of the
+/// coarse element, so that the traces of the two functions agree.
+///
+/// Sub-facet `s` of an interval is the half that contains vertex `s`.
+/// Sub-facets 0, 1 and 2 of a triangle are the triangles that contain
+/// vertex 0, 1 and 2 and sub-facet 3 is the central triangle, with
+/// vertices at the midpoints of edges 0, 1 and 2. Sub-facet `i + 2j` of
+/// a quadrilateral is the quadrilateral `[i/2, (i+1)/2] x [j/2,
+/// (j+1)/2]`.
+///
+/// The orientation is `2 * rotations + reflection`. The vertices of the
+/// facet of the fine cell are the vertices of the (sub-)facet of the
+/// coarse cell rotated `rotations` times and then reflected if
+/// `reflection` is 1. A rotation maps vertex 0 to vertex 1 of a
+/// triangle or quadrilateral, and a reflection swaps vertices 1 and 2
+/// (vertices 0 and 1 for an interval).
+///
+/// @note Only elements with an identity map whose facet DOFs are
+/// defined by point evaluations on the facet are supported. For a
+/// blocked element, apply the constraint of its sub-element to each
+/// component.
+///
+/// @param[in] coarse The coarse element
+/// @param[in] coarse_facet The local index of the shared facet of the
+/// coarse cell
+/// @param[in] fine The fine element. It must be defined on the same
+/// cell type and have the same value shape as the coarse element
+/// @param[in] fine_facet The local index of the shared facet of the
+/// fine cell
+/// @param[in] subfacet The sub-facet of the facet of the coarse cell
+/// that is the facet of the fine cell, or -1 if the facets are the same
+/// @param[in] orientation The orientation of the facet of the fine cell
+/// relative to the (sub-)facet of the coarse cell
+/// @return The constraint
+template <std::floating_point T>
+interface_constraint<T>
+compute_interface_constraint(const FiniteElement<T>& coarse, int coarse_facet,
+                             const FiniteElement<T>& fine, int fine_facet,
+                             int subfacet, int orientation);
+
+/// @brief The interface constraints between a pair of elements.
+///
+/// The constraints for every combination of facets, sub-facets and
+/// orientations are computed when the object is created, so the object
+/// should be created once for each pair of elements and reused. See
+/// compute_interface_constraint for the meaning of the arguments.
+template <std::floating_point T>
+class InterfaceConstraints
+{
+public:
+  /// @brief Compute the interface constraints between two elements.
+  /// @param[in] coarse The coarse element
+  /// @param[in] fine The fine element
+  InterfaceConstraints(const FiniteElement<T>& coarse,
+                       const FiniteElement<T>& fine);
+
+  /// @brief Get the constraint for a facet of the coarse and fine cell.
+  /// @param[in] coarse_facet The local index of the shared facet of the
+  /// coarse cell
+  /// @param[in] fine_facet The local index of the shared facet of the
+  /// fine cell
+  /// @param[in] subfacet The sub-facet, or -1 if the facets are the same
+  /// @param[in] orientation The orientation of the facet of the fine
+  /// cell
+  /// @return The constraint
+  const interface_constraint<T>& constraint(int coarse_facet, int fine_facet,
+                                            int subfacet,
+                                            int orientation) const;
+
+  /// @brief The number of constraints that have been computed.
+  std::size_t size() const { return _constraints.size(); }
+
+private:
+  // Constraint for each (coarse facet, fine facet, sub-facet,
+  // orientation)
+  std::map<std::array<int, 4>, interface_constraint<T>> _constraints;
+};
+
 } // namespace basix
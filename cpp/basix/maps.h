@@ -5,6 +5,7 @@
 #pragma once
 
 #include "mdspan.hpp"
+#include <cstddef>
 #include <stdexcept>
 #include <type_traits>
 
@@ -44,6 +45,32 @@ enum class type
   doubleContravariantPiola = 5,
 };
 
+/// @brief The value size of a function mapped to a physical cell.
+/// @param[in] map_type The map type
+/// @param[in] reference_value_size The value size of the function on the
+/// reference cell
+/// @param[in] gdim The geometric dimension of the physical cell
+/// @return The value size of the function on the physical cell
+constexpr std::size_t physical_value_size(type map_type,
+                                          std::size_t reference_value_size,
+                                          std::size_t gdim)
+{
+  switch (map_type)
+  {
+  case type::identity:
+  case type::L2Piola:
+    return reference_value_size;
+  case type::covariantPiola:
+  case type::contravariantPiola:
+    return gdim;
+  case type::doubleCovariantPiola:
+  case type::doubleContravariantPiola:
+    return gdim * gdim;
+  default:
+    throw std::runtime_error("Mapping not yet implemented");
+  }
+}
+
 /// L2 Piola map
 template <typename O, typename P, typename Q, typename R>
 void l2_piola(O&& r, const P& U, const Q& /*J*/, double detJ, const R& /*K*/)
@@ -0,0 +1,457 @@
+// Copyright (c) 2024 Basix contributors
+// FEniCS Project
+// SPDX-License-Identifier:    MIT
+
+#include "mixed-element.h"
+#include "math.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+using namespace basix;
+
+namespace
+{
+//-----------------------------------------------------------------------------
+template <typename T, std::size_t d>
+using mdspan_t = MDSPAN_IMPL_STANDARD_NAMESPACE::mdspan<
+    T, MDSPAN_IMPL_STANDARD_NAMESPACE::dextents<std::size_t, d>>;
+//-----------------------------------------------------------------------------
+/// Compute the basis functions of an element from the orthonormal
+/// polynomial set P, with shape (nderivs, psize, npoints), and pass
+/// each value to write(d, p, dof, component, value). P may have been
+/// tabulated at a higher degree than the embedded superdegree of the
+/// element if the polynomials are ordered by degree.
+template <std::floating_point F, typename W>
+void tabulate_from_polyset(const FiniteElement<F>& element,
+                           mdspan_t<const F, 3> P, W&& write)
+{
+  const std::size_t psize
+      = polyset::dim(element.cell_type(), element.polyset_type(),
+                     element.embedded_superdegree());
+  const auto& [coeffs_b, cshape] = element.coefficient_matrix();
+  mdspan_t<const F, 2> coeffs(coeffs_b.data(), cshape);
+  const std::size_t ndofs = cshape[0];
+  const std::size_t vs = cshape[1] / psize;
+  const std::size_t npoints = P.extent(2);
+  const std::vector<int>& dof_ordering = element.dof_ordering();
+
+  std::vector<F> C_b(ndofs * psize);
+  mdspan_t<F, 2> C(C_b.data(), ndofs, psize);
+  std::vector<F> result_b(ndofs * npoints);
+  mdspan_t<F, 2> result(result_b.data(), ndofs, npoints);
+  for (std::size_t j = 0; j < vs; ++j)
+  {
+    for (std::size_t k0 = 0; k0 < ndofs; ++k0)
+      for (std::size_t k1 = 0; k1 < psize; ++k1)
+        C(k0, k1) = coeffs(k0, k1 + psize * j);
+
+    for (std::size_t d = 0; d < P.extent(0); ++d)
+    {
+      math::dot(C,
+                mdspan_t<const F, 2>(P.data_handle()
+                                         + d * P.extent(1) * npoints,
+                                     psize, npoints),
+                result);
+      for (std::size_t p = 0; p < npoints; ++p)
+      {
+        for (std::size_t k = 0; k < ndofs; ++k)
+          write(d, p, dof_ordering.empty() ? k : dof_ordering[k], j,
+                result(k, p));
+      }
+    }
+  }
+}
+//-----------------------------------------------------------------------------
+/// Check that the points have the dimension of the cell
+template <std::floating_point F>
+void check_points(cell::type celltype, impl::mdspan_t<const F, 2> x)
+{
+  const std::size_t tdim = cell::topological_dimension(celltype);
+  if (x.extent(1) != tdim)
+  {
+    throw std::runtime_error("Point dim (" + std::to_string(x.extent(1))
+                             + ") does not match element dim ("
+                             + std::to_string(tdim) + ").");
+  }
+}
+//-----------------------------------------------------------------------------
+/// Merge a set of points so that points that differ by at most tol in
+/// every coordinate appear once. Returns the merged points, with
+/// shape (number of merged points, tdim), in the order of their first
+/// appearance, and the row of the merged points for each input point.
+template <std::floating_point F>
+std::pair<std::vector<F>, std::vector<int>> merge_points(mdspan_t<const F, 2> x,
+                                                         F tol)
+{
+  const std::size_t npoints = x.extent(0);
+  const std::size_t tdim = x.extent(1);
+  auto key = [&x, tdim](std::size_t p) { return tdim > 0 ? x(p, 0) : F(0); };
+
+  // Sort the points by their first coordinate, so that only a window
+  // of the sorted points needs to be compared with each point
+  std::vector<std::size_t> order(npoints);
+  std::iota(order.begin(), order.end(), 0);
+  std::ranges::sort(order, [&key](auto p0, auto p1)
+                    { return key(p0) < key(p1); });
+
+  // Each point is represented by the first point in sorted order that
+  // it is equal to
+  std::vector<std::size_t> root(npoints);
+  for (std::size_t s = 0; s < npoints; ++s)
+  {
+    const std::size_t p = order[s];
+    root[p] = p;
+    for (std::size_t t = s; t > 0 and key(p) - key(order[t - 1]) <= tol; --t)
+    {
+      const std::size_t q = order[t - 1];
+      bool equal = true;
+      for (std::size_t j = 0; j < tdim and equal; ++j)
+        equal = std::abs(x(p, j) - x(q, j)) <= tol;
+      if (equal)
+      {
+        root[p] = root[q];
+        break;
+      }
+    }
+  }
+
+  std::vector<F> points;
+  std::vector<int> map(npoints, -1);
+  int num_merged = 0;
+  for (std::size_t p = 0; p < npoints; ++p)
+  {
+    if (map[root[p]] == -1)
+    {
+      map[root[p]] = num_merged++;
+      for (std::size_t j = 0; j < tdim; ++j)
+        points.push_back(x(root[p], j));
+    }
+    map[p] = map[root[p]];
+  }
+
+  return {std::move(points), std::move(map)};
+}
+//-----------------------------------------------------------------------------
+} // namespace
+
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+MixedElement<F>::MixedElement(std::vector<FiniteElement<F>> elements)
+    : _elements(std::move(elements)), _dof_offsets({0}), _value_offsets({0}),
+      _dof_transformations_are_identity(true),
+      _dof_transformations_are_permutations(true)
+{
+  if (_elements.empty())
+    throw std::runtime_error("A mixed element needs at least one sub-element.");
+
+  const cell::type celltype = _elements.front().cell_type();
+  for (const FiniteElement<F>& e : _elements)
+  {
+    if (e.cell_type() != celltype)
+    {
+      throw std::runtime_error(
+          "Sub-elements of a mixed element must be defined on the same cell.");
+    }
+    _dof_offsets.push_back(_dof_offsets.back() + e.dim());
+    _value_offsets.push_back(
+        _value_offsets.back()
+        + std::accumulate(e.value_shape().begin(), e.value_shape().end(), 1,
+                          std::multiplies{}));
+    _dof_transformations_are_identity
+        = _dof_transformations_are_identity
+          and e.dof_transformations_are_identity();
+    _dof_transformations_are_permutations
+        = _dof_transformations_are_permutations
+          and e.dof_transformations_are_permutations();
+  }
+
+  // On simplices, the standard orthonormal polynomials are ordered by
+  // degree, so the set of the highest degree can be shared by all the
+  // sub-elements that use it. Other sets (e.g. macro sets) and sets on
+  // other cells can only be shared by sub-elements with the same
+  // embedded superdegree.
+  const bool simplex = celltype == cell::type::interval
+                       or celltype == cell::type::triangle
+                       or celltype == cell::type::tetrahedron;
+  for (std::size_t i = 0; i < _elements.size(); ++i)
+  {
+    const polyset::type ptype = _elements[i].polyset_type();
+    const int degree = _elements[i].embedded_superdegree();
+    const bool ordered_by_degree
+        = simplex and ptype == polyset::type::standard;
+    auto it = std::ranges::find_if(
+        _polysets,
+        [&](auto& p)
+        {
+          return std::get<0>(p) == ptype
+                 and (ordered_by_degree or std::get<1>(p) == degree);
+        });
+    if (it == _polysets.end())
+      _polysets.emplace_back(ptype, degree, std::vector<std::size_t>{i});
+    else
+    {
+      std::get<1>(*it) = std::max(std::get<1>(*it), degree);
+      std::get<2>(*it).push_back(i);
+    }
+  }
+
+  // Combine the entity DOFs of the sub-elements
+  _edofs = _elements.front().entity_dofs();
+  _e_closure_dofs = _elements.front().entity_closure_dofs();
+  for (std::size_t i = 1; i < _elements.size(); ++i)
+  {
+    const auto& edofs = _elements[i].entity_dofs();
+    const auto& ecdofs = _elements[i].entity_closure_dofs();
+    for (std::size_t d = 0; d < _edofs.size(); ++d)
+    {
+      for (std::size_t e = 0; e < _edofs[d].size(); ++e)
+      {
+        for (int dof : edofs[d][e])
+          _edofs[d][e].push_back(dof + _dof_offsets[i]);
+        for (int dof : ecdofs[d][e])
+          _e_closure_dofs[d][e].push_back(dof + _dof_offsets[i]);
+      }
+    }
+  }
+
+  // Merge the interpolation points of the sub-elements
+  const std::size_t tdim = cell::topological_dimension(celltype);
+  std::vector<F> x_b;
+  std::size_t num_points = 0;
+  for (const FiniteElement<F>& e : _elements)
+  {
+    x_b.insert(x_b.end(), e.points().first.begin(), e.points().first.end());
+    num_points += e.points().second[0];
+  }
+  auto [points, map] = merge_points(
+      mdspan_t<const F, 2>(x_b.data(), num_points, tdim),
+      100 * std::numeric_limits<F>::epsilon());
+  const std::size_t npoints
+      = map.empty() ? 0 : *std::ranges::max_element(map) + 1;
+  _points = {std::move(points), {npoints, tdim}};
+  for (std::size_t i = 0, offset = 0; i < _elements.size(); ++i)
+  {
+    const std::size_t n = _elements[i].points().second[0];
+    _point_maps.emplace_back(std::next(map.begin(), offset),
+                             std::next(map.begin(), offset + n));
+    offset += n;
+  }
+
+  // Combine the interpolation matrices of the sub-elements. The
+  // derivatives are ordered so that the derivatives of a lower order
+  // come first, so the derivatives of each sub-element are the first
+  // columns of each point.
+  _interpolation_nderivs = 0;
+  for (const FiniteElement<F>& e : _elements)
+  {
+    _interpolation_nderivs
+        = std::max(_interpolation_nderivs, e.interpolation_nderivs());
+  }
+  const std::size_t nderivs
+      = polyset::nderivs(celltype, _interpolation_nderivs);
+  const std::size_t vs = value_size();
+  _matM = {std::vector<F>(dim() * vs * npoints * nderivs),
+           {(std::size_t)dim(), vs * npoints * nderivs}};
+  mdspan_t<F, 4> M(_matM.first.data(), dim(), vs, npoints, nderivs);
+  for (std::size_t i = 0; i < _elements.size(); ++i)
+  {
+    const FiniteElement<F>& e = _elements[i];
+    const std::size_t e_npoints = e.points().second[0];
+    const std::size_t e_vs = _value_offsets[i + 1] - _value_offsets[i];
+    const std::size_t e_nderivs
+        = polyset::nderivs(celltype, e.interpolation_nderivs());
+    mdspan_t<const F, 4> Me(e.interpolation_matrix().first.data(), e.dim(),
+                            e_vs, e_npoints, e_nderivs);
+    for (std::size_t k0 = 0; k0 < Me.extent(0); ++k0)
+      for (std::size_t k1 = 0; k1 < Me.extent(1); ++k1)
+        for (std::size_t k2 = 0; k2 < Me.extent(2); ++k2)
+          for (std::size_t k3 = 0; k3 < Me.extent(3); ++k3)
+            M(_dof_offsets[i] + k0, _value_offsets[i] + k1,
+              _point_maps[i][k2], k3)
+                += Me(k0, k1, k2, k3);
+  }
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+std::array<std::size_t, 4>
+MixedElement<F>::tabulate_shape(std::size_t nd, std::size_t num_points) const
+{
+  const std::size_t ndsize = polyset::nderivs(cell_type(), nd);
+  return {ndsize, num_points, (std::size_t)dim(), (std::size_t)value_size()};
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+std::pair<std::vector<F>, std::array<std::size_t, 4>>
+MixedElement<F>::tabulate(int nd, impl::mdspan_t<const F, 2> x) const
+{
+  std::array<std::size_t, 4> shape = tabulate_shape(nd, x.extent(0));
+  std::vector<F> data(shape[0] * shape[1] * shape[2] * shape[3]);
+  tabulate(nd, x, mdspan_t<F, 4>(data.data(), shape));
+  return {std::move(data), shape};
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+void MixedElement<F>::tabulate(int nd, impl::mdspan_t<const F, 2> x,
+                               mdspan_t<F, 4> basis) const
+{
+  check_points(cell_type(), x);
+  const std::array<std::size_t, 4> shape = tabulate_shape(nd, x.extent(0));
+  for (std::size_t i = 0; i < 4; ++i)
+  {
+    if (basis.extent(i) != shape[i])
+      throw std::runtime_error("Basis array has the wrong shape.");
+  }
+
+  std::fill_n(basis.data_handle(), basis.size(), 0);
+  for (auto& [ptype, degree, elements] : _polysets)
+  {
+    const std::size_t psize = polyset::dim(cell_type(), ptype, degree);
+    std::vector<F> P_b(shape[0] * psize * shape[1]);
+    mdspan_t<F, 3> P(P_b.data(), shape[0], psize, shape[1]);
+    polyset::tabulate(P, cell_type(), ptype, degree, nd, x);
+
+    for (std::size_t i : elements)
+    {
+      const std::size_t dof0 = _dof_offsets[i];
+      const std::size_t value0 = _value_offsets[i];
+      tabulate_from_polyset(
+          _elements[i], mdspan_t<const F, 3>(P_b.data(), P.extents()),
+          [&](std::size_t d, std::size_t p, std::size_t k, std::size_t j,
+              F value) { basis(d, p, dof0 + k, value0 + j) = value; });
+    }
+  }
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+BlockedElement<F>::BlockedElement(FiniteElement<F> element, int block_size)
+    : _element(std::move(element)), _block_size(block_size)
+{
+  if (block_size < 1)
+    throw std::runtime_error("Block size must be positive.");
+  if (std::accumulate(_element.value_shape().begin(),
+                      _element.value_shape().end(), 1, std::multiplies{})
+      != 1)
+  {
+    throw std::runtime_error(
+        "The sub-element of a blocked element must be scalar-valued.");
+  }
+
+  // Each DOF of the sub-element becomes block_size DOFs
+  auto block = [block_size](const std::vector<std::vector<std::vector<int>>>&
+                                dofs)
+  {
+    std::vector<std::vector<std::vector<int>>> bdofs(dofs.size());
+    for (std::size_t d = 0; d < dofs.size(); ++d)
+    {
+      bdofs[d].resize(dofs[d].size());
+      for (std::size_t e = 0; e < dofs[d].size(); ++e)
+        for (int dof : dofs[d][e])
+          for (int b = 0; b < block_size; ++b)
+            bdofs[d][e].push_back(dof * block_size + b);
+    }
+    return bdofs;
+  };
+  _edofs = block(_element.entity_dofs());
+  _e_closure_dofs = block(_element.entity_closure_dofs());
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+std::array<std::size_t, 4>
+BlockedElement<F>::tabulate_shape(std::size_t nd, std::size_t num_points) const
+{
+  const std::size_t ndsize = polyset::nderivs(cell_type(), nd);
+  return {ndsize, num_points, (std::size_t)dim(), (std::size_t)_block_size};
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+std::pair<std::vector<F>, std::array<std::size_t, 4>>
+BlockedElement<F>::tabulate(int nd, impl::mdspan_t<const F, 2> x) const
+{
+  std::array<std::size_t, 4> shape = tabulate_shape(nd, x.extent(0));
+  std::vector<F> data(shape[0] * shape[1] * shape[2] * shape[3]);
+  tabulate(nd, x, mdspan_t<F, 4>(data.data(), shape));
+  return {std::move(data), shape};
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+void BlockedElement<F>::tabulate(int nd, impl::mdspan_t<const F, 2> x,
+                                 mdspan_t<F, 4> basis) const
+{
+  check_points(cell_type(), x);
+  const std::array<std::size_t, 4> shape = tabulate_shape(nd, x.extent(0));
+  for (std::size_t i = 0; i < 4; ++i)
+  {
+    if (basis.extent(i) != shape[i])
+      throw std::runtime_error("Basis array has the wrong shape.");
+  }
+
+  const cell::type celltype = cell_type();
+  const polyset::type ptype = _element.polyset_type();
+  const int degree = _element.embedded_superdegree();
+  const std::size_t psize = polyset::dim(celltype, ptype, degree);
+  std::vector<F> P_b(shape[0] * psize * shape[1]);
+  mdspan_t<F, 3> P(P_b.data(), shape[0], psize, shape[1]);
+  polyset::tabulate(P, celltype, ptype, degree, nd, x);
+
+  std::fill_n(basis.data_handle(), basis.size(), 0);
+  const std::size_t bs = _block_size;
+  tabulate_from_polyset(_element, mdspan_t<const F, 3>(P_b.data(), P.extents()),
+                        [&](std::size_t d, std::size_t p, std::size_t k,
+                            std::size_t, F value)
+                        {
+                          for (std::size_t b = 0; b < bs; ++b)
+                            basis(d, p, k * bs + b, b) = value;
+                        });
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+void BlockedElement<F>::permute_dofs(std::span<std::int32_t> dofs,
+                                     std::uint32_t cell_info) const
+{
+  if (_element.dof_transformations_are_identity())
+    return;
+
+  // Permute the DOFs of each component in turn
+  const std::size_t ndofs = _element.dim();
+  std::vector<std::int32_t> sub_dofs(ndofs);
+  for (int b = 0; b < _block_size; ++b)
+  {
+    for (std::size_t i = 0; i < ndofs; ++i)
+      sub_dofs[i] = dofs[i * _block_size + b];
+    _element.permute_dofs(sub_dofs, cell_info);
+    for (std::size_t i = 0; i < ndofs; ++i)
+      dofs[i * _block_size + b] = sub_dofs[i];
+  }
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+void BlockedElement<F>::unpermute_dofs(std::span<std::int32_t> dofs,
+                                       std::uint32_t cell_info) const
+{
+  if (_element.dof_transformations_are_identity())
+    return;
+
+  // Unpermute the DOFs of each component in turn
+  const std::size_t ndofs = _element.dim();
+  std::vector<std::int32_t> sub_dofs(ndofs);
+  for (int b = 0; b < _block_size; ++b)
+  {
+    for (std::size_t i = 0; i < ndofs; ++i)
+      sub_dofs[i] = dofs[i * _block_size + b];
+    _element.unpermute_dofs(sub_dofs, cell_info);
+    for (std::size_t i = 0; i < ndofs; ++i)
+      dofs[i * _block_size + b] = sub_dofs[i];
+  }
+}
+//-----------------------------------------------------------------------------
+
+/// @cond
+// Explicit instantiation for double and float
+template class basix::MixedElement<float>;
+template class basix::MixedElement<double>;
+template class basix::BlockedElement<float>;
+template class basix::BlockedElement<double>;
+/// @endcond
+//-----------------------------------------------------------------------------
@@ -0,0 +1,697 @@
+// Copyright (c) 2024 Basix contributors
+// FEniCS Project
+// SPDX-License-Identifier:    MIT
+
+#pragma once
+
+#include "cell.h"
+#include "finite-element.h"
+#include "mdspan.hpp"
+#include "polyset.h"
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <span>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+/// Elements built from other elements
+namespace basix
+{
+
+/// @brief A mixed element.
+///
+/// A mixed element is the direct sum of a number of sub-elements
+/// defined on the same cell. The DOFs of the mixed element are the DOFs
+/// of the first sub-element, followed by the DOFs of the second
+/// sub-element, and so on. The value components are ordered in the same
+/// way.
+///
+/// The orthonormal polynomial set is tabulated once for all
+/// sub-elements that use the same type of polynomial set, so tabulating
+/// a mixed element is cheaper than tabulating each sub-element.
+template <std::floating_point F>
+class MixedElement
+{
+  template <typename T, std::size_t d>
+  using mdspan_t = MDSPAN_IMPL_STANDARD_NAMESPACE::mdspan<
+      T, MDSPAN_IMPL_STANDARD_NAMESPACE::dextents<std::size_t, d>>;
+
+public:
+  /// @brief Create a mixed element.
+  /// @param[in] elements The sub-elements. All sub-elements must be
+  /// defined on the same cell.
+  explicit MixedElement(std::vector<FiniteElement<F>> elements);
+
+  /// Copy constructor
+  MixedElement(const MixedElement& element) = default;
+
+  /// Move constructor
+  MixedElement(MixedElement&& element) = default;
+
+  /// Destructor
+  ~MixedElement() = default;
+
+  /// Assignment operator
+  MixedElement& operator=(const MixedElement& element) = default;
+
+  /// Move assignment operator
+  MixedElement& operator=(MixedElement&& element) = default;
+
+  /// @brief The sub-elements.
+  const std::vector<FiniteElement<F>>& sub_elements() const
+  {
+    return _elements;
+  }
+
+  /// @brief The cell type that the element is defined on.
+  cell::type cell_type() const { return _elements.front().cell_type(); }
+
+  /// @brief The number of DOFs of the element.
+  int dim() const { return _dof_offsets.back(); }
+
+  /// @brief The number of value components of the element.
+  int value_size() const { return _value_offsets.back(); }
+
+  /// @brief The offset of the DOFs of each sub-element. The DOFs of
+  /// sub-element `i` are `dof_offsets()[i]` to `dof_offsets()[i + 1]`
+  /// (not inclusive).
+  const std::vector<int>& dof_offsets() const { return _dof_offsets; }
+
+  /// @brief The offset of the value components of each sub-element.
+  /// The components of sub-element `i` are `value_offsets()[i]` to
+  /// `value_offsets()[i + 1]` (not inclusive).
+  const std::vector<int>& value_offsets() const { return _value_offsets; }
+
+  /// @brief The interpolation points of the element.
+  ///
+  /// These are the interpolation points of all the sub-elements, merged
+  /// so that a point that is shared by several sub-elements appears
+  /// only once. A function that is evaluated at these points can be
+  /// interpolated into every sub-element.
+  /// @return Array of points (row-major) and its shape (number of
+  /// points, tdim)
+  const std::pair<std::vector<F>, std::array<std::size_t, 2>>& points() const
+  {
+    return _points;
+  }
+
+  /// @brief The rows of `points()` that are the interpolation points of
+  /// each sub-element.
+  /// @return `point_maps()[i][p]` is the row of `points()` that is
+  /// point `p` of `FiniteElement::points()` of sub-element `i`
+  const std::vector<std::vector<int>>& point_maps() const
+  {
+    return _point_maps;
+  }
+
+  /// @brief The highest number of derivatives that any sub-element
+  /// needs to evaluate when interpolating.
+  int interpolation_nderivs() const { return _interpolation_nderivs; }
+
+  /// @brief The interpolation matrix of the element.
+  ///
+  /// The matrix maps the values of a function at `points()` to the DOFs
+  /// of the mixed element. It has the layout of
+  /// FiniteElement::interpolation_matrix: the column for value
+  /// component `k`, point `p` and derivative `d` is `(k * num_points +
+  /// p) * nderivs + d`, where `nderivs = polyset::nderivs(cell_type(),
+  /// interpolation_nderivs())`.
+  ///
+  /// @return The interpolation matrix and its shape (dim, value_size *
+  /// num_points * nderivs)
+  const std::pair<std::vector<F>, std::array<std::size_t, 2>>&
+  interpolation_matrix() const
+  {
+    return _matM;
+  }
+
+  /// @brief The DOFs associated with each sub-entity of the cell.
+  /// @return `entity_dofs()[d][i]` is the list of DOFs associated with
+  /// entity `i` of dimension `d`
+  const std::vector<std::vector<std::vector<int>>>& entity_dofs() const
+  {
+    return _edofs;
+  }
+
+  /// @brief The DOFs associated with the closure of each sub-entity of
+  /// the cell.
+  /// @return `entity_closure_dofs()[d][i]` is the list of DOFs
+  /// associated with the closure of entity `i` of dimension `d`
+  const std::vector<std::vector<std::vector<int>>>& entity_closure_dofs() const
+  {
+    return _e_closure_dofs;
+  }
+
+  /// @brief Indicates whether the DOF transformations of all the
+  /// sub-elements are identities.
+  bool dof_transformations_are_identity() const
+  {
+    return _dof_transformations_are_identity;
+  }
+
+  /// @brief Indicates whether the DOF transformations of all the
+  /// sub-elements are permutations.
+  bool dof_transformations_are_permutations() const
+  {
+    return _dof_transformations_are_permutations;
+  }
+
+  /// @brief Array shape for tabulate basis values and derivatives at
+  /// a set of points.
+  /// @param[in] nd The order of derivatives, up to and including, to
+  /// compute. Use 0 for the basis functions only.
+  /// @param[in] num_points Number of points that basis will be computed
+  /// at.
+  /// @return The shape of the array to will filled when passed to
+  /// `MixedElement::tabulate`
+  std::array<std::size_t, 4> tabulate_shape(std::size_t nd,
+                                            std::size_t num_points) const;
+
+  /// @brief Compute basis values and derivatives at a set of points.
+  ///
+  /// The table has the same layout as the output of
+  /// FiniteElement::tabulate. Sub-element `i` contributes only to its
+  /// own DOFs and value components; all other entries are zero.
+  ///
+  /// @param[in] nd The order of derivatives, up to and including, to
+  /// compute. Use 0 for the basis functions only.
+  /// @param[in] x The points at which to compute the basis functions.
+  /// The shape of x is (number of points, geometric dimension).
+  /// @return The basis functions (and derivatives), and the shape of
+  /// the data array.
+  std::pair<std::vector<F>, std::array<std::size_t, 4>>
+  tabulate(int nd, impl::mdspan_t<const F, 2> x) const;
+
+  /// @brief Compute basis values and derivatives at a set of points.
+  ///
+  /// See the version of `MixedElement::tabulate` that returns the basis
+  /// data.
+  ///
+  /// @param[in] nd The order of derivatives, up to and including, to
+  /// compute. Use 0 for the basis functions only.
+  /// @param[in] x The points at which to compute the basis functions.
+  /// The shape of x is (number of points, geometric dimension).
+  /// @param[out] basis Memory location to fill. Its shape must be
+  /// `tabulate_shape(nd, x.extent(0))`.
+  void tabulate(int nd, impl::mdspan_t<const F, 2> x,
+                mdspan_t<F, 4> basis) const;
+
+  /// @brief Permute the dof numbering on a cell.
+  /// @param[in,out] dofs The dof numbering for the cell
+  /// @param cell_info The permutation info for the cell
+  void permute_dofs(std::span<std::int32_t> dofs,
+                    std::uint32_t cell_info) const
+  {
+    if (_dof_transformations_are_identity)
+      return;
+    for (std::size_t i = 0; i < _elements.size(); ++i)
+    {
+      _elements[i].permute_dofs(dofs.subspan(_dof_offsets[i],
+                                             _elements[i].dim()),
+                                cell_info);
+    }
+  }
+
+  /// @brief Unpermute the dof numbering on a cell.
+  /// @param[in,out] dofs The dof numbering for the cell
+  /// @param cell_info The permutation info for the cell
+  void unpermute_dofs(std::span<std::int32_t> dofs,
+                      std::uint32_t cell_info) const
+  {
+    if (_dof_transformations_are_identity)
+      return;
+    for (std::size_t i = 0; i < _elements.size(); ++i)
+    {
+      _elements[i].unpermute_dofs(dofs.subspan(_dof_offsets[i],
+                                               _elements[i].dim()),
+                                  cell_info);
+    }
+  }
+
+  /// @brief Multiply data by DOF transformation matrix from the left.
+  ///
+  /// The transformation of each sub-element is applied to the block of
+  /// data of its DOFs.
+  ///
+  /// @param[in,out] data The data
+  /// @param block_size The number of data points per DOF
+  /// @param cell_info The permutation info for the cell
+  template <typename T>
+  void pre_apply_dof_transformation(std::span<T> data, int block_size,
+                                    std::uint32_t cell_info) const
+  {
+    pre_apply(data, block_size,
+              [cell_info](const FiniteElement<F>& e, std::span<T> d, int bs)
+              { e.pre_apply_dof_transformation(d, bs, cell_info); });
+  }
+
+  /// @brief Multiply data by transpose DOF transformation matrix from
+  /// the left.
+  /// @param[in,out] data The data
+  /// @param block_size The number of data points per DOF
+  /// @param cell_info The permutation info for the cell
+  template <typename T>
+  void pre_apply_transpose_dof_transformation(std::span<T> data, int block_size,
+                                              std::uint32_t cell_info) const
+  {
+    pre_apply(data, block_size,
+              [cell_info](const FiniteElement<F>& e, std::span<T> d, int bs)
+              { e.pre_apply_transpose_dof_transformation(d, bs, cell_info); });
+  }
+
+  /// @brief Multiply data by inverse transpose DOF transformation
+  /// matrix from the left.
+  /// @param[in,out] data The data
+  /// @param block_size The number of data points per DOF
+  /// @param cell_info The permutation info for the cell
+  template <typename T>
+  void pre_apply_inverse_transpose_dof_transformation(
+      std::span<T> data, int block_size, std::uint32_t cell_info) const
+  {
+    pre_apply(data, block_size,
+              [cell_info](const FiniteElement<F>& e, std::span<T> d, int bs)
+              {
+                e.pre_apply_inverse_transpose_dof_transformation(d, bs,
+                                                                 cell_info);
+              });
+  }
+
+  /// @brief Multiply data by inverse DOF transformation matrix from the
+  /// left.
+  /// @param[in,out] data The data
+  /// @param block_size The number of data points per DOF
+  /// @param cell_info The permutation info for the cell
+  template <typename T>
+  void pre_apply_inverse_dof_transformation(std::span<T> data, int block_size,
+                                            std::uint32_t cell_info) const
+  {
+    pre_apply(data, block_size,
+              [cell_info](const FiniteElement<F>& e, std::span<T> d, int bs)
+              { e.pre_apply_inverse_dof_transformation(d, bs, cell_info); });
+  }
+
+  /// @brief Multiply data by transpose DOF transformation matrix from
+  /// the right.
+  /// @param[in,out] data The data
+  /// @param block_size The number of data points per DOF
+  /// @param cell_info The permutation info for the cell
+  template <typename T>
+  void post_apply_transpose_dof_transformation(std::span<T> data,
+                                               int block_size,
+                                               std::uint32_t cell_info) const
+  {
+    post_apply(data, block_size,
+               [cell_info](const FiniteElement<F>& e, std::span<T> d)
+               { e.post_apply_transpose_dof_transformation(d, 1, cell_info); });
+  }
+
+  /// @brief Multiply data by DOF transformation matrix from the right.
+  /// @param[in,out] data The data
+  /// @param block_size The number of data points per DOF
+  /// @param cell_info The permutation info for the cell
+  template <typename T>
+  void post_apply_dof_transformation(std::span<T> data, int block_size,
+                                     std::uint32_t cell_info) const
+  {
+    post_apply(data, block_size,
+               [cell_info](const FiniteElement<F>& e, std::span<T> d)
+               { e.post_apply_dof_transformation(d, 1, cell_info); });
+  }
+
+  /// @brief Multiply data by inverse DOF transformation matrix from the
+  /// right.
+  /// @param[in,out] data The data
+  /// @param block_size The number of data points per DOF
+  /// @param cell_info The permutation info for the cell
+  template <typename T>
+  void post_apply_inverse_dof_transformation(std::span<T> data, int block_size,
+                                             std::uint32_t cell_info) const
+  {
+    post_apply(data, block_size,
+               [cell_info](const FiniteElement<F>& e, std::span<T> d)
+               { e.post_apply_inverse_dof_transformation(d, 1, cell_info); });
+  }
+
+  /// @brief Multiply data by inverse transpose DOF transformation
+  /// matrix from the right.
+  /// @param[in,out] data The data
+  /// @param block_size The number of data points per DOF
+  /// @param cell_info The permutation info for the cell
+  template <typename T>
+  void post_apply_inverse_transpose_dof_transformation(
+      std::span<T> data, int block_size, std::uint32_t cell_info) const
+  {
+    post_apply(data, block_size,
+               [cell_info](const FiniteElement<F>& e, std::span<T> d)
+               {
+                 e.post_apply_inverse_transpose_dof_transformation(d, 1,
+                                                                   cell_info);
+               });
+  }
+
+private:
+  // Apply op(element, data, block_size) to the block of data of the
+  // DOFs of each sub-element, where data[block_size * dof + b] is data
+  // point b of DOF dof
+  template <typename T, typename Op>
+  void pre_apply(std::span<T> data, int block_size, Op op) const
+  {
+    if (_dof_transformations_are_identity)
+      return;
+    for (std::size_t i = 0; i < _elements.size(); ++i)
+    {
+      op(_elements[i],
+         data.subspan(block_size * _dof_offsets[i],
+                      block_size * _elements[i].dim()),
+         block_size);
+    }
+  }
+
+  // Apply op(element, row) to the part of each row of data that
+  // belongs to each sub-element, where data has block_size rows
+  template <typename T, typename Op>
+  void post_apply(std::span<T> data, int block_size, Op op) const
+  {
+    if (_dof_transformations_are_identity)
+      return;
+    const std::size_t ndofs = dim();
+    for (int b = 0; b < block_size; ++b)
+    {
+      for (std::size_t i = 0; i < _elements.size(); ++i)
+      {
+        op(_elements[i],
+           data.subspan(b * ndofs + _dof_offsets[i], _elements[i].dim()));
+      }
+    }
+  }
+
+  // The sub-elements
+  std::vector<FiniteElement<F>> _elements;
+
+  // Offsets of the DOFs and value components of the sub-elements
+  std::vector<int> _dof_offsets, _value_offsets;
+
+  // The polynomial sets that are tabulated: the type, the degree, and
+  // the sub-elements that use each set
+  std::vector<std::tuple<polyset::type, int, std::vector<std::size_t>>>
+      _polysets;
+
+  // DOFs associated with each sub-entity and its closure
+  std::vector<std::vector<std::vector<int>>> _edofs, _e_closure_dofs;
+
+  // Merged interpolation points, the rows of the points of each
+  // sub-element, and the interpolation matrix
+  std::pair<std::vector<F>, std::array<std::size_t, 2>> _points;
+  std::vector<std::vector<int>> _point_maps;
+  int _interpolation_nderivs;
+  std::pair<std::vector<F>, std::array<std::size_t, 2>> _matM;
+
+  bool _dof_transformations_are_identity;
+  bool _dof_transformations_are_permutations;
+};
+
+/// @brief A blocked element.
+///
+/// A blocked element has `block_size` copies of a scalar sub-element,
+/// one for each value component. The DOFs are interleaved: DOF `i` of
+/// the sub-element for component `b` is DOF `i * block_size + b` of the
+/// blocked element. This is the layout used for vector- and
+/// tensor-valued Lagrange spaces.
+///
+/// The sub-element is tabulated once, and its values are written
+/// directly into the blocked table.
+template <std::floating_point F>
+class BlockedElement
+{
+  template <typename T, std::size_t d>
+  using mdspan_t = MDSPAN_IMPL_STANDARD_NAMESPACE::mdspan<
+      T, MDSPAN_IMPL_STANDARD_NAMESPACE::dextents<std::size_t, d>>;
+
+public:
+  /// @brief Create a blocked element.
+  /// @param[in] element The sub-element. It must be scalar-valued.
+  /// @param[in] block_size The number of copies of the sub-element
+  BlockedElement(FiniteElement<F> element, int block_size);
+
+  /// Copy constructor
+  BlockedElement(const BlockedElement& element) = default;
+
+  /// Move constructor
+  BlockedElement(BlockedElement&& element) = default;
+
+  /// Destructor
+  ~BlockedElement() = default;
+
+  /// Assignment operator
+  BlockedElement& operator=(const BlockedElement& element) = default;
+
+  /// Move assignment operator
+  BlockedElement& operator=(BlockedElement&& element) = default;
+
+  /// @brief The sub-element.
+  const FiniteElement<F>& sub_element() const { return _element; }
+
+  /// @brief The number of copies of the sub-element.
+  int block_size() const { return _block_size; }
+
+  /// @brief The cell type that the element is defined on.
+  cell::type cell_type() const { return _element.cell_type(); }
+
+  /// @brief The number of DOFs of the element.
+  int dim() const { return _element.dim() * _block_size; }
+
+  /// @brief The number of value components of the element.
+  int value_size() const { return _block_size; }
+
+  /// @brief The DOFs associated with each sub-entity of the cell.
+  /// @return `entity_dofs()[d][i]` is the list of DOFs associated with
+  /// entity `i` of dimension `d`
+  const std::vector<std::vector<std::vector<int>>>& entity_dofs() const
+  {
+    return _edofs;
+  }
+
+  /// @brief The DOFs associated with the closure of each sub-entity of
+  /// the cell.
+  /// @return `entity_closure_dofs()[d][i]` is the list of DOFs
+  /// associated with the closure of entity `i` of dimension `d`
+  const std::vector<std::vector<std::vector<int>>>& entity_closure_dofs() const
+  {
+    return _e_closure_dofs;
+  }
+
+  /// @brief Indicates whether the DOF transformations of the
+  /// sub-element are identities.
+  bool dof_transformations_are_identity() const
+  {
+    return _element.dof_transformations_are_identity();
+  }
+
+  /// @brief Indicates whether the DOF transformations of the
+  /// sub-element are permutations.
+  bool dof_transformations_are_permutations() const
+  {
+    return _element.dof_transformations_are_permutations();
+  }
+
+  /// @brief Array shape for tabulate basis values and derivatives at
+  /// a set of points.
+  /// @param[in] nd The order of derivatives, up to and including, to
+  /// compute. Use 0 for the basis functions only.
+  /// @param[in] num_points Number of points that basis will be computed
+  /// at.
+  /// @return The shape of the array to will filled when passed to
+  /// `BlockedElement::tabulate`
+  std::array<std::size_t, 4> tabulate_shape(std::size_t nd,
+                                            std::size_t num_points) const;
+
+  /// @brief Compute basis values and derivatives at a set of points.
+  ///
+  /// The table has the same layout as the output of
+  /// FiniteElement::tabulate. Entry `(d, p, i * block_size + b, b)` is
+  /// entry `(d, p, i, 0)` of the table of the sub-element; all other
+  /// entries are zero.
+  ///
+  /// @param[in] nd The order of derivatives, up to and including, to
+  /// compute. Use 0 for the basis functions only.
+  /// @param[in] x The points at which to compute the basis functions.
+  /// The shape of x is (number of points, geometric dimension).
+  /// @return The basis functions (and derivatives), and the shape of
+  /// the data array.
+  std::pair<std::vector<F>, std::array<std::size_t, 4>>
+  tabulate(int nd, impl::mdspan_t<const F, 2> x) const;
+
+  /// @brief Compute basis values and derivatives at a set of points.
+  ///
+  /// See the version of `BlockedElement::tabulate` that returns the
+  /// basis data.
+  ///
+  /// @param[in] nd The order of derivatives, up to and including, to
+  /// compute. Use 0 for the basis functions only.
+  /// @param[in] x The points at which to compute the basis functions.
+  /// The shape of x is (number of points, geometric dimension).
+  /// @param[out] basis Memory location to fill. Its shape must be
+  /// `tabulate_shape(nd, x.extent(0))`.
+  void tabulate(int nd, impl::mdspan_t<const F, 2> x,
+                mdspan_t<F, 4> basis) const;
+
+  /// @brief Permute the dof numbering on a cell.
+  /// @param[in,out] dofs The dof numbering for the cell
+  /// @param cell_info The permutation info for the cell
+  void permute_dofs(std::span<std::int32_t> dofs,
+                    std::uint32_t cell_info) const;
+
+  /// @brief Unpermute the dof numbering on a cell.
+  /// @param[in,out] dofs The dof numbering for the cell
+  /// @param cell_info The permutation info for the cell
+  void unpermute_dofs(std::span<std::int32_t> dofs,
+                      std::uint32_t cell_info) const;
+
+  /// @brief Multiply data by DOF transformation matrix from the left.
+  ///
+  /// The transformation of the sub-element is applied to all the
+  /// components at once, by treating the components as extra data
+  /// points of each DOF of the sub-element.
+  ///
+  /// @param[in,out] data The data
+  /// @param block_size The number of data points per DOF
+  /// @param cell_info The permutation info for the cell
+  template <typename T>
+  void pre_apply_dof_transformation(std::span<T> data, int block_size,
+                                    std::uint32_t cell_info) const
+  {
+    _element.pre_apply_dof_transformation(data, block_size * _block_size,
+                                          cell_info);
+  }
+
+  /// @brief Multiply data by transpose DOF transformation matrix from
+  /// the left.
+  /// @param[in,out] data The data
+  /// @param block_size The number of data points per DOF
+  /// @param cell_info The permutation info for the cell
+  template <typename T>
+  void pre_apply_transpose_dof_transformation(std::span<T> data, int block_size,
+                                              std::uint32_t cell_info) const
+  {
+    _element.pre_apply_transpose_dof_transformation(
+        data, block_size * _block_size, cell_info);
+  }
+
+  /// @brief Multiply data by inverse transpose DOF transformation
+  /// matrix from the left.
+  /// @param[in,out] data The data
+  /// @param block_size The number of data points per DOF
+  /// @param cell_info The permutation info for the cell
+  template <typename T>
+  void pre_apply_inverse_transpose_dof_transformation(
+      std::span<T> data, int block_size, std::uint32_t cell_info) const
+  {
+    _element.pre_apply_inverse_transpose_dof_transformation(
+        data, block_size * _block_size, cell_info);
+  }
+
+  /// @brief Multiply data by inverse DOF transformation matrix from the
+  /// left.
+  /// @param[in,out] data The data
+  /// @param block_size The number of data points per DOF
+  /// @param cell_info The permutation info for the cell
+  template <typename T>
+  void pre_apply_inverse_dof_transformation(std::span<T> data, int block_size,
+                                            std::uint32_t cell_info) const
+  {
+    _element.pre_apply_inverse_dof_transformation(
+        data, block_size * _block_size, cell_info);
+  }
+
+  /// @brief Multiply data by transpose DOF transformation matrix from
+  /// the right.
+  ///
+  /// Multiplying a row of data by a matrix from the right is the same
+  /// as multiplying it by the transpose of the matrix from the left, so
+  /// each row is transformed by the corresponding `pre_apply` function
+  /// of the sub-element.
+  ///
+  /// @param[in,out] data The data
+  /// @param block_size The number of data points per DOF
+  /// @param cell_info The permutation info for the cell
+  template <typename T>
+  void post_apply_transpose_dof_transformation(std::span<T> data,
+                                               int block_size,
+                                               std::uint32_t cell_info) const
+  {
+    if (dof_transformations_are_identity())
+      return;
+    for (int b = 0; b < block_size; ++b)
+    {
+      _element.pre_apply_dof_transformation(data.subspan(b * dim(), dim()),
+                                            _block_size, cell_info);
+    }
+  }
+
+  /// @brief Multiply data by DOF transformation matrix from the right.
+  /// @param[in,out] data The data
+  /// @param block_size The number of data points per DOF
+  /// @param cell_info The permutation info for the cell
+  template <typename T>
+  void post_apply_dof_transformation(std::span<T> data, int block_size,
+                                     std::uint32_t cell_info) const
+  {
+    if (dof_transformations_are_identity())
+      return;
+    for (int b = 0; b < block_size; ++b)
+    {
+      _element.pre_apply_transpose_dof_transformation(
+          data.subspan(b * dim(), dim()), _block_size, cell_info);
+    }
+  }
+
+  /// @brief Multiply data by inverse DOF transformation matrix from the
+  /// right.
+  /// @param[in,out] data The data
+  /// @param block_size The number of data points per DOF
+  /// @param cell_info The permutation info for the cell
+  template <typename T>
+  void post_apply_inverse_dof_transformation(std::span<T> data, int block_size,
+                                             std::uint32_t cell_info) const
+  {
+    if (dof_transformations_are_identity())
+      return;
+    for (int b = 0; b < block_size; ++b)
+    {
+      _element.pre_apply_inverse_transpose_dof_transformation(
+          data.subspan(b * dim(), dim()), _block_size, cell_info);
+    }
+  }
+
+  /// @brief Multiply data by inverse transpose DOF transformation
+  /// matrix from the right.
+  /// @param[in,out] data The data
+  /// @param block_size The number of data points per DOF
+  /// @param cell_info The permutation info for the cell
+  template <typename T>
+  void post_apply_inverse_transpose_dof_transformation(
+      std::span<T> data, int block_size, std::uint32_t cell_info) const
+  {
+    if (dof_transformations_are_identity())
+      return;
+    for (int b = 0; b < block_size; ++b)
+    {
+      _element.pre_apply_inverse_dof_transformation(
+          data.subspan(b * dim(), dim()), _block_size, cell_info);
+    }
+  }
+
+private:
+  // The sub-element
+  FiniteElement<F> _element;
+
+  // The number of copies of the sub-element
+  int _block_size;
+
+  // DOFs associated with each sub-entity and its closure
+  std::vector<std::vector<std::vector<int>>> _edofs, _e_closure_dofs;
+};
+
+} // namespace basix
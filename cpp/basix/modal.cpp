@@ -0,0 +1,341 @@
+// Copyright (c) 2024 Basix contributors
+// FEniCS Project
+// SPDX-License-Identifier:    MIT
+
+#include "modal.h"
+#include "math.h"
+#include "polyset.h"
+#include "quadrature.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+using namespace basix;
+
+namespace
+{
+//-----------------------------------------------------------------------------
+template <typename T, std::size_t d>
+using mdspan_t = MDSPAN_IMPL_STANDARD_NAMESPACE::mdspan<
+    T, MDSPAN_IMPL_STANDARD_NAMESPACE::dextents<std::size_t, d>>;
+//-----------------------------------------------------------------------------
+/// Compute the degree of each polynomial in the orthonormal set of
+/// degree n. The degree of a polynomial is the lowest degree of
+/// polynomial set whose span contains it, and is found by projecting
+/// the polynomial onto the sets of lower degree.
+template <std::floating_point T>
+std::vector<int> polynomial_degrees(cell::type cell_type,
+                                    polyset::type poly_type, int n)
+{
+  const std::size_t psize = polyset::dim(cell_type, poly_type, n);
+  std::vector<int> degrees(psize, n);
+  if (n == 0)
+    return degrees;
+
+  const std::size_t tdim = cell::topological_dimension(cell_type);
+  const auto [pts, wts] = quadrature::make_quadrature<T>(
+      quadrature::type::Default, cell_type, poly_type, 2 * n);
+  const std::size_t npts = wts.size();
+  mdspan_t<const T, 2> x(pts.data(), npts, tdim);
+
+  // Weighted values of the polynomial set of degree n, shape (num
+  // points, psize)
+  const auto [Pnb, Pnshape]
+      = polyset::tabulate(cell_type, poly_type, n, 0, x);
+  std::vector<T> Pw_b(npts * psize);
+  mdspan_t<T, 2> Pw(Pw_b.data(), npts, psize);
+  for (std::size_t q = 0; q < npts; ++q)
+    for (std::size_t k = 0; k < psize; ++k)
+      Pw(q, k) = wts[q] * Pnb[k * npts + q];
+
+  // Check the degrees from the highest down, so that each polynomial is
+  // assigned the lowest degree that contains it
+  for (int d = n - 1; d >= 0; --d)
+  {
+    const auto [Pdb, Pdshape]
+        = polyset::tabulate(cell_type, poly_type, d, 0, x);
+    mdspan_t<const T, 2> Pd(Pdb.data(), Pdshape[1], npts);
+    std::vector<T> G_b(Pd.extent(0) * psize);
+    mdspan_t<T, 2> G(G_b.data(), Pd.extent(0), psize);
+    math::dot(Pd, Pw, G);
+    for (std::size_t k = 0; k < psize; ++k)
+    {
+      T norm = 0;
+      for (std::size_t j = 0; j < G.extent(0); ++j)
+        norm += G(j, k) * G(j, k);
+      if (norm > 0.5)
+        degrees[k] = d;
+    }
+  }
+
+  return degrees;
+}
+//-----------------------------------------------------------------------------
+/// Compute out = u * A^T for a matrix A and a set of rows u
+template <std::floating_point T>
+void apply_matrix(mdspan_t<const T, 2> A, mdspan_t<const T, 2> u,
+                  mdspan_t<T, 2> out)
+{
+  if (u.extent(1) != A.extent(1))
+    throw std::runtime_error("Input array has the wrong shape.");
+  if (out.extent(0) != u.extent(0) or out.extent(1) != A.extent(0))
+    throw std::runtime_error("Output array has the wrong shape.");
+
+  std::vector<T> At_b(A.extent(1) * A.extent(0));
+  mdspan_t<T, 2> At(At_b.data(), A.extent(1), A.extent(0));
+  for (std::size_t i = 0; i < A.extent(0); ++i)
+    for (std::size_t j = 0; j < A.extent(1); ++j)
+      At(j, i) = A(i, j);
+  math::dot(u, At, out);
+}
+//-----------------------------------------------------------------------------
+} // namespace
+
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+ModalBasis<F>::ModalBasis(const FiniteElement<F>& element)
+    : _dim(element.dim()), _degree(element.embedded_superdegree())
+{
+  if (_degree < 0)
+    throw std::runtime_error("Element does not have a modal basis.");
+  if (element.cell_type() == cell::type::pyramid)
+  {
+    throw std::runtime_error(
+        "Modal bases are not supported on pyramids.");
+  }
+
+  const std::vector<int> poly_degrees = polynomial_degrees<F>(
+      element.cell_type(), element.polyset_type(), _degree);
+  const std::size_t psize = poly_degrees.size();
+
+  const auto& [coeffs_b, cshape] = element.coefficient_matrix();
+  mdspan_t<const F, 2> coeffs(coeffs_b.data(), cshape);
+  const std::size_t ndofs = cshape[0];
+  const std::size_t nmodes = cshape[1];
+  assert(nmodes % psize == 0);
+  for (std::size_t c = 0; c < nmodes / psize; ++c)
+    _mode_degrees.insert(_mode_degrees.end(), poly_degrees.begin(),
+                         poly_degrees.end());
+
+  // The rows of the coefficient matrix are in the internal order of the
+  // DOFs
+  std::vector<std::size_t> perm(ndofs);
+  const std::vector<int>& dof_ordering = element.dof_ordering();
+  for (std::size_t r = 0; r < ndofs; ++r)
+    perm[r] = dof_ordering.empty() ? r : dof_ordering[r];
+
+  // The modal coefficients of basis function i are row i of the
+  // coefficient matrix
+  _nodal_to_modal = {std::vector<F>(nmodes * ndofs), {nmodes, ndofs}};
+  mdspan_t<F, 2> n2m(_nodal_to_modal.first.data(), nmodes, ndofs);
+  for (std::size_t r = 0; r < ndofs; ++r)
+    for (std::size_t m = 0; m < nmodes; ++m)
+      n2m(m, perm[r]) = coeffs(r, m);
+
+  // L2 projection: the DOFs of the projection of a modal expansion m are
+  // (C C^T)^{-1} C m, where C is the coefficient matrix
+  std::vector<F> CCt_b(ndofs * ndofs);
+  mdspan_t<F, 2> CCt(CCt_b.data(), ndofs, ndofs);
+  for (std::size_t i = 0; i < ndofs; ++i)
+  {
+    for (std::size_t j = 0; j < ndofs; ++j)
+    {
+      CCt(i, j) = 0;
+      for (std::size_t m = 0; m < nmodes; ++m)
+        CCt(i, j) += coeffs(i, m) * coeffs(j, m);
+    }
+  }
+  const std::vector<F> X_b = math::solve<F>(CCt, coeffs);
+  mdspan_t<const F, 2> X(X_b.data(), ndofs, nmodes);
+  _modal_to_nodal = {std::vector<F>(ndofs * nmodes), {ndofs, nmodes}};
+  mdspan_t<F, 2> m2n(_modal_to_nodal.first.data(), ndofs, nmodes);
+  for (std::size_t r = 0; r < ndofs; ++r)
+    for (std::size_t m = 0; m < nmodes; ++m)
+      m2n(perm[r], m) = X(r, m);
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+std::pair<std::vector<F>, std::array<std::size_t, 2>>
+ModalBasis<F>::filter_matrix(std::span<const F> sigma) const
+{
+  if (sigma.size() != static_cast<std::size_t>(_degree + 1))
+    throw std::runtime_error("Filter must have one factor for each degree.");
+
+  const std::size_t nmodes = _mode_degrees.size();
+  const std::size_t ndofs = _dim;
+  std::vector<F> S_b(ndofs * nmodes);
+  mdspan_t<F, 2> S(S_b.data(), ndofs, nmodes);
+  mdspan_t<const F, 2> m2n(_modal_to_nodal.first.data(), ndofs, nmodes);
+  for (std::size_t i = 0; i < ndofs; ++i)
+    for (std::size_t m = 0; m < nmodes; ++m)
+      S(i, m) = m2n(i, m) * sigma[_mode_degrees[m]];
+
+  std::pair<std::vector<F>, std::array<std::size_t, 2>> filter
+      = {std::vector<F>(ndofs * ndofs), {ndofs, ndofs}};
+  math::dot(S,
+            mdspan_t<const F, 2>(_nodal_to_modal.first.data(), nmodes,
+                                 ndofs),
+            mdspan_t<F, 2>(filter.first.data(), ndofs, ndofs));
+  return filter;
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+std::pair<std::vector<F>, std::array<std::size_t, 2>>
+ModalBasis<F>::exponential_filter(int order, F strength, int cutoff) const
+{
+  if (order < 1)
+    throw std::runtime_error("Filter order must be positive.");
+  if (cutoff < 0)
+    throw std::runtime_error("Filter cutoff must not be negative.");
+
+  std::vector<F> sigma(_degree + 1, 1);
+  for (int n = cutoff + 1; n <= _degree; ++n)
+  {
+    const F eta = static_cast<F>(n - cutoff) / (_degree - cutoff);
+    sigma[n] = std::exp(-strength * std::pow(eta, order));
+  }
+  return filter_matrix(sigma);
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+std::pair<std::vector<F>, std::array<std::size_t, 2>>
+ModalBasis<F>::cutoff_filter(int cutoff) const
+{
+  std::vector<F> sigma(_degree + 1, 0);
+  for (int n = 0; n <= std::min(cutoff, _degree); ++n)
+    sigma[n] = 1;
+  return filter_matrix(sigma);
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+void ModalBasis<F>::to_modal(mdspan_t<const F, 2> u, mdspan_t<F, 2> out) const
+{
+  apply_matrix(mdspan_t<const F, 2>(_nodal_to_modal.first.data(),
+                                    _nodal_to_modal.second),
+               u, out);
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+std::pair<std::vector<F>, std::array<std::size_t, 2>>
+ModalBasis<F>::to_modal(mdspan_t<const F, 2> u) const
+{
+  std::array<std::size_t, 2> shape = {u.extent(0), _mode_degrees.size()};
+  std::vector<F> m(shape[0] * shape[1]);
+  to_modal(u, mdspan_t<F, 2>(m.data(), shape));
+  return {std::move(m), shape};
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+void ModalBasis<F>::to_nodal(mdspan_t<const F, 2> m, mdspan_t<F, 2> out) const
+{
+  apply_matrix(mdspan_t<const F, 2>(_modal_to_nodal.first.data(),
+                                    _modal_to_nodal.second),
+               m, out);
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+std::pair<std::vector<F>, std::array<std::size_t, 2>>
+ModalBasis<F>::to_nodal(mdspan_t<const F, 2> m) const
+{
+  std::array<std::size_t, 2> shape
+      = {m.extent(0), static_cast<std::size_t>(_dim)};
+  std::vector<F> u(shape[0] * shape[1]);
+  to_nodal(m, mdspan_t<F, 2>(u.data(), shape));
+  return {std::move(u), shape};
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+void ModalBasis<F>::apply_filter(mdspan_t<const F, 2> filter,
+                                 mdspan_t<const F, 2> u,
+                                 mdspan_t<F, 2> out) const
+{
+  if (filter.extent(0) != static_cast<std::size_t>(_dim)
+      or filter.extent(1) != static_cast<std::size_t>(_dim))
+  {
+    throw std::runtime_error("Filter matrix has the wrong shape.");
+  }
+  apply_matrix(filter, u, out);
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+std::pair<std::vector<F>, std::array<std::size_t, 2>>
+ModalBasis<F>::modal_energy(mdspan_t<const F, 2> u) const
+{
+  const auto [m_b, mshape] = to_modal(u);
+  mdspan_t<const F, 2> m(m_b.data(), mshape);
+
+  std::array<std::size_t, 2> shape
+      = {u.extent(0), static_cast<std::size_t>(_degree + 1)};
+  std::vector<F> energy_b(shape[0] * shape[1], 0);
+  mdspan_t<F, 2> energy(energy_b.data(), shape);
+  for (std::size_t c = 0; c < m.extent(0); ++c)
+    for (std::size_t k = 0; k < m.extent(1); ++k)
+      energy(c, _mode_degrees[k]) += m(c, k) * m(c, k);
+
+  return {std::move(energy_b), shape};
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+std::vector<F>
+ModalBasis<F>::smoothness_indicator(mdspan_t<const F, 2> u) const
+{
+  const auto [energy_b, eshape] = modal_energy(u);
+  mdspan_t<const F, 2> energy(energy_b.data(), eshape);
+
+  std::vector<F> s(eshape[0]);
+  for (std::size_t c = 0; c < eshape[0]; ++c)
+  {
+    F total = 0;
+    for (std::size_t n = 0; n < eshape[1]; ++n)
+      total += energy(c, n);
+    s[c] = total > 0 ? std::log10(energy(c, _degree) / total)
+                     : -std::numeric_limits<F>::infinity();
+  }
+
+  return s;
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+std::vector<F> ModalBasis<F>::decay_rate(mdspan_t<const F, 2> u) const
+{
+  const auto [energy_b, eshape] = modal_energy(u);
+  mdspan_t<const F, 2> energy(energy_b.data(), eshape);
+
+  std::vector<F> rate(eshape[0]);
+  for (std::size_t c = 0; c < eshape[0]; ++c)
+  {
+    // Least squares fit of log(sqrt(E_n)) = a + b * log(n)
+    std::size_t npoints = 0;
+    F sx = 0, sy = 0, sxx = 0, sxy = 0;
+    for (std::size_t n = 1; n < eshape[1]; ++n)
+    {
+      if (energy(c, n) > 0)
+      {
+        const F x = std::log(static_cast<F>(n));
+        const F y = 0.5 * std::log(energy(c, n));
+        ++npoints;
+        sx += x;
+        sy += y;
+        sxx += x * x;
+        sxy += x * y;
+      }
+    }
+
+    if (npoints < 2)
+      rate[c] = std::numeric_limits<F>::quiet_NaN();
+    else
+      rate[c] = -(npoints * sxy - sx * sy) / (npoints * sxx - sx * sx);
+  }
+
+  return rate;
+}
+//-----------------------------------------------------------------------------
+
+/// @cond
+// Explicit instantiation for double and float
+template class basix::ModalBasis<float>;
+template class basix::ModalBasis<double>;
+/// @endcond
+//-----------------------------------------------------------------------------
@@ -0,0 +1,221 @@
+// Copyright (c) 2024 Basix contributors
+// FEniCS Project
+// SPDX-License-Identifier:    MIT
+
+#pragma once
+
+#include "finite-element.h"
+#include "mdspan.hpp"
+#include <array>
+#include <concepts>
+#include <span>
+#include <utility>
+#include <vector>
+
+/// Modal representations of finite element functions
+namespace basix
+{
+
+/// @brief The expansion of the basis of an element in the orthonormal
+/// polynomial set.
+///
+/// The modes of an element are the orthonormal polynomials of its
+/// polynomial set, one set for each value component. Mode `c * psize +
+/// k` is polynomial `k` in component `c`, where `psize` is the
+/// dimension of the polynomial set. The degree of a mode is the lowest
+/// degree of polynomial set that contains it, so on tensor product
+/// cells the degree of a mode is its highest degree in any direction.
+///
+/// The transfer operators between the nodal (DOF) and modal
+/// representations of a function are computed when the object is
+/// created, so a ModalBasis should be created once per element and
+/// reused. All operations on functions act on arrays of shape (number
+/// of cells, dim), where row `c` holds the DOFs of cell `c`.
+template <std::floating_point F>
+class ModalBasis
+{
+  template <typename T, std::size_t d>
+  using mdspan_t = MDSPAN_IMPL_STANDARD_NAMESPACE::mdspan<
+      T, MDSPAN_IMPL_STANDARD_NAMESPACE::dextents<std::size_t, d>>;
+
+public:
+  /// @brief Create the modal basis of an element.
+  /// @param[in] element The element. Elements on pyramids are not
+  /// supported.
+  explicit ModalBasis(const FiniteElement<F>& element);
+
+  /// Copy constructor
+  ModalBasis(const ModalBasis& basis) = default;
+
+  /// Move constructor
+  ModalBasis(ModalBasis&& basis) = default;
+
+  /// Destructor
+  ~ModalBasis() = default;
+
+  /// Assignment operator
+  ModalBasis& operator=(const ModalBasis& basis) = default;
+
+  /// Move assignment operator
+  ModalBasis& operator=(ModalBasis&& basis) = default;
+
+  /// @brief The number of DOFs of the element.
+  int dim() const { return _dim; }
+
+  /// @brief The number of modes.
+  int num_modes() const { return _mode_degrees.size(); }
+
+  /// @brief The highest degree of any mode.
+  int degree() const { return _degree; }
+
+  /// @brief The degree of each mode.
+  const std::vector<int>& mode_degrees() const { return _mode_degrees; }
+
+  /// @brief The matrix that maps the DOFs of a function to its modal
+  /// coefficients.
+  ///
+  /// The shape of the matrix is (num_modes, dim).
+  const std::pair<std::vector<F>, std::array<std::size_t, 2>>&
+  nodal_to_modal() const
+  {
+    return _nodal_to_modal;
+  }
+
+  /// @brief The matrix that maps modal coefficients to the DOFs of a
+  /// function.
+  ///
+  /// The modal coefficients are projected in L2 onto the element, so
+  /// `modal_to_nodal() * nodal_to_modal()` is the identity. The shape
+  /// of the matrix is (dim, num_modes).
+  const std::pair<std::vector<F>, std::array<std::size_t, 2>>&
+  modal_to_nodal() const
+  {
+    return _modal_to_nodal;
+  }
+
+  /// @brief Create a filter that scales the modes of each degree.
+  ///
+  /// The filter is the matrix `modal_to_nodal() * diag(s) *
+  /// nodal_to_modal()`, where `s` is the factor for the degree of each
+  /// mode.
+  ///
+  /// @param[in] sigma The factor for each degree. The size of sigma
+  /// must be `degree() + 1`.
+  /// @return The filter matrix, with shape (dim, dim), and its shape.
+  std::pair<std::vector<F>, std::array<std::size_t, 2>>
+  filter_matrix(std::span<const F> sigma) const;
+
+  /// @brief Create an exponential filter.
+  ///
+  /// Modes of degree `n` up to and including `cutoff` are unchanged,
+  /// and modes of higher degree are multiplied by `exp(-strength * ((n
+  /// - cutoff) / (N - cutoff))^order)`, where `N` is `degree()`.
+  ///
+  /// @param[in] order The order of the filter.
+  /// @param[in] strength The strength of the filter. A strength of
+  /// `-log(machine epsilon)` reduces the modes of the highest degree to
+  /// machine precision.
+  /// @param[in] cutoff The highest degree that is not filtered.
+  /// @return The filter matrix, with shape (dim, dim), and its shape.
+  std::pair<std::vector<F>, std::array<std::size_t, 2>>
+  exponential_filter(int order, F strength, int cutoff = 0) const;
+
+  /// @brief Create a filter that removes all modes of degree greater
+  /// than `cutoff`.
+  /// @param[in] cutoff The highest degree that is kept.
+  /// @return The filter matrix, with shape (dim, dim), and its shape.
+  std::pair<std::vector<F>, std::array<std::size_t, 2>>
+  cutoff_filter(int cutoff) const;
+
+  /// @brief Compute the modal coefficients of a set of functions.
+  /// @param[in] u The DOFs of the functions, with shape (number of
+  /// cells, dim).
+  /// @param[out] out The modal coefficients, with shape (number of
+  /// cells, num_modes).
+  void to_modal(mdspan_t<const F, 2> u, mdspan_t<F, 2> out) const;
+
+  /// @brief Compute the modal coefficients of a set of functions.
+  /// @param[in] u The DOFs of the functions, with shape (number of
+  /// cells, dim).
+  /// @return The modal coefficients, with shape (number of cells,
+  /// num_modes), and their shape.
+  std::pair<std::vector<F>, std::array<std::size_t, 2>>
+  to_modal(mdspan_t<const F, 2> u) const;
+
+  /// @brief Compute the DOFs of a set of functions from their modal
+  /// coefficients.
+  /// @param[in] m The modal coefficients, with shape (number of cells,
+  /// num_modes).
+  /// @param[out] out The DOFs, with shape (number of cells, dim).
+  void to_nodal(mdspan_t<const F, 2> m, mdspan_t<F, 2> out) const;
+
+  /// @brief Compute the DOFs of a set of functions from their modal
+  /// coefficients.
+  /// @param[in] m The modal coefficients, with shape (number of cells,
+  /// num_modes).
+  /// @return The DOFs, with shape (number of cells, dim), and their
+  /// shape.
+  std::pair<std::vector<F>, std::array<std::size_t, 2>>
+  to_nodal(mdspan_t<const F, 2> m) const;
+
+  /// @brief Apply a filter to a set of functions.
+  /// @param[in] filter A filter matrix, with shape (dim, dim).
+  /// @param[in] u The DOFs of the functions, with shape (number of
+  /// cells, dim).
+  /// @param[out] out The filtered DOFs, with shape (number of cells,
+  /// dim). `out` must not overlap with `u`.
+  void apply_filter(mdspan_t<const F, 2> filter, mdspan_t<const F, 2> u,
+                    mdspan_t<F, 2> out) const;
+
+  /// @brief Compute the energy of the modes of each degree.
+  ///
+  /// The energy of degree `n` is the sum of the squares of the modal
+  /// coefficients of degree `n`.
+  ///
+  /// @param[in] u The DOFs of the functions, with shape (number of
+  /// cells, dim).
+  /// @return The energies, with shape (number of cells, degree() + 1),
+  /// and their shape.
+  std::pair<std::vector<F>, std::array<std::size_t, 2>>
+  modal_energy(mdspan_t<const F, 2> u) const;
+
+  /// @brief Compute a smoothness indicator for a set of functions.
+  ///
+  /// The indicator of a function is `log10(E_N / E)`, where `E_N` is
+  /// the energy of the modes of the highest degree and `E` is the total
+  /// energy. It is `-inf` for a function that is zero.
+  ///
+  /// @param[in] u The DOFs of the functions, with shape (number of
+  /// cells, dim).
+  /// @return The indicator of each function.
+  std::vector<F> smoothness_indicator(mdspan_t<const F, 2> u) const;
+
+  /// @brief Estimate the rate at which the modal coefficients of a set
+  /// of functions decay.
+  ///
+  /// The rate is `-s`, where `s` is the slope of the least squares line
+  /// fit of `log(sqrt(E_n))` against `log(n)` for the degrees `n > 0`
+  /// that have a non-zero energy `E_n`. It is NaN if fewer than two
+  /// degrees have a non-zero energy.
+  ///
+  /// @param[in] u The DOFs of the functions, with shape (number of
+  /// cells, dim).
+  /// @return The decay rate of each function.
+  std::vector<F> decay_rate(mdspan_t<const F, 2> u) const;
+
+private:
+  // Number of DOFs
+  int _dim;
+
+  // Highest degree of any mode
+  int _degree;
+
+  // Degree of each mode
+  std::vector<int> _mode_degrees;
+
+  // Transfer operators, shape (num_modes, dim) and (dim, num_modes)
+  std::pair<std::vector<F>, std::array<std::size_t, 2>> _nodal_to_modal;
+  std::pair<std::vector<F>, std::array<std::size_t, 2>> _modal_to_nodal;
+};
+
+} // namespace basix
@@ -7,6 +7,10 @@
 #include "finite-element.h"
 #include "math.h"
 #include "quadrature.h"
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <numeric>
 
 using namespace basix;
 
@@ -49,11 +53,11 @@ std::vector<int> axis_points(const cell::type celltype)
 /// @param[in] celltype1 Sub-entity of `celltype0` type
 /// @param[in] x Coordinates defined on an entity of type `celltype1`
 /// @return (0) Coordinates of points in the full space of `celltype1`
-/// (the shape is (num_entities, num points per entity, tdim of
-/// celltype0) and (1) local axes on each entity (num_entities,
+/// for each entity (the shape of each is (num points per entity, tdim
+/// of celltype0)) and (1) local axes on each entity (num_entities,
 /// entity_dim, tdim).
 template <std::floating_point T>
-std::pair<std::vector<mdarray_t<T, 2>>, mdarray_t<T, 3>>
+std::pair<std::vector<std::vector<T>>, mdarray_t<T, 3>>
 map_points(const cell::type celltype0, const cell::type celltype1,
            mdspan_t<const T, 2> x)
 {
@@ -61,51 +65,160 @@ map_points(const cell::type celltype0, const cell::type celltype1,
   std::size_t entity_dim = cell::topological_dimension(celltype1);
   std::size_t num_entities = cell::num_sub_entities(celltype0, entity_dim);
 
-  std::vector<mdarray_t<T, 2>> p(num_entities,
-                                 mdarray_t<T, 2>(x.extent(0), tdim));
+  // Origin and axes of each entity. The axes of all the entities are
+  // stored side by side in A, with shape (entity_dim, num_entities *
+  // tdim), so that all the entities are mapped by a single product.
   mdarray_t<T, 3> axes(num_entities, entity_dim, tdim);
-
+  mdarray_t<T, 2> origin(num_entities, tdim);
+  mdarray_t<T, 2> A(entity_dim, num_entities * tdim);
   const std::vector<int> axis_pts = axis_points(celltype0);
   for (std::size_t e = 0; e < num_entities; ++e)
   {
-    // Get entity geometry
     const auto [entity_buffer, eshape]
         = cell::sub_entity_geometry<T>(celltype0, entity_dim, e);
     mdspan_t<const T, 2> entity_x(entity_buffer.data(), eshape);
-
-    // Axes on the cell entity
-    for (std::size_t i = 0; i < axes.extent(1); ++i)
-      for (std::size_t j = 0; j < axes.extent(2); ++j)
+    for (std::size_t j = 0; j < tdim; ++j)
+      origin(e, j) = entity_x(0, j);
+    for (std::size_t i = 0; i < entity_dim; ++i)
+    {
+      for (std::size_t j = 0; j < tdim; ++j)
+      {
         axes(e, i, j) = entity_x(axis_pts[i], j) - entity_x(0, j);
+        A(i, e * tdim + j) = axes(e, i, j);
+      }
+    }
+  }
+
+  // Compute x = x0 + \Delta x
+  mdarray_t<T, 2> dx(x.extent(0), num_entities * tdim);
+  math::dot(x, A.to_mdspan(), dx.to_mdspan());
+
+  std::vector<std::vector<T>> p(num_entities,
+                                std::vector<T>(x.extent(0) * tdim));
+  for (std::size_t e = 0; e < num_entities; ++e)
+  {
+    mdspan_t<T, 2> _p(p[e].data(), x.extent(0), tdim);
+    for (std::size_t i = 0; i < _p.extent(0); ++i)
+      for (std::size_t j = 0; j < _p.extent(1); ++j)
+        _p(i, j) = origin(e, j) + dx(i, e * tdim + j);
+  }
+
+  return {std::move(p), std::move(axes)};
+}
+//----------------------------------------------------------------------------
+
+/// Quadrature on the entity type of a moment space, and the moment
+/// space tabulated at the quadrature points
+template <std::floating_point T>
+struct moment_space_table
+{
+  /// Quadrature points, shape (npoints, entity_dim)
+  std::vector<T> pts;
+
+  /// Quadrature weights
+  std::vector<T> wts;
 
-    // Compute x = x0 + \Delta x
-    std::vector<T> axes_b(axes.extent(1) * axes.extent(2));
-    mdspan_t<T, 2> axes_e(axes_b.data(), axes.extent(1), axes.extent(2));
-    for (std::size_t i = 0; i < axes_e.extent(0); ++i)
-      for (std::size_t j = 0; j < axes_e.extent(1); ++j)
-        axes_e(i, j) = axes(e, i, j);
+  /// Tabulated moment space, shape (1, npoints, ndofs, value_size)
+  std::vector<T> phi;
+  std::array<std::size_t, 4> phishape;
 
-    std::vector<T> dxbuffer(x.extent(0) * axes_e.extent(1));
-    mdspan_t<T, 2> dx(dxbuffer.data(), x.extent(0), axes_e.extent(1));
-    math::dot(x, axes_e, dx);
+  /// The quadrature points
+  mdspan_t<const T, 2> points() const
+  {
+    return mdspan_t<const T, 2>(pts.data(), wts.size(),
+                                pts.size() / wts.size());
+  }
 
-    for (std::size_t i = 0; i < p[e].extent(0); ++i)
-      for (std::size_t j = 0; j < p[e].extent(1); ++j)
-        p[e](i, j) = entity_x(0, j) + dx(i, j);
+  /// The tabulated moment space
+  mdspan_t<const T, 4> table() const
+  {
+    return mdspan_t<const T, 4>(phi.data(), phishape);
   }
+};
 
-  return {p, axes};
+/// Create a quadrature rule on the entity type of the moment space V
+/// that integrates the moment space against polynomials of type ptype
+/// on celltype exactly to degree q_deg, and tabulate V at its points.
+/// This is done once for all the entities of the cell.
+template <std::floating_point T>
+moment_space_table<T> tabulate_moment_space(const FiniteElement<T>& V,
+                                            cell::type celltype,
+                                            polyset::type ptype, int q_deg)
+{
+  const cell::type sub_celltype = V.cell_type();
+  auto [pts, wts] = quadrature::make_quadrature<T>(
+      quadrature::type::Default, sub_celltype,
+      polyset::superset(sub_celltype, V.polyset_type(),
+                        polyset::restriction(ptype, celltype, sub_celltype)),
+      q_deg);
+  mdspan_t<const T, 2> x(pts.data(), wts.size(), pts.size() / wts.size());
+  auto [phi, phishape] = V.tabulate(0, x);
+  return {std::move(pts), std::move(wts), std::move(phi), phishape};
 }
 //----------------------------------------------------------------------------
-} // namespace
 
-//-----------------------------------------------------------------------------
+/// The output of the functions that make moments
 template <std::floating_point T>
-std::tuple<std::vector<std::vector<T>>, std::array<std::size_t, 2>,
-           std::vector<std::vector<T>>, std::array<std::size_t, 4>>
-moments::make_integral_moments(const FiniteElement<T>& V, cell::type celltype,
-                               polyset::type ptype, std::size_t value_size,
-                               int q_deg)
+using moments_t
+    = std::tuple<std::vector<std::vector<T>>, std::array<std::size_t, 2>,
+                 std::vector<std::vector<T>>, std::array<std::size_t, 4>>;
+
+/// The kinds of moment
+enum class moment_kind
+{
+  integral,
+  dot,
+  tangent,
+  normal
+};
+
+/// The key of a set of cached moments: the kind, the fingerprint of
+/// the moment space, the cell type, the polyset type, the value size
+/// and the quadrature degree
+using moment_key = std::tuple<moment_kind, std::uint64_t, cell::type,
+                              polyset::type, std::size_t, int>;
+
+/// Moments that have been computed. The fingerprint of an element
+/// includes its scalar type, but the moments are stored by type so
+/// that they can be returned without conversion.
+template <std::floating_point T>
+struct moment_cache
+{
+  std::mutex mutex;
+  std::map<moment_key, moments_t<T>> moments;
+};
+
+template <std::floating_point T>
+moment_cache<T>& cache()
+{
+  static moment_cache<T> c;
+  return c;
+}
+//----------------------------------------------------------------------------
+
+/// Return the moments with the given key from the cache, or compute
+/// them with make() and add them to the cache. The moments are
+/// computed without holding the lock, so two threads may compute the
+/// same moments; the first result is kept.
+template <std::floating_point T, typename Fn>
+moments_t<T> cached_moments(const moment_key& key, Fn make)
+{
+  moment_cache<T>& c = cache<T>();
+  {
+    std::lock_guard lock(c.mutex);
+    if (auto it = c.moments.find(key); it != c.moments.end())
+      return it->second;
+  }
+
+  moments_t<T> m = make();
+  std::lock_guard lock(c.mutex);
+  return c.moments.try_emplace(key, std::move(m)).first->second;
+}
+//----------------------------------------------------------------------------
+template <std::floating_point T>
+moments_t<T> integral_moments(const FiniteElement<T>& V, cell::type celltype,
+                              polyset::type ptype, std::size_t value_size,
+                              int q_deg)
 {
   const cell::type sub_celltype = V.cell_type();
   const std::size_t entity_dim = cell::topological_dimension(sub_celltype);
@@ -113,20 +226,15 @@ moments::make_integral_moments(const FiniteElement<T>& V, cell::type celltype,
     throw std::runtime_error("Cannot integrate over a dimension 0 entity.");
   const std::size_t num_entities = cell::num_sub_entities(celltype, entity_dim);
 
-  // Get the quadrature points and weights
-  const auto [_pts, wts] = quadrature::make_quadrature<T>(
-      quadrature::type::Default, sub_celltype,
-      polyset::superset(sub_celltype, V.polyset_type(),
-                        polyset::restriction(ptype, celltype, sub_celltype)),
-      q_deg);
-  mdspan_t<const T, 2> pts(_pts.data(), wts.size(), _pts.size() / wts.size());
-
   // Evaluate moment space at quadrature points
   assert(std::accumulate(V.value_shape().begin(), V.value_shape().end(), 1,
                          std::multiplies{})
          == 1);
-  const auto [phib, phishape] = V.tabulate(0, pts);
-  mdspan_t<const T, 4> phi(phib.data(), phishape);
+  const moment_space_table<T> space
+      = tabulate_moment_space(V, celltype, ptype, q_deg);
+  mdspan_t<const T, 2> pts = space.points();
+  mdspan_t<const T, 4> phi = space.table();
+  const std::vector<T>& wts = space.wts;
 
   // Pad out \phi moment is against a vector-valued function
   const std::size_t vdim = value_size == 1 ? 1 : entity_dim;
@@ -142,7 +250,7 @@ moments::make_integral_moments(const FiniteElement<T>& V, cell::type celltype,
   std::vector<mdspan_t<T, 4>> D;
 
   // Map quadrature points onto facet (cell entity e)
-  const auto [points, axes] = map_points(celltype, sub_celltype, pts);
+  auto [pb, axes] = map_points(celltype, sub_celltype, pts);
 
   // -- Compute entity integral moments
 
@@ -184,38 +292,28 @@ moments::make_integral_moments(const FiniteElement<T>& V, cell::type celltype,
   }
 
   const std::array<std::size_t, 2> pshape
-      = {points.front().extent(0), points.front().extent(1)};
-  std::vector<std::vector<T>> pb;
-  for (const mdarray_t<T, 2>& p : points)
-    pb.emplace_back(p.data(), p.data() + p.size());
-
-  return {pb, pshape, Db, Dshape};
+      = {pts.extent(0), axes.extent(2)};
+  return {std::move(pb), pshape, std::move(Db), Dshape};
 }
 //----------------------------------------------------------------------------
 template <std::floating_point T>
-std::tuple<std::vector<std::vector<T>>, std::array<std::size_t, 2>,
-           std::vector<std::vector<T>>, std::array<std::size_t, 4>>
-moments::make_dot_integral_moments(const FiniteElement<T>& V,
-                                   cell::type celltype, polyset::type ptype,
-                                   std::size_t value_size, int q_deg)
+moments_t<T> dot_integral_moments(const FiniteElement<T>& V,
+                                  cell::type celltype, polyset::type ptype,
+                                  std::size_t value_size, int q_deg)
 {
   const cell::type sub_celltype = V.cell_type();
   const std::size_t entity_dim = cell::topological_dimension(sub_celltype);
   const std::size_t num_entities = cell::num_sub_entities(celltype, entity_dim);
 
-  const auto [_pts, wts] = quadrature::make_quadrature<T>(
-      quadrature::type::Default, sub_celltype,
-      polyset::superset(sub_celltype, V.polyset_type(),
-                        polyset::restriction(ptype, celltype, sub_celltype)),
-      q_deg);
-  mdspan_t<const T, 2> pts(_pts.data(), wts.size(), _pts.size() / wts.size());
-
   // If this is always true, value_size input can be removed
   assert(std::size_t(cell::topological_dimension(celltype)) == value_size);
 
   // Evaluate moment space at quadrature points
-  const auto [phib, phishape] = V.tabulate(0, pts);
-  mdspan_t<const T, 4> phi(phib.data(), phishape);
+  const moment_space_table<T> space
+      = tabulate_moment_space(V, celltype, ptype, q_deg);
+  mdspan_t<const T, 2> pts = space.points();
+  mdspan_t<const T, 4> phi = space.table();
+  const std::vector<T>& wts = space.wts;
   assert(phi.extent(3) == entity_dim);
 
   // Note:
@@ -224,7 +322,7 @@ moments::make_dot_integral_moments(const FiniteElement<T>& V,
   // Value size of the moment function: phi.extent(2)
 
   // Map quadrature points onto facet (cell entity e)
-  const auto [points, axes] = map_points(celltype, sub_celltype, pts);
+  auto [pb, axes] = map_points(celltype, sub_celltype, pts);
 
   // Shape (num dofs, value size, num points)
   const std::array<std::size_t, 4> Dshape
@@ -261,20 +359,14 @@ moments::make_dot_integral_moments(const FiniteElement<T>& V,
   }
 
   const std::array<std::size_t, 2> pshape
-      = {points.front().extent(0), points.front().extent(1)};
-  std::vector<std::vector<T>> pb;
-  for (const mdarray_t<T, 2>& p : points)
-    pb.emplace_back(p.data(), p.data() + p.size());
-
-  return {pb, pshape, Db, Dshape};
+      = {pts.extent(0), axes.extent(2)};
+  return {std::move(pb), pshape, std::move(Db), Dshape};
 }
 //----------------------------------------------------------------------------
 template <std::floating_point T>
-std::tuple<std::vector<std::vector<T>>, std::array<std::size_t, 2>,
-           std::vector<std::vector<T>>, std::array<std::size_t, 4>>
-moments::make_tangent_integral_moments(const FiniteElement<T>& V,
-                                       cell::type celltype, polyset::type ptype,
-                                       std::size_t value_size, int q_deg)
+moments_t<T> tangent_integral_moments(const FiniteElement<T>& V,
+                                      cell::type celltype, polyset::type ptype,
+                                      std::size_t value_size, int q_deg)
 {
   const cell::type sub_celltype = V.cell_type();
   const std::size_t entity_dim = cell::topological_dimension(sub_celltype);
@@ -287,22 +379,21 @@ moments::make_tangent_integral_moments(const FiniteElement<T>& V,
   if (entity_dim != 1)
     throw std::runtime_error("Tangent is only well-defined on an edge.");
 
-  const auto [_pts, wts] = quadrature::make_quadrature<T>(
-      quadrature::type::Default, cell::type::interval,
-      polyset::superset(sub_celltype, V.polyset_type(),
-                        polyset::restriction(ptype, celltype, sub_celltype)),
-      q_deg);
-  mdspan_t<const T, 2> pts(_pts.data(), wts.size(), _pts.size() / wts.size());
-
   // Evaluate moment space at quadrature points
   assert(std::accumulate(V.value_shape().begin(), V.value_shape().end(), 1,
                          std::multiplies{})
          == 1);
-  const auto [phib, phishape] = V.tabulate(0, pts);
-  mdspan_t<const T, 4> phi(phib.data(), phishape);
-
+  const moment_space_table<T> space
+      = tabulate_moment_space(V, celltype, ptype, q_deg);
+  mdspan_t<const T, 2> pts = space.points();
+  mdspan_t<const T, 4> phi = space.table();
+  const std::vector<T>& wts = space.wts;
+
+  // Map quadrature points onto the edges. The axis of each edge is its
+  // tangent. There is no need to normalise the tangent, as the size of
+  // this is equal to the integral Jacobian.
+  auto [pb, tangents] = map_points(celltype, sub_celltype, pts);
   const std::array<std::size_t, 2> pshape = {pts.extent(0), tdim};
-  std::vector<std::vector<T>> pb;
 
   const std::array<std::size_t, 4> Dshape
       = {phi.extent(2), value_size, phi.extent(1), 1};
@@ -314,42 +405,23 @@ moments::make_tangent_integral_moments(const FiniteElement<T>& V,
   // Iterate over cell entities
   for (std::size_t e = 0; e < num_entities; ++e)
   {
-    const auto [ebuffer, eshape] = cell::sub_entity_geometry<T>(celltype, 1, e);
-    mdspan_t<const T, 2> edge_x(ebuffer.data(), eshape);
-
-    std::vector<T> tangent(edge_x.extent(1));
-    for (std::size_t i = 0; i < edge_x.extent(1); ++i)
-      tangent[i] = edge_x(1, i) - edge_x(0, i);
-
-    // No need to normalise the tangent, as the size of this is equal to
-    // the integral Jacobian
-
-    // Map quadrature points onto triangle edge
-    auto& _pb = pb.emplace_back(pshape[0] * pshape[1]);
-    mdspan_t<T, 2> _p(_pb.data(), pshape);
-    for (std::size_t i = 0; i < pts.extent(0); ++i)
-      for (std::size_t j = 0; j < _p.extent(1); ++j)
-        _p(i, j) = edge_x(0, j) + pts(i, 0) * tangent[j];
-
     // Compute edge tangent integral moments
     mdspan_t<T, 4>& _D = D.emplace_back(Db[e].data(), Dshape);
     for (std::size_t i = 0; i < phi.extent(2); ++i)
     {
       for (std::size_t j = 0; j < value_size; ++j)
         for (std::size_t k = 0; k < wts.size(); ++k)
-          _D(i, j, k, 0) = phi(0, k, i, 0) * wts[k] * tangent[j];
+          _D(i, j, k, 0) = phi(0, k, i, 0) * wts[k] * tangents(e, 0, j);
     }
   }
 
-  return {pb, pshape, Db, Dshape};
+  return {std::move(pb), pshape, std::move(Db), Dshape};
 }
 //----------------------------------------------------------------------------
 template <std::floating_point T>
-std::tuple<std::vector<std::vector<T>>, std::array<std::size_t, 2>,
-           std::vector<std::vector<T>>, std::array<std::size_t, 4>>
-moments::make_normal_integral_moments(const FiniteElement<T>& V,
-                                      cell::type celltype, polyset::type ptype,
-                                      std::size_t value_size, int q_deg)
+moments_t<T> normal_integral_moments(const FiniteElement<T>& V,
+                                     cell::type celltype, polyset::type ptype,
+                                     std::size_t value_size, int q_deg)
 {
   const std::size_t tdim = cell::topological_dimension(celltype);
   assert(tdim == value_size);
@@ -359,25 +431,23 @@ moments::make_normal_integral_moments(const FiniteElement<T>& V,
 
   if (static_cast<int>(entity_dim) != static_cast<int>(tdim) - 1)
     throw std::runtime_error("Normal is only well-defined on a facet.");
-
-  // Compute quadrature points for evaluating integral
-  const auto [_pts, wts] = quadrature::make_quadrature<T>(
-      quadrature::type::Default, sub_celltype,
-      polyset::superset(sub_celltype, V.polyset_type(),
-                        polyset::restriction(ptype, celltype, sub_celltype)),
-      q_deg);
-  mdspan_t<const T, 2> pts(_pts.data(), wts.size(), _pts.size() / wts.size());
+  if (tdim != 2 and tdim != 3)
+    throw std::runtime_error("Normal on this cell cannot be computed.");
 
   // Evaluate moment space at quadrature points
   assert(std::accumulate(V.value_shape().begin(), V.value_shape().end(), 1,
                          std::multiplies{})
          == 1);
-  const auto [phib, phishape] = V.tabulate(0, pts);
-  mdspan_t<const T, 4> phi(phib.data(), phishape);
-
-  // Storage for coordinates of evaluations points in the reference cell
+  const moment_space_table<T> space
+      = tabulate_moment_space(V, celltype, ptype, q_deg);
+  mdspan_t<const T, 2> pts = space.points();
+  mdspan_t<const T, 4> phi = space.table();
+  const std::vector<T>& wts = space.wts;
+
+  // Map quadrature points onto the facets, and compute the coordinates
+  // of evaluations points in the reference cell
+  auto [pb, axes] = map_points(celltype, sub_celltype, pts);
   const std::array<std::size_t, 2> pshape = {pts.extent(0), tdim};
-  std::vector<std::vector<T>> pb;
 
   // Storage for interpolation matrix
   const std::array<std::size_t, 4> Dshape
@@ -387,49 +457,20 @@ moments::make_normal_integral_moments(const FiniteElement<T>& V,
   std::vector<std::vector<T>> Db(num_entities, std::vector<T>(size));
   std::vector<mdspan_t<T, 4>> D;
 
-  // Evaluate moment space at quadrature points
-
   // Iterate over cell entities
   std::array<T, 3> normal;
   for (std::size_t e = 0; e < num_entities; ++e)
   {
-    // Map quadrature points onto facet (cell entity e)
-    const auto [ebuffer, eshape]
-        = cell::sub_entity_geometry<T>(celltype, tdim - 1, e);
-    mdspan_t<const T, 2> facet_x(ebuffer.data(), eshape);
-
-    auto& _pb = pb.emplace_back(pshape[0] * pshape[1]);
-    mdspan_t<T, 2> _p(_pb.data(), pshape);
+    // No need to normalise the normal, as the size of this is equal to
+    // the integral Jacobian
     if (tdim == 2)
+      normal = {-axes(e, 0, 1), axes(e, 0, 0), 0.0};
+    else
     {
-      // No need to normalise the normal, as the size of this is equal
-      // to the integral jacobian
-      std::array<T, 2> tangent
-          = {facet_x(1, 0) - facet_x(0, 0), facet_x(1, 1) - facet_x(0, 1)};
-      for (std::size_t p = 0; p < _p.extent(0); ++p)
-        for (std::size_t i = 0; i < _p.extent(1); ++i)
-          _p(p, i) = facet_x(0, i) + pts(p, 0) * tangent[i];
-
-      normal = {-tangent[1], tangent[0], 0.0};
-    }
-    else if (tdim == 3)
-    {
-      // No need to normalise the normal, as the size of this is equal
-      // to the integral Jacobian
-      std::array<T, 3> t0
-          = {facet_x(1, 0) - facet_x(0, 0), facet_x(1, 1) - facet_x(0, 1),
-             facet_x(1, 2) - facet_x(0, 2)};
-      std::array<T, 3> t1
-          = {facet_x(2, 0) - facet_x(0, 0), facet_x(2, 1) - facet_x(0, 1),
-             facet_x(2, 2) - facet_x(0, 2)};
-      for (std::size_t p = 0; p < _p.extent(0); ++p)
-        for (std::size_t i = 0; i < _p.extent(1); ++i)
-          _p(p, i) = facet_x(0, i) + pts(p, 0) * t0[i] + pts(p, 1) * t1[i];
-
+      std::array<T, 3> t0 = {axes(e, 0, 0), axes(e, 0, 1), axes(e, 0, 2)};
+      std::array<T, 3> t1 = {axes(e, 1, 0), axes(e, 1, 1), axes(e, 1, 2)};
       normal = math::cross(t0, t1);
     }
-    else
-      throw std::runtime_error("Normal on this cell cannot be computed.");
 
     // Compute facet normal integral moments
     mdspan_t<T, 4>& _D = D.emplace_back(Db[e].data(), Dshape);
@@ -439,7 +480,80 @@ moments::make_normal_integral_moments(const FiniteElement<T>& V,
           _D(i, j, k, 0) = phi(0, k, i, 0) * wts[k] * normal[j];
   }
 
-  return {pb, pshape, Db, Dshape};
+  return {std::move(pb), pshape, std::move(Db), Dshape};
+}
+//----------------------------------------------------------------------------
+} // namespace
+
+//-----------------------------------------------------------------------------
+template <std::floating_point T>
+std::tuple<std::vector<std::vector<T>>, std::array<std::size_t, 2>,
+           std::vector<std::vector<T>>, std::array<std::size_t, 4>>
+moments::make_integral_moments(const FiniteElement<T>& V, cell::type celltype,
+                               polyset::type ptype, std::size_t value_size,
+                               int q_deg)
+{
+  return cached_moments<T>(
+      {moment_kind::integral, V.fingerprint(), celltype, ptype, value_size,
+       q_deg},
+      [&] { return integral_moments(V, celltype, ptype, value_size, q_deg); });
+}
+//----------------------------------------------------------------------------
+template <std::floating_point T>
+std::tuple<std::vector<std::vector<T>>, std::array<std::size_t, 2>,
+           std::vector<std::vector<T>>, std::array<std::size_t, 4>>
+moments::make_dot_integral_moments(const FiniteElement<T>& V,
+                                   cell::type celltype, polyset::type ptype,
+                                   std::size_t value_size, int q_deg)
+{
+  return cached_moments<T>(
+      {moment_kind::dot, V.fingerprint(), celltype, ptype, value_size, q_deg},
+      [&]
+      { return dot_integral_moments(V, celltype, ptype, value_size, q_deg); });
+}
+//----------------------------------------------------------------------------
+template <std::floating_point T>
+std::tuple<std::vector<std::vector<T>>, std::array<std::size_t, 2>,
+           std::vector<std::vector<T>>, std::array<std::size_t, 4>>
+moments::make_tangent_integral_moments(const FiniteElement<T>& V,
+                                       cell::type celltype, polyset::type ptype,
+                                       std::size_t value_size, int q_deg)
+{
+  return cached_moments<T>(
+      {moment_kind::tangent, V.fingerprint(), celltype, ptype, value_size,
+       q_deg},
+      [&]
+      {
+        return tangent_integral_moments(V, celltype, ptype, value_size, q_deg);
+      });
+}
+//----------------------------------------------------------------------------
+template <std::floating_point T>
+std::tuple<std::vector<std::vector<T>>, std::array<std::size_t, 2>,
+           std::vector<std::vector<T>>, std::array<std::size_t, 4>>
+moments::make_normal_integral_moments(const FiniteElement<T>& V,
+                                      cell::type celltype, polyset::type ptype,
+                                      std::size_t value_size, int q_deg)
+{
+  return cached_moments<T>(
+      {moment_kind::normal, V.fingerprint(), celltype, ptype, value_size,
+       q_deg},
+      [&]
+      {
+        return normal_integral_moments(V, celltype, ptype, value_size, q_deg);
+      });
+}
+//----------------------------------------------------------------------------
+void moments::clear_cache()
+{
+  {
+    std::lock_guard lock(cache<float>().mutex);
+    cache<float>().moments.clear();
+  }
+  {
+    std::lock_guard lock(cache<double>().mutex);
+    cache<double>().moments.clear();
+  }
 }
 //----------------------------------------------------------------------------
 /// @cond
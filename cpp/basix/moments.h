@@ -130,5 +130,15 @@ make_normal_integral_moments(const FiniteElement<T>& V, cell::type celltype,
                              polyset::type ptype, std::size_t value_size,
                              int q_deg);
 
+/// @brief Clear the cache of moments.
+///
+/// The moments made by the functions in this namespace are cached, and
+/// are reused when the same moments are made again, for example when
+/// several elements are created that use the same moment space. The
+/// moments are identified by the fingerprint of the moment space and
+/// the other arguments. The memory used by the cache is held until this
+/// function is called, which frees it.
+void clear_cache();
+
 } // namespace moments
 } // namespace basix
@@ -3221,80 +3221,6 @@ polyset::tabulate(
         MDSPAN_IMPL_STANDARD_NAMESPACE::dextents<std::size_t, 2>>);
 /// @endcond
 //-----------------------------------------------------------------------------
-int polyset::dim(cell::type celltype, polyset::type ptype, int d)
-{
-  switch (ptype)
-  {
-  case polyset::type::standard:
-    switch (celltype)
-    {
-    case cell::type::point:
-      return 1;
-    case cell::type::triangle:
-      return (d + 1) * (d + 2) / 2;
-    case cell::type::tetrahedron:
-      return (d + 1) * (d + 2) * (d + 3) / 6;
-    case cell::type::prism:
-      return (d + 1) * (d + 1) * (d + 2) / 2;
-    case cell::type::pyramid:
-      return (d + 1) * (d + 2) * (2 * d + 3) / 6;
-    case cell::type::interval:
-      return (d + 1);
-    case cell::type::quadrilateral:
-      return (d + 1) * (d + 1);
-    case cell::type::hexahedron:
-      return (d + 1) * (d + 1) * (d + 1);
-    default:
-      return 1;
-    }
-  case polyset::type::macroedge:
-    switch (celltype)
-    {
-    case cell::type::point:
-      return 1;
-    case cell::type::interval:
-      return 2 * d + 1;
-    case cell::type::triangle:
-      return (d + 1) * (2 * d + 1);
-    case cell::type::tetrahedron:
-      return (d + 1) * (2 * d + 1) * (2 * d + 3) / 3;
-    case cell::type::quadrilateral:
-      return (2 * d + 1) * (2 * d + 1);
-    case cell::type::hexahedron:
-      return (2 * d + 1) * (2 * d + 1) * (2 * d + 1);
-    default:
-      return 1;
-    }
-  default:
-    return 1;
-  }
-}
-//-----------------------------------------------------------------------------
-int polyset::nderivs(cell::type celltype, int n)
-{
-  switch (celltype)
-  {
-  case cell::type::point:
-    return 1;
-  case cell::type::interval:
-    return n + 1;
-  case cell::type::triangle:
-    return (n + 1) * (n + 2) / 2;
-  case cell::type::quadrilateral:
-    return (n + 1) * (n + 2) / 2;
-  case cell::type::tetrahedron:
-    return (n + 1) * (n + 2) * (n + 3) / 6;
-  case cell::type::hexahedron:
-    return (n + 1) * (n + 2) * (n + 3) / 6;
-  case cell::type::prism:
-    return (n + 1) * (n + 2) * (n + 3) / 6;
-  case cell::type::pyramid:
-    return (n + 1) * (n + 2) * (n + 3) / 6;
-  default:
-    return 1;
-  }
-}
-//-----------------------------------------------------------------------------
 polyset::type polyset::superset(cell::type, polyset::type type1,
                                 polyset::type type2)
 {
@@ -240,7 +240,54 @@ void tabulate(
 /// @param[in] d The polynomial degree
 /// @return The number of terms in the basis spanning a space of
 /// polynomial degree @p d
-int dim(cell::type cell, polyset::type ptype, int d);
+constexpr int dim(cell::type cell, polyset::type ptype, int d)
+{
+  switch (ptype)
+  {
+  case polyset::type::standard:
+    switch (cell)
+    {
+    case cell::type::point:
+      return 1;
+    case cell::type::triangle:
+      return (d + 1) * (d + 2) / 2;
+    case cell::type::tetrahedron:
+      return (d + 1) * (d + 2) * (d + 3) / 6;
+    case cell::type::prism:
+      return (d + 1) * (d + 1) * (d + 2) / 2;
+    case cell::type::pyramid:
+      return (d + 1) * (d + 2) * (2 * d + 3) / 6;
+    case cell::type::interval:
+      return (d + 1);
+    case cell::type::quadrilateral:
+      return (d + 1) * (d + 1);
+    case cell::type::hexahedron:
+      return (d + 1) * (d + 1) * (d + 1);
+    default:
+      return 1;
+    }
+  case polyset::type::macroedge:
+    switch (cell)
+    {
+    case cell::type::point:
+      return 1;
+    case cell::type::interval:
+      return 2 * d + 1;
+    case cell::type::triangle:
+      return (d + 1) * (2 * d + 1);
+    case cell::type::tetrahedron:
+      return (d + 1) * (2 * d + 1) * (2 * d + 3) / 3;
+    case cell::type::quadrilateral:
+      return (2 * d + 1) * (2 * d + 1);
+    case cell::type::hexahedron:
+      return (2 * d + 1) * (2 * d + 1) * (2 * d + 1);
+    default:
+      return 1;
+    }
+  default:
+    return 1;
+  }
+}
 
 /// @brief Number of derivatives that the orthonormal basis will have on
 /// the given cell.
@@ -248,7 +295,30 @@ int dim(cell::type cell, polyset::type ptype, int d);
 /// @param[in] d The highest derivative order
 /// @return The number of derivatives
 /// polynomial degree @p d
-int nderivs(cell::type cell, int d);
+constexpr int nderivs(cell::type cell, int d)
+{
+  switch (cell)
+  {
+  case cell::type::point:
+    return 1;
+  case cell::type::interval:
+    return d + 1;
+  case cell::type::triangle:
+    return (d + 1) * (d + 2) / 2;
+  case cell::type::quadrilateral:
+    return (d + 1) * (d + 2) / 2;
+  case cell::type::tetrahedron:
+    return (d + 1) * (d + 2) * (d + 3) / 6;
+  case cell::type::hexahedron:
+    return (d + 1) * (d + 2) * (d + 3) / 6;
+  case cell::type::prism:
+    return (d + 1) * (d + 2) * (d + 3) / 6;
+  case cell::type::pyramid:
+    return (d + 1) * (d + 2) * (d + 3) / 6;
+  default:
+    return 1;
+  }
+}
 
 /// @brief Get the polyset types that is a superset of two types on the given
 /// cell
@@ -0,0 +1,558 @@
+// Copyright (c) 2024 Basix contributors
+// FEniCS Project
+// SPDX-License-Identifier:    MIT
+
+#pragma once
+
+#include "cell.h"
+#include "element-families.h"
+#include "finite-element.h"
+#include "mdspan.hpp"
+#include "polyset.h"
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace basix
+{
+
+namespace impl
+{
+/// @private Number of DOFs of an element that is fixed at compile time
+constexpr int static_dim(cell::type celltype, element::family family,
+                         int degree)
+{
+  const int k = degree;
+  switch (family)
+  {
+  case element::family::P:
+    return polyset::dim(celltype, polyset::type::standard, degree);
+  case element::family::RT:
+    switch (celltype)
+    {
+    case cell::type::triangle:
+      return k * (k + 2);
+    case cell::type::tetrahedron:
+      return k * (k + 1) * (k + 3) / 2;
+    case cell::type::quadrilateral:
+      return 2 * k * (k + 1);
+    case cell::type::hexahedron:
+      return 3 * k * k * (k + 1);
+    default:
+      throw std::runtime_error("Unsupported cell type");
+    }
+  case element::family::N1E:
+    switch (celltype)
+    {
+    case cell::type::triangle:
+      return k * (k + 2);
+    case cell::type::tetrahedron:
+      return k * (k + 2) * (k + 3) / 2;
+    case cell::type::quadrilateral:
+      return 2 * k * (k + 1);
+    case cell::type::hexahedron:
+      return 3 * k * (k + 1) * (k + 1);
+    default:
+      throw std::runtime_error("Unsupported cell type");
+    }
+  default:
+    throw std::runtime_error("Family not supported by StaticElement");
+  }
+}
+
+/// @private Value size of an element that is fixed at compile time
+constexpr int static_value_size(cell::type celltype, element::family family)
+{
+  return family == element::family::P ? 1
+                                      : cell::topological_dimension(celltype);
+}
+
+/// @private The data of a StaticElement, held in arrays of the sizes
+/// used by the element. See StaticElement::tables.
+template <std::floating_point T>
+struct static_element_data
+{
+  std::vector<T> coeffs;
+  std::vector<int> entity_dofs_offsets;
+  std::vector<int> entity_dofs;
+  std::array<int, 3> entity_size = {0, 0, 0};
+  std::vector<T> edge_reflection;
+  std::vector<T> triangle;
+  std::vector<T> quadrilateral;
+  bool transformations_are_identity;
+};
+
+/// @private Compute the data of a StaticElement from a runtime element.
+/// This is used by StaticElement and by codegen::static_element_tables.
+template <std::floating_point T>
+static_element_data<T> compute_static_element_data(const FiniteElement<T>& e)
+{
+  if (e.polyset_type() != polyset::type::standard)
+    throw std::runtime_error("StaticElement needs a standard polyset.");
+  if (!e.dof_ordering().empty())
+    throw std::runtime_error("StaticElement does not support dof ordering.");
+
+  static_element_data<T> t;
+  t.coeffs = e.coefficient_matrix().first;
+  t.entity_dofs_offsets.push_back(0);
+  for (auto& edofs_d : e.entity_dofs())
+  {
+    for (auto& dofs : edofs_d)
+    {
+      t.entity_dofs.insert(t.entity_dofs.end(), dofs.begin(), dofs.end());
+      t.entity_dofs_offsets.push_back(t.entity_dofs.size());
+    }
+  }
+  t.transformations_are_identity = e.dof_transformations_are_identity();
+  if (cell::topological_dimension(e.cell_type()) < 2)
+    return t;
+
+  for (auto& [ctype, trans] : e.entity_transformations())
+  {
+    const auto& [M, shape] = trans;
+    const std::size_t m = shape[1];
+    if (ctype == cell::type::interval)
+    {
+      t.entity_size[0] = m;
+      t.edge_reflection.assign(M.begin(), M.begin() + m * m);
+    }
+    else
+    {
+      // The rotation, inverse rotation and reflection of the face
+      const bool tri = ctype == cell::type::triangle;
+      t.entity_size[tri ? 1 : 2] = m;
+      std::vector<T>& face = tri ? t.triangle : t.quadrilateral;
+      face.resize(3 * m * m);
+      T* rot = face.data();
+      T* rot_inv = rot + m * m;
+      T* ref = rot + 2 * m * m;
+      std::copy_n(M.begin(), m * m, rot);
+      std::copy_n(M.begin() + m * m, m * m, ref);
+
+      // A triangular face satisfies R^3 = I and a quadrilateral face
+      // R^4 = I, so the inverse rotation is R^2 or R^3
+      std::copy_n(rot, m * m, rot_inv);
+      std::vector<T> w(m * m);
+      for (int r = 0; r < (tri ? 1 : 2); ++r)
+      {
+        for (std::size_t i = 0; i < m; ++i)
+          for (std::size_t j = 0; j < m; ++j)
+          {
+            w[i * m + j] = 0;
+            for (std::size_t l = 0; l < m; ++l)
+              w[i * m + j] += rot_inv[i * m + l] * rot[l * m + j];
+          }
+        std::copy_n(w.begin(), m * m, rot_inv);
+      }
+    }
+  }
+
+  return t;
+}
+} // namespace impl
+
+/// @brief A finite element whose cell, family, degree and variant are
+/// fixed at compile time.
+///
+/// All data is held in fixed-size arrays whose sizes are compile-time
+/// constants, and tabulation and DOF transformations take arguments
+/// with static extents. No memory is allocated after construction, so
+/// the compiler can unroll and vectorise these functions when they are
+/// used inside user kernels.
+///
+/// The data can be copied from a runtime FiniteElement. Alternatively,
+/// codegen::static_element_tables writes the data out as a `constexpr`
+/// initialiser of StaticElement::tables, from which the element can be
+/// constructed in a `constexpr` context without creating a runtime
+/// element.
+///
+/// Only Lagrange (P), Raviart-Thomas (RT) and Nédélec first kind (N1E)
+/// elements are supported, as the number of DOFs of the element must be
+/// known at compile time.
+///
+/// @tparam C Cell type
+/// @tparam F Element family
+/// @tparam D Degree
+/// @tparam V Lagrange variant
+/// @tparam T Scalar type
+template <cell::type C, element::family F, int D,
+          element::lagrange_variant V = element::lagrange_variant::unset,
+          std::floating_point T = double>
+class StaticElement
+{
+  template <std::size_t... E>
+  using mdspan_t = MDSPAN_IMPL_STANDARD_NAMESPACE::mdspan<
+      T, MDSPAN_IMPL_STANDARD_NAMESPACE::extents<std::size_t, E...>>;
+  template <std::size_t... E>
+  using cmdspan_t = MDSPAN_IMPL_STANDARD_NAMESPACE::mdspan<
+      const T, MDSPAN_IMPL_STANDARD_NAMESPACE::extents<std::size_t, E...>>;
+
+public:
+  /// Topological dimension of the cell
+  static constexpr std::size_t tdim = cell::topological_dimension(C);
+
+  /// Number of DOFs
+  static constexpr std::size_t dim = impl::static_dim(C, F, D);
+
+  /// Value size
+  static constexpr std::size_t value_size = impl::static_value_size(C, F);
+
+  /// Dimension of the polynomial set the element is defined in
+  static constexpr std::size_t psize
+      = polyset::dim(C, polyset::type::standard, D);
+
+  /// Number of sub-entities of the cell, over all dimensions
+  static constexpr std::size_t num_entities
+      = cell::num_sub_entities(C, 0) + cell::num_sub_entities(C, 1)
+        + cell::num_sub_entities(C, 2) + cell::num_sub_entities(C, 3);
+
+  /// Upper bound on the number of DOFs associated with an edge
+  static constexpr std::size_t max_edge_dofs
+      = tdim >= 2 ? value_size * (D + 1) : 0;
+
+  /// Upper bound on the number of DOFs associated with a face
+  static constexpr std::size_t max_face_dofs
+      = tdim == 3 ? value_size * (D + 1) * (D + 1) : 0;
+
+  /// Number of derivatives tabulated for a maximum derivative order
+  /// @tparam ND Maximum derivative order
+  template <int ND>
+  static constexpr std::size_t nderivs = polyset::nderivs(C, ND);
+
+  /// Size of the workspace used by tabulate
+  /// @tparam ND Maximum derivative order
+  /// @tparam NP Number of points
+  template <int ND, std::size_t NP>
+  static constexpr std::size_t workspace_size = nderivs<ND> * psize * NP;
+
+  /// Points at which the element is tabulated. Shape is (NP, tdim)
+  /// @tparam NP Number of points
+  template <std::size_t NP>
+  using points_type = cmdspan_t<NP, tdim>;
+
+  /// Tabulated basis functions. Shape is (nderivs<ND>, NP, dim,
+  /// value_size)
+  /// @tparam ND Maximum derivative order
+  /// @tparam NP Number of points
+  template <int ND, std::size_t NP>
+  using basis_type = mdspan_t<nderivs<ND>, NP, dim, value_size>;
+
+  static_assert(tdim > 0, "StaticElement is not defined on a point");
+  static_assert(D >= 0, "Degree must be non-negative");
+
+  /// @brief Data of a StaticElement.
+  ///
+  /// This is an aggregate of fixed-size arrays, so it can be written
+  /// out as a `constexpr` initialiser.
+  struct tables
+  {
+    /// Coefficients of the basis functions in terms of the orthonormal
+    /// polyset. Shape is (dim, value_size * psize)
+    std::array<T, dim * value_size * psize> coeffs;
+
+    /// Offsets into `entity_dofs` for each sub-entity. The sub-entities
+    /// are numbered by dimension, starting with the vertices.
+    std::array<int, num_entities + 1> entity_dofs_offsets;
+
+    /// DOFs associated with each sub-entity
+    std::array<int, dim> entity_dofs;
+
+    /// Number of DOFs associated with an edge, a triangular face and a
+    /// quadrilateral face
+    std::array<int, 3> entity_size;
+
+    /// Reflection of the DOFs on an edge
+    std::array<T, max_edge_dofs * max_edge_dofs> edge_reflection;
+
+    /// Rotation, inverse rotation and reflection of the DOFs on a
+    /// triangular face
+    std::array<T, 3 * max_face_dofs * max_face_dofs> triangle;
+
+    /// Rotation, inverse rotation and reflection of the DOFs on a
+    /// quadrilateral face
+    std::array<T, 3 * max_face_dofs * max_face_dofs> quadrilateral;
+
+    /// Are the DOF transformations all identity maps?
+    bool transformations_are_identity;
+  };
+
+  /// @brief Create an element from precomputed tables.
+  /// @param data The element data
+  constexpr explicit StaticElement(const tables& data) : _t(data) {}
+
+  /// @brief Create an element from a runtime finite element.
+  ///
+  /// Throws if `e` does not match the compile-time parameters.
+  /// @param e The finite element
+  explicit StaticElement(const FiniteElement<T>& e) : _t(make_tables(e)) {}
+
+  /// The element data
+  constexpr const tables& data() const { return _t; }
+
+  /// @brief DOFs associated with a sub-entity.
+  /// @param d Dimension of the sub-entity
+  /// @param i Index of the sub-entity
+  /// @return The DOFs
+  constexpr std::span<const int> entity_dofs(int d, int i) const
+  {
+    int e = i;
+    for (int k = 0; k < d; ++k)
+      e += cell::num_sub_entities(C, k);
+    return std::span(_t.entity_dofs)
+        .subspan(_t.entity_dofs_offsets[e],
+                 _t.entity_dofs_offsets[e + 1] - _t.entity_dofs_offsets[e]);
+  }
+
+  /// @brief Tabulate the basis functions and their derivatives.
+  ///
+  /// @param[in] x Points. Shape is (NP, tdim)
+  /// @param[out] basis The basis functions and derivatives. Shape is
+  /// (nderivs<ND>, NP, dim, value_size). The layout is the same as
+  /// FiniteElement::tabulate
+  /// @param[in] work Workspace
+  /// @tparam ND Maximum derivative order
+  /// @tparam NP Number of points
+  template <int ND, std::size_t NP>
+  void tabulate(points_type<NP> x, basis_type<ND, NP> basis,
+                std::span<T, workspace_size<ND, NP>> work) const
+  {
+    MDSPAN_IMPL_STANDARD_NAMESPACE::mdspan<
+        T, MDSPAN_IMPL_STANDARD_NAMESPACE::dextents<std::size_t, 3>>
+        P(work.data(), nderivs<ND>, psize, NP);
+    polyset::tabulate(
+        P, C, polyset::type::standard, D, ND,
+        MDSPAN_IMPL_STANDARD_NAMESPACE::mdspan<
+            const T, MDSPAN_IMPL_STANDARD_NAMESPACE::dextents<std::size_t, 2>>(
+            x.data_handle(), NP, tdim));
+
+    cmdspan_t<nderivs<ND>, psize, NP> p(work.data());
+    cmdspan_t<dim, value_size * psize> coeffs(_t.coeffs.data());
+    for (std::size_t d = 0; d < nderivs<ND>; ++d)
+      for (std::size_t pt = 0; pt < NP; ++pt)
+        for (std::size_t i = 0; i < dim; ++i)
+          for (std::size_t j = 0; j < value_size; ++j)
+          {
+            T v = 0;
+            for (std::size_t k = 0; k < psize; ++k)
+              v += coeffs(i, j * psize + k) * p(d, k, pt);
+            basis(d, pt, i, j) = v;
+          }
+  }
+
+  /// @brief Tabulate the basis functions and their derivatives.
+  ///
+  /// The workspace is held on the stack.
+  /// @param[in] x Points. Shape is (NP, tdim)
+  /// @param[out] basis The basis functions and derivatives. Shape is
+  /// (nderivs<ND>, NP, dim, value_size)
+  template <int ND, std::size_t NP>
+  void tabulate(points_type<NP> x, basis_type<ND, NP> basis) const
+  {
+    std::array<T, workspace_size<ND, NP>> work;
+    tabulate<ND, NP>(x, basis, std::span(work));
+  }
+
+  /// @brief Apply DOF transformations to some data.
+  ///
+  /// See FiniteElement::pre_apply_dof_transformation.
+  /// @param[in,out] data The data
+  /// @param cell_info The permutation info for the cell
+  /// @tparam BS Block size of the data
+  template <int BS = 1, typename U>
+  void pre_apply_dof_transformation(std::span<U, dim * BS> data,
+                                    std::uint32_t cell_info) const
+  {
+    transform<false, false, false, BS>(data, cell_info);
+  }
+
+  /// @brief Apply transpose DOF transformations to some data.
+  ///
+  /// See FiniteElement::pre_apply_transpose_dof_transformation.
+  /// @param[in,out] data The data
+  /// @param cell_info The permutation info for the cell
+  /// @tparam BS Block size of the data
+  template <int BS = 1, typename U>
+  void pre_apply_transpose_dof_transformation(std::span<U, dim * BS> data,
+                                              std::uint32_t cell_info) const
+  {
+    transform<true, false, true, BS>(data, cell_info);
+  }
+
+  /// @brief Apply inverse DOF transformations to some data.
+  ///
+  /// See FiniteElement::pre_apply_inverse_dof_transformation.
+  /// @param[in,out] data The data
+  /// @param cell_info The permutation info for the cell
+  /// @tparam BS Block size of the data
+  template <int BS = 1, typename U>
+  void pre_apply_inverse_dof_transformation(std::span<U, dim * BS> data,
+                                            std::uint32_t cell_info) const
+  {
+    transform<true, true, false, BS>(data, cell_info);
+  }
+
+  /// @brief Apply inverse transpose DOF transformations to some data.
+  ///
+  /// See FiniteElement::pre_apply_inverse_transpose_dof_transformation.
+  /// @param[in,out] data The data
+  /// @param cell_info The permutation info for the cell
+  /// @tparam BS Block size of the data
+  template <int BS = 1, typename U>
+  void
+  pre_apply_inverse_transpose_dof_transformation(std::span<U, dim * BS> data,
+                                                 std::uint32_t cell_info) const
+  {
+    transform<false, true, true, BS>(data, cell_info);
+  }
+
+private:
+  static constexpr std::size_t max_entity_dofs
+      = max_face_dofs > max_edge_dofs ? max_face_dofs : max_edge_dofs;
+
+  // Apply the n x n matrix A (or its transpose) to the entries of data
+  // listed in dofs
+  template <bool transpose, int BS, typename U>
+  static void apply_matrix(const T* A, int n, std::span<const int> dofs,
+                           U* data)
+  {
+    std::array<U, max_entity_dofs> w;
+    for (int b = 0; b < BS; ++b)
+    {
+      for (int i = 0; i < n; ++i)
+      {
+        w[i] = 0;
+        for (int j = 0; j < n; ++j)
+        {
+          const T a = transpose ? A[j * n + i] : A[i * n + j];
+          w[i] += a * data[dofs[j] * BS + b];
+        }
+      }
+      for (int i = 0; i < n; ++i)
+        data[dofs[i] * BS + b] = w[i];
+    }
+  }
+
+  // Apply the DOF transformations given by cell_info. The reflection of
+  // a face is applied after the rotations if post is true
+  template <bool post, bool inverse, bool transpose, int BS, typename U>
+  void transform(std::span<U, dim * BS> data, std::uint32_t cell_info) const
+  {
+    if constexpr (tdim >= 2)
+    {
+      if (_t.transformations_are_identity)
+        return;
+
+      // This assumes 3 bits are used per face
+      constexpr int num_faces = tdim == 3 ? cell::num_sub_entities(C, 2) : 0;
+      constexpr int face_start = 3 * num_faces;
+
+      const int ne = _t.entity_size[0];
+      for (int e = 0; e < cell::num_sub_entities(C, 1); ++e)
+      {
+        // Reverse an edge
+        if (ne > 0 and cell_info >> (face_start + e) & 1)
+        {
+          apply_matrix<transpose, BS>(_t.edge_reflection.data(), ne,
+                                      entity_dofs(1, e), data.data());
+        }
+      }
+
+      for (int f = 0; f < num_faces; ++f)
+      {
+        const bool tri
+            = cell::sub_entity_type(C, 2, f) == cell::type::triangle;
+        const int nf = _t.entity_size[tri ? 1 : 2];
+        if (nf == 0)
+          continue;
+        const T* rot = tri ? _t.triangle.data() : _t.quadrilateral.data();
+        const T* rot_inv = rot + nf * nf;
+        const T* ref = rot + 2 * nf * nf;
+        const std::span<const int> dofs = entity_dofs(2, f);
+
+        // Reflect a face (pre rotation)
+        if (!post and cell_info >> (3 * f) & 1)
+          apply_matrix<transpose, BS>(ref, nf, dofs, data.data());
+
+        // Rotate a face
+        for (std::uint32_t r = 0; r < (cell_info >> (3 * f + 1) & 3); ++r)
+        {
+          apply_matrix<transpose, BS>(inverse ? rot_inv : rot, nf, dofs,
+                                      data.data());
+        }
+
+        // Reflect a face (post rotation)
+        if (post and cell_info >> (3 * f) & 1)
+          apply_matrix<transpose, BS>(ref, nf, dofs, data.data());
+      }
+    }
+  }
+
+  // Copy the data of a runtime element into fixed-size tables
+  static tables make_tables(const FiniteElement<T>& e)
+  {
+    if (e.cell_type() != C or e.family() != F
+        or e.embedded_superdegree() != D)
+    {
+      throw std::runtime_error("Element does not match StaticElement.");
+    }
+    if constexpr (F == element::family::P
+                  and V != element::lagrange_variant::unset)
+    {
+      if (e.lagrange_variant() != V)
+        throw std::runtime_error("Element does not match StaticElement.");
+    }
+    const std::size_t vs = std::accumulate(
+        e.value_shape().begin(), e.value_shape().end(), std::size_t(1),
+        std::multiplies{});
+    if (static_cast<std::size_t>(e.dim()) != dim or vs != value_size)
+      throw std::runtime_error("Element does not match StaticElement.");
+
+    const impl::static_element_data<T> data
+        = impl::compute_static_element_data(e);
+    if (data.edge_reflection.size() > max_edge_dofs * max_edge_dofs)
+      throw std::runtime_error("Too many DOFs on an edge.");
+    if (data.triangle.size() > 3 * max_face_dofs * max_face_dofs
+        or data.quadrilateral.size() > 3 * max_face_dofs * max_face_dofs)
+    {
+      throw std::runtime_error("Too many DOFs on a face.");
+    }
+
+    tables t{};
+    std::ranges::copy(data.coeffs, t.coeffs.begin());
+    std::ranges::copy(data.entity_dofs_offsets,
+                      t.entity_dofs_offsets.begin());
+    std::ranges::copy(data.entity_dofs, t.entity_dofs.begin());
+    t.entity_size = data.entity_size;
+    std::ranges::copy(data.edge_reflection, t.edge_reflection.begin());
+    std::ranges::copy(data.triangle, t.triangle.begin());
+    std::ranges::copy(data.quadrilateral, t.quadrilateral.begin());
+    t.transformations_are_identity = data.transformations_are_identity;
+    return t;
+  }
+
+  tables _t;
+};
+
+/// @brief Create a StaticElement.
+/// @param[in] discontinuous Indicates whether the element is
+/// discontinuous between cells points of the element. The
+/// discontinuous element will have the same DOFs as a continuous
+/// element, but the DOFs will all be associated with the interior of
+/// the cell.
+/// @return The element
+template <cell::type C, element::family F, int D,
+          element::lagrange_variant V = element::lagrange_variant::unset,
+          std::floating_point T = double>
+StaticElement<C, F, D, V, T> create_static_element(bool discontinuous = false)
+{
+  return StaticElement<C, F, D, V, T>(create_element<T>(
+      F, C, D, V, element::dpc_variant::unset, discontinuous));
+}
+
+} // namespace basix
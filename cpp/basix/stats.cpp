@@ -0,0 +1,138 @@
+// Copyright (c) 2024 Basix contributors
+// FEniCS Project
+// SPDX-License-Identifier:    MIT
+
+#include "stats.h"
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+using namespace basix;
+
+namespace
+{
+/// The counters of one thread. The mutex is only contended while the
+/// counters are read or reset.
+struct thread_counters
+{
+  std::mutex mutex;
+  std::unordered_map<std::uint64_t, stats::counters> counters;
+};
+
+std::atomic<bool> collect = false;
+
+/// The counters of the threads that are running and have recorded
+/// anything, and the sum of the counters of the threads that have
+/// exited. When a thread exits, its counters are added to the sum and
+/// it is removed from the registry, so the registry does not grow when
+/// many short-lived threads tabulate.
+std::mutex registry_mutex;
+std::vector<thread_counters*> registry;
+std::unordered_map<std::uint64_t, stats::counters> exited;
+
+//-----------------------------------------------------------------------------
+void add(stats::counters& total, const stats::counters& c)
+{
+  total.tabulate_calls += c.tabulate_calls;
+  total.tabulate_points += c.tabulate_points;
+  total.tabulate_bytes += c.tabulate_bytes;
+}
+//-----------------------------------------------------------------------------
+/// The counters of a thread, which are registered when they are
+/// created and folded into the counters of exited threads when the
+/// thread exits
+struct registered_counters
+{
+  registered_counters()
+  {
+    std::lock_guard lock(registry_mutex);
+    registry.push_back(&local);
+  }
+
+  ~registered_counters()
+  {
+    std::lock_guard lock(registry_mutex);
+    for (auto& [fingerprint, c] : local.counters)
+      add(exited[fingerprint], c);
+    std::erase(registry, &local);
+  }
+
+  registered_counters(const registered_counters&) = delete;
+  registered_counters& operator=(const registered_counters&) = delete;
+
+  thread_counters local;
+};
+//-----------------------------------------------------------------------------
+thread_counters& local_counters()
+{
+  thread_local registered_counters c;
+  return c.local;
+}
+//-----------------------------------------------------------------------------
+} // namespace
+
+//-----------------------------------------------------------------------------
+void stats::set_enabled(bool enable)
+{
+  collect.store(enable, std::memory_order_relaxed);
+}
+//-----------------------------------------------------------------------------
+bool stats::enabled() { return collect.load(std::memory_order_relaxed); }
+//-----------------------------------------------------------------------------
+void stats::record_tabulate(std::uint64_t fingerprint, std::size_t num_points,
+                            std::size_t num_bytes)
+{
+  if (!collect.load(std::memory_order_relaxed))
+    return;
+
+  thread_counters& local = local_counters();
+  std::lock_guard lock(local.mutex);
+  counters& c = local.counters[fingerprint];
+  c.tabulate_calls += 1;
+  c.tabulate_points += num_points;
+  c.tabulate_bytes += num_bytes;
+}
+//-----------------------------------------------------------------------------
+std::map<std::uint64_t, stats::counters> stats::read()
+{
+  std::lock_guard lock(registry_mutex);
+  std::map<std::uint64_t, counters> total(exited.begin(), exited.end());
+  for (thread_counters* local : registry)
+  {
+    std::lock_guard local_lock(local->mutex);
+    for (auto& [fingerprint, c] : local->counters)
+      add(total[fingerprint], c);
+  }
+  return total;
+}
+//-----------------------------------------------------------------------------
+stats::counters stats::read(std::uint64_t fingerprint)
+{
+  counters total;
+  std::lock_guard lock(registry_mutex);
+  if (auto it = exited.find(fingerprint); it != exited.end())
+    add(total, it->second);
+  for (thread_counters* local : registry)
+  {
+    std::lock_guard local_lock(local->mutex);
+    if (auto it = local->counters.find(fingerprint);
+        it != local->counters.end())
+    {
+      add(total, it->second);
+    }
+  }
+  return total;
+}
+//-----------------------------------------------------------------------------
+void stats::reset()
+{
+  std::lock_guard lock(registry_mutex);
+  exited.clear();
+  for (thread_counters* local : registry)
+  {
+    std::lock_guard local_lock(local->mutex);
+    local->counters.clear();
+  }
+}
+//-----------------------------------------------------------------------------
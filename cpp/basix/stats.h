@@ -0,0 +1,68 @@
+// Copyright (c) 2024 Basix contributors
+// FEniCS Project
+// SPDX-License-Identifier:    MIT
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+
+/// @brief Runtime statistics of the use of elements.
+///
+/// Collection is off by default. When it is enabled, each thread counts
+/// the calls that it makes in its own counters, so that counting does
+/// not require synchronisation between threads. The counters of all
+/// threads are summed when they are read, and the counters of a thread
+/// are added to a shared total when it exits. Elements are identified by
+/// their `FiniteElement::fingerprint`, so elements with the same
+/// definition share counters.
+namespace basix::stats
+{
+
+/// The counters of an element
+struct counters
+{
+  /// Number of calls to `FiniteElement::tabulate` and
+  /// `FiniteElement::tabulate_batch`
+  std::uint64_t tabulate_calls = 0;
+
+  /// Number of points at which the element has been tabulated
+  std::uint64_t tabulate_points = 0;
+
+  /// Number of bytes of tables that have been produced
+  std::uint64_t tabulate_bytes = 0;
+};
+
+/// @brief Enable or disable the collection of statistics.
+///
+/// Disabling collection does not reset the counters.
+/// @param[in] enable Whether to collect statistics
+void set_enabled(bool enable);
+
+/// Check if statistics are collected
+/// @return True if statistics are collected
+bool enabled();
+
+/// @brief Record a tabulation of an element.
+///
+/// This does nothing if collection is disabled.
+/// @param[in] fingerprint The fingerprint of the element
+/// @param[in] num_points The number of points
+/// @param[in] num_bytes The number of bytes of the table
+void record_tabulate(std::uint64_t fingerprint, std::size_t num_points,
+                     std::size_t num_bytes);
+
+/// Get the counters of all threads, summed
+/// @return Map from element fingerprint to the counters of the element
+std::map<std::uint64_t, counters> read();
+
+/// Get the counters of one element, summed over all threads
+/// @param[in] fingerprint The fingerprint of the element
+/// @return The counters of the element
+counters read(std::uint64_t fingerprint);
+
+/// Set all counters of all threads to zero
+void reset();
+
+} // namespace basix::stats
@@ -0,0 +1,233 @@
+// Copyright (c) 2024 Basix contributors
+// FEniCS Project
+// SPDX-License-Identifier:    MIT
+
+#include "tabulation-stream.h"
+#include "math.h"
+#include "polyset.h"
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+using namespace basix;
+
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+TabulationStream<F>::TabulationStream(const FiniteElement<F>& element, int nd,
+                                      std::size_t chunk_size,
+                                      producer_t producer, bool pipelined)
+    : _element(element), _nd(nd), _chunk_size(chunk_size),
+      _tdim(cell::topological_dimension(element.cell_type())),
+      _ndofs(element.dim()), _producer(std::move(producer)),
+      _pipelined(pipelined)
+{
+  if (nd < 0)
+    throw std::runtime_error("Derivative order must not be negative.");
+  if (chunk_size == 0)
+    throw std::runtime_error("Chunk size must be positive.");
+  if (!_producer)
+    throw std::runtime_error("Stream has no producer.");
+
+  _nderivs = polyset::nderivs(element.cell_type(), nd);
+  _vs = std::accumulate(element.value_shape().begin(),
+                        element.value_shape().end(), 1, std::multiplies{});
+  _psize = polyset::dim(element.cell_type(), element.polyset_type(),
+                        element.embedded_superdegree());
+
+  // Split the coefficients into a (ndofs, psize) block for each value
+  // component
+  const auto& [coeffs_b, cshape] = element.coefficient_matrix();
+  mdspan_t<const F, 2> coeffs(coeffs_b.data(), cshape);
+  _coeffs.resize(_vs * _ndofs * _psize);
+  mdspan_t<F, 3> C(_coeffs.data(), _vs, _ndofs, _psize);
+  for (std::size_t j = 0; j < _vs; ++j)
+    for (std::size_t k0 = 0; k0 < _ndofs; ++k0)
+      for (std::size_t k1 = 0; k1 < _psize; ++k1)
+        C(j, k0, k1) = coeffs(k0, k1 + _psize * j);
+
+  // A second buffer is only needed if the next chunk is tabulated while
+  // the current chunk is processed
+  for (int b = 0; b < (pipelined ? 2 : 1); ++b)
+  {
+    _x[b].resize(_chunk_size * _tdim);
+    _tables[b].resize(_nderivs * _chunk_size * _ndofs * _vs);
+  }
+  _P.resize(_nderivs * _psize * _chunk_size);
+  _result.resize(_ndofs * _chunk_size);
+
+  if (pipelined)
+    _worker = std::jthread([this](std::stop_token stop) { work(stop); });
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+bool TabulationStream<F>::next()
+{
+  if (_ended)
+    return false;
+
+  try
+  {
+    if (_current == -1)
+    {
+      read(0);
+      tabulate(0);
+      _current = 0;
+    }
+    else if (_pipelined)
+    {
+      if (_error)
+        std::rethrow_exception(std::exchange(_error, nullptr));
+      wait();
+      _current = 1 - _current;
+    }
+    else
+    {
+      read(_current);
+      tabulate(_current);
+    }
+  }
+  catch (...)
+  {
+    _ended = true;
+    throw;
+  }
+
+  if (_npoints[_current] == 0)
+  {
+    _ended = true;
+    return false;
+  }
+  _num_points += _npoints[_current];
+
+  if (_pipelined)
+  {
+    // Read the next chunk and start tabulating it. An error is kept
+    // until the chunk is requested, so that the current chunk is still
+    // returned.
+    const int b = 1 - _current;
+    try
+    {
+      read(b);
+      start(b);
+    }
+    catch (...)
+    {
+      _error = std::current_exception();
+    }
+  }
+
+  return true;
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+TabulationStream<F>::mdspan_t<const F, 2> TabulationStream<F>::points() const
+{
+  const int b = std::max(_current, 0);
+  return mdspan_t<const F, 2>(_x[b].data(), _npoints[b], _tdim);
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+TabulationStream<F>::mdspan_t<const F, 4> TabulationStream<F>::table() const
+{
+  const int b = std::max(_current, 0);
+  return mdspan_t<const F, 4>(_tables[b].data(), _nderivs, _npoints[b],
+                              _ndofs, _vs);
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+void TabulationStream<F>::read(int b)
+{
+  _npoints[b] = _producer(mdspan_t<F, 2>(_x[b].data(), _chunk_size, _tdim));
+  if (_npoints[b] > _chunk_size)
+    throw std::runtime_error("Producer returned too many points.");
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+void TabulationStream<F>::tabulate(int b)
+{
+  const std::size_t npoints = _npoints[b];
+  if (npoints == 0)
+    return;
+
+  mdspan_t<F, 3> P(_P.data(), _nderivs, _psize, npoints);
+  polyset::tabulate(P, _element.cell_type(), _element.polyset_type(),
+                    _element.embedded_superdegree(), _nd,
+                    mdspan_t<const F, 2>(_x[b].data(), npoints, _tdim));
+
+  mdspan_t<F, 4> table(_tables[b].data(), _nderivs, npoints, _ndofs, _vs);
+  mdspan_t<F, 2> result(_result.data(), _ndofs, npoints);
+  const std::vector<int>& dof_ordering = _element.dof_ordering();
+  for (std::size_t j = 0; j < _vs; ++j)
+  {
+    mdspan_t<const F, 2> C(_coeffs.data() + j * _ndofs * _psize, _ndofs,
+                           _psize);
+    for (std::size_t d = 0; d < _nderivs; ++d)
+    {
+      math::dot(C,
+                mdspan_t<const F, 2>(P.data_handle() + d * _psize * npoints,
+                                     _psize, npoints),
+                result);
+      for (std::size_t p = 0; p < npoints; ++p)
+      {
+        for (std::size_t k = 0; k < _ndofs; ++k)
+        {
+          table(d, p, dof_ordering.empty() ? k : dof_ordering[k], j)
+              = result(k, p);
+        }
+      }
+    }
+  }
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+void TabulationStream<F>::start(int b)
+{
+  {
+    std::lock_guard lock(_mutex);
+    _request = b;
+  }
+  _cv.notify_all();
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+void TabulationStream<F>::wait()
+{
+  std::unique_lock lock(_mutex);
+  _cv.wait(lock, [this] { return _request == -1; });
+  if (_worker_error)
+    std::rethrow_exception(std::exchange(_worker_error, nullptr));
+}
+//-----------------------------------------------------------------------------
+template <std::floating_point F>
+void TabulationStream<F>::work(std::stop_token stop)
+{
+  std::unique_lock lock(_mutex);
+  while (_cv.wait(lock, stop, [this] { return _request != -1; }))
+  {
+    const int b = _request;
+    lock.unlock();
+    std::exception_ptr error;
+    try
+    {
+      tabulate(b);
+    }
+    catch (...)
+    {
+      error = std::current_exception();
+    }
+    lock.lock();
+    _worker_error = error;
+    _request = -1;
+    _cv.notify_all();
+  }
+}
+//-----------------------------------------------------------------------------
+
+/// @cond
+// Explicit instantiation for double and float
+template class basix::TabulationStream<float>;
+template class basix::TabulationStream<double>;
+/// @endcond
+//-----------------------------------------------------------------------------
@@ -0,0 +1,185 @@
+// Copyright (c) 2024 Basix contributors
+// FEniCS Project
+// SPDX-License-Identifier:    MIT
+
+#pragma once
+
+#include "finite-element.h"
+#include "mdspan.hpp"
+#include <array>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+/// Tabulation of streams of points
+namespace basix
+{
+
+/// @brief Tabulate an element at a stream of points in chunks, in
+/// bounded memory.
+///
+/// The points are read from a producer in chunks of at most
+/// `chunk_size` points. Each call to TabulationStream::next tabulates
+/// the next chunk and makes it available through
+/// TabulationStream::table until the following call. The memory used
+/// is proportional to the chunk size, and the buffers are reused for
+/// every chunk, so any number of points can be tabulated.
+///
+/// If the stream is pipelined, the next chunk is read when the current
+/// chunk is returned and is tabulated on a worker thread while the
+/// caller processes the current chunk. The worker thread is started
+/// when the stream is created and is reused for every chunk. The
+/// producer is always called on the thread that calls
+/// TabulationStream::next.
+///
+/// If the producer or the tabulation of a chunk throws, the exception
+/// is rethrown by the call to TabulationStream::next that would have
+/// returned the chunk, and the stream ends: later calls return false.
+///
+/// Typical use is:
+/// @code
+/// TabulationStream<double> stream(element, 0, 4096, producer);
+/// while (stream.next())
+///   consume(stream.points(), stream.table());
+/// @endcode
+template <std::floating_point F>
+class TabulationStream
+{
+  template <typename T, std::size_t d>
+  using mdspan_t = MDSPAN_IMPL_STANDARD_NAMESPACE::mdspan<
+      T, MDSPAN_IMPL_STANDARD_NAMESPACE::dextents<std::size_t, d>>;
+
+public:
+  /// @brief A function that writes the next chunk of points to an array
+  /// with shape (chunk_size, tdim) and returns the number of points
+  /// written. Returning zero ends the stream.
+  using producer_t = std::function<std::size_t(mdspan_t<F, 2>)>;
+
+  /// @brief Create a stream.
+  /// @param[in] element The element to tabulate. The element must
+  /// outlive the stream.
+  /// @param[in] nd The order of derivatives, up to and including, to
+  /// compute. Use 0 for the basis functions only.
+  /// @param[in] chunk_size The largest number of points in a chunk.
+  /// @param[in] producer The function that provides the points.
+  /// @param[in] pipelined If true, the next chunk is tabulated on a
+  /// worker thread while the current chunk is processed.
+  TabulationStream(const FiniteElement<F>& element, int nd,
+                   std::size_t chunk_size, producer_t producer,
+                   bool pipelined = true);
+
+  /// Copy constructor
+  TabulationStream(const TabulationStream& stream) = delete;
+
+  /// Move constructor
+  TabulationStream(TabulationStream&& stream) = delete;
+
+  /// Destructor. Waits for the tabulation of a pending chunk to finish
+  /// and stops the worker thread.
+  ~TabulationStream() = default;
+
+  /// Assignment operator
+  TabulationStream& operator=(const TabulationStream& stream) = delete;
+
+  /// Move assignment operator
+  TabulationStream& operator=(TabulationStream&& stream) = delete;
+
+  /// @brief Tabulate the next chunk of points.
+  /// @return False if the producer has no more points, otherwise true.
+  bool next();
+
+  /// @brief The points of the current chunk, with shape (number of
+  /// points in the chunk, tdim).
+  mdspan_t<const F, 2> points() const;
+
+  /// @brief The table of the current chunk.
+  ///
+  /// The table has the shape and layout of the output of
+  /// FiniteElement::tabulate for the points of the chunk. It is
+  /// overwritten by the next call to TabulationStream::next.
+  mdspan_t<const F, 4> table() const;
+
+  /// @brief The largest number of points in a chunk.
+  std::size_t chunk_size() const { return _chunk_size; }
+
+  /// @brief The total number of points that have been returned.
+  std::size_t num_points() const { return _num_points; }
+
+private:
+  // Read the next chunk into buffer b
+  void read(int b);
+
+  // Tabulate the chunk in buffer b
+  void tabulate(int b);
+
+  // Ask the worker thread to tabulate the chunk in buffer b
+  void start(int b);
+
+  // Wait for the worker thread to finish the chunk it was given, and
+  // rethrow the exception that the tabulation threw, if any
+  void wait();
+
+  // The loop of the worker thread
+  void work(std::stop_token stop);
+
+  // The element
+  const FiniteElement<F>& _element;
+
+  // Derivative order, and the number of derivatives
+  int _nd;
+  std::size_t _nderivs;
+
+  // Chunk size, topological dimension, number of DOFs, value size and
+  // polyset dimension
+  std::size_t _chunk_size, _tdim, _ndofs, _vs, _psize;
+
+  // The producer
+  producer_t _producer;
+
+  // Pipeline the tabulation of the next chunk
+  bool _pipelined;
+
+  // The coefficients of each value component, shape (vs, ndofs, psize)
+  std::vector<F> _coeffs;
+
+  // Double-buffered points and tables, and the number of points in
+  // each buffer
+  std::array<std::vector<F>, 2> _x, _tables;
+  std::array<std::size_t, 2> _npoints = {0, 0};
+
+  // Scratch space for tabulating a chunk
+  std::vector<F> _P, _result;
+
+  // The buffer returned to the caller, or -1 before the first chunk
+  int _current = -1;
+
+  // True once the stream has ended or has failed
+  bool _ended = false;
+
+  // An exception thrown while the next chunk was read, which is
+  // rethrown when the chunk is requested
+  std::exception_ptr _error;
+
+  // Number of points returned
+  std::size_t _num_points = 0;
+
+  // The buffer that the worker thread is asked to tabulate, or -1 when
+  // the worker is idle, and the exception thrown by the last
+  // tabulation on the worker thread. Guarded by _mutex.
+  int _request = -1;
+  std::exception_ptr _worker_error;
+  std::mutex _mutex;
+  std::condition_variable_any _cv;
+
+  // The worker thread of a pipelined stream. It is declared last, so it
+  // is stopped and joined before the buffers it uses are destroyed.
+  std::jthread _worker;
+};
+
+} // namespace basix
@@ -0,0 +1,441 @@
+// Copyright (c) 2024 Basix contributors
+// FEniCS Project
+// SPDX-License-Identifier:    MIT
+
+// Microbenchmarks of the functions of Basix that are called at runtime.
+//
+// Run `basix_bench --benchmark_filter=<regex>` to run a subset of the
+// benchmarks, and `basix_bench --benchmark_out=results.json
+// --benchmark_out_format=json` to write the results as JSON.
+
+#include <basix/cell.h>
+#include <basix/finite-element.h>
+#include <basix/interpolation.h>
+#include <basix/polyset.h>
+#include <basix/quadrature.h>
+#include "bench-elements.h"
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace basix;
+using namespace basix::bench;
+
+namespace
+{
+template <typename T, std::size_t d>
+using mdspan_t = MDSPAN_IMPL_STANDARD_NAMESPACE::mdspan<
+    T, MDSPAN_IMPL_STANDARD_NAMESPACE::dextents<std::size_t, d>>;
+
+using element_t = FiniteElement<double>;
+
+//-----------------------------------------------------------------------------
+/// Create an element, or return nullptr if the element does not exist
+/// for the given cell and degree
+std::shared_ptr<const element_t> try_create(const family_info& f,
+                                            cell::type cell, int degree)
+{
+  try
+  {
+    return std::make_shared<const element_t>(create_element<double>(
+        f.family, cell, degree, f.lvariant, f.dvariant,
+        f.family == element::family::DPC));
+  }
+  catch (const std::exception&)
+  {
+    return nullptr;
+  }
+}
+//-----------------------------------------------------------------------------
+/// Quadrature points of degree m on a cell, with shape (npoints, tdim)
+std::pair<std::vector<double>, std::array<std::size_t, 2>>
+quadrature_points(cell::type cell, int m)
+{
+  auto [x, w] = quadrature::make_quadrature<double>(
+      quadrature::type::Default, cell, polyset::type::standard, m);
+  std::size_t tdim = cell::topological_dimension(cell);
+  return {std::move(x), {w.size(), tdim}};
+}
+//-----------------------------------------------------------------------------
+/// Cell info for cells whose vertices have random global numbers,
+/// computed in the same way as DOLFINx computes it from a mesh: an
+/// edge is reflected if its first vertex has the higher number, and a
+/// face is rotated until its lowest numbered vertex comes first and is
+/// then reflected if the next vertex has a higher number than the
+/// previous one. The bits are laid out as FiniteElement reads them: on
+/// a 3D cell the 3 bits of each face come first and are followed by
+/// one bit for each edge, and on a 2D cell the edge bits start at bit 0.
+std::vector<std::uint32_t> random_cell_info(cell::type cell,
+                                            std::size_t num_cells,
+                                            std::mt19937& gen)
+{
+  const int tdim = cell::topological_dimension(cell);
+  std::vector<std::uint32_t> info(num_cells, 0);
+  if (tdim < 2)
+    return info;
+
+  const std::vector<std::vector<std::vector<int>>> topology
+      = cell::topology(cell);
+  const std::size_t nfaces = tdim == 3 ? topology[2].size() : 0;
+  const std::size_t edge_start = 3 * nfaces;
+  std::vector<int> g(topology[0].size());
+  for (std::uint32_t& ci : info)
+  {
+    std::iota(g.begin(), g.end(), 0);
+    std::shuffle(g.begin(), g.end(), gen);
+
+    for (std::size_t f = 0; f < nfaces; ++f)
+    {
+      // Vertices of the face in cyclic order
+      std::vector<int> v;
+      for (int vertex : topology[2][f])
+        v.push_back(g[vertex]);
+      if (v.size() == 4)
+        std::swap(v[2], v[3]);
+
+      const int n = v.size();
+      int rots = 0;
+      for (int i = 1; i < n; ++i)
+        if (v[i] < v[rots])
+          rots = i;
+      const int pre = v[(rots + n - 1) % n];
+      const int post = v[(rots + 1) % n];
+      ci |= (post > pre) << (3 * f);
+      ci |= rots << (3 * f + 1);
+    }
+
+    for (std::size_t e = 0; e < topology[1].size(); ++e)
+    {
+      if (g[topology[1][e][0]] > g[topology[1][e][1]])
+        ci |= 1u << (edge_start + e);
+    }
+  }
+  return info;
+}
+//-----------------------------------------------------------------------------
+void register_polyset()
+{
+  for (auto& [cell, cname] : all_cells)
+  {
+    for (int degree : {1, 2, 4, 8})
+    {
+      for (int nd : {0, 1, 2})
+      {
+        std::string name = "polyset/" + cname + "/degree:"
+                           + std::to_string(degree)
+                           + "/nd:" + std::to_string(nd);
+        benchmark::RegisterBenchmark(
+            name.c_str(),
+            [cell, degree, nd](benchmark::State& state)
+            {
+              auto [x, xshape] = quadrature_points(cell, 2 * degree);
+              mdspan_t<const double, 2> _x(x.data(), xshape);
+              std::array<std::size_t, 3> shape
+                  = {(std::size_t)polyset::nderivs(cell, nd),
+                     (std::size_t)polyset::dim(cell, polyset::type::standard,
+                                               degree),
+                     xshape[0]};
+              std::vector<double> P(shape[0] * shape[1] * shape[2]);
+              for (auto _ : state)
+              {
+                polyset::tabulate(mdspan_t<double, 3>(P.data(), shape), cell,
+                                  polyset::type::standard, degree, nd, _x);
+                benchmark::DoNotOptimize(P.data());
+              }
+              state.SetItemsProcessed(state.iterations() * xshape[0]);
+            });
+      }
+    }
+  }
+}
+//-----------------------------------------------------------------------------
+void register_tabulate()
+{
+  for (const family_info& f : all_families)
+  {
+    for (auto& [cell, cname] : all_cells)
+    {
+      for (int degree : {1, 2, 3, 4})
+      {
+        std::shared_ptr<const element_t> e = try_create(f, cell, degree);
+        if (!e)
+          continue;
+        for (int nd : {0, 1, 2})
+        {
+          std::string name = "tabulate/" + f.name + "/" + cname
+                             + "/degree:" + std::to_string(degree)
+                             + "/nd:" + std::to_string(nd);
+          benchmark::RegisterBenchmark(
+              name.c_str(),
+              [e, nd](benchmark::State& state)
+              {
+                auto [x, xshape] = quadrature_points(
+                    e->cell_type(), 2 * e->embedded_superdegree());
+                mdspan_t<const double, 2> _x(x.data(), xshape);
+                std::array<std::size_t, 4> shape
+                    = e->tabulate_shape(nd, xshape[0]);
+                std::vector<double> basis(shape[0] * shape[1] * shape[2]
+                                          * shape[3]);
+                for (auto _ : state)
+                {
+                  e->tabulate(nd, _x, mdspan_t<double, 4>(basis.data(), shape));
+                  benchmark::DoNotOptimize(basis.data());
+                }
+                state.SetItemsProcessed(state.iterations() * xshape[0]);
+                state.SetBytesProcessed(state.iterations() * basis.size()
+                                        * sizeof(double));
+              });
+        }
+      }
+    }
+  }
+}
+//-----------------------------------------------------------------------------
+/// Jacobians of random affine maps close to the identity, with their
+/// determinants and inverses. The Jacobians are upper triangular so
+/// that the inverses are simple to compute.
+std::array<std::vector<double>, 3> random_jacobians(std::size_t npoints,
+                                                    std::size_t tdim,
+                                                    std::mt19937& gen)
+{
+  std::uniform_real_distribution<double> dist(-0.1, 0.1);
+  std::vector<double> J(npoints * tdim * tdim, 0), K(J.size(), 0),
+      detJ(npoints, 1);
+  for (std::size_t p = 0; p < npoints; ++p)
+  {
+    mdspan_t<double, 2> _J(J.data() + p * tdim * tdim, tdim, tdim);
+    mdspan_t<double, 2> _K(K.data() + p * tdim * tdim, tdim, tdim);
+    for (std::size_t i = 0; i < tdim; ++i)
+    {
+      _J(i, i) = 1.0 + dist(gen);
+      detJ[p] *= _J(i, i);
+      for (std::size_t j = i + 1; j < tdim; ++j)
+        _J(i, j) = dist(gen);
+    }
+
+    for (std::size_t j = 0; j < tdim; ++j)
+    {
+      for (std::size_t i = tdim; i-- > 0;)
+      {
+        double v = i == j ? 1.0 : 0.0;
+        for (std::size_t k = i + 1; k < tdim; ++k)
+          v -= _J(i, k) * _K(k, j);
+        _K(i, j) = v / _J(i, i);
+      }
+    }
+  }
+  return {std::move(J), std::move(detJ), std::move(K)};
+}
+//-----------------------------------------------------------------------------
+void register_maps()
+{
+  // Number of points, eg the quadrature points of a batch of cells
+  constexpr std::size_t npoints = 1000;
+
+  // Elements with each of the maps
+  const std::vector<std::tuple<std::string, family_info, cell::type, int>>
+      cases = {{"identity", all_families[0], cell::type::tetrahedron, 2},
+               {"covariantPiola", all_families[2], cell::type::tetrahedron, 2},
+               {"contravariantPiola", all_families[1], cell::type::tetrahedron,
+                2},
+               {"doubleCovariantPiola", all_families[6],
+                cell::type::tetrahedron, 1},
+               {"doubleContravariantPiola", all_families[7],
+                cell::type::triangle, 1}};
+
+  for (auto& [map_name, f, cell, degree] : cases)
+  {
+    std::shared_ptr<const element_t> e = try_create(f, cell, degree);
+    if (!e)
+      continue;
+    for (bool push : {true, false})
+    {
+      std::string name = std::string(push ? "push_forward/" : "pull_back/")
+                         + map_name + "/" + cell_name(cell);
+      benchmark::RegisterBenchmark(
+          name.c_str(),
+          [e, push](benchmark::State& state)
+          {
+            const std::size_t tdim
+                = cell::topological_dimension(e->cell_type());
+            const std::size_t vs = std::accumulate(
+                e->value_shape().begin(), e->value_shape().end(), 1,
+                std::multiplies{});
+            const std::size_t ndofs = e->dim();
+
+            std::mt19937 gen(0);
+            auto [J, detJ, K] = random_jacobians(npoints, tdim, gen);
+
+            // The reference and physical value sizes are equal as the
+            // geometric dimension is equal to tdim
+            std::uniform_real_distribution<double> dist(-1.0, 1.0);
+            std::vector<double> U(npoints * ndofs * vs), u(U.size());
+            std::generate(U.begin(), U.end(), [&]() { return dist(gen); });
+            mdspan_t<const double, 3> _U(U.data(), npoints, ndofs, vs);
+            mdspan_t<double, 3> _u(u.data(), npoints, ndofs, vs);
+            mdspan_t<const double, 3> _J(J.data(), npoints, tdim, tdim);
+            mdspan_t<const double, 3> _K(K.data(), npoints, tdim, tdim);
+            for (auto _ : state)
+            {
+              if (push)
+                e->push_forward(_U, _J, detJ, _K, _u);
+              else
+                e->pull_back(_U, _J, detJ, _K, _u);
+              benchmark::DoNotOptimize(u.data());
+            }
+            state.SetItemsProcessed(state.iterations() * npoints * ndofs);
+          });
+    }
+  }
+}
+//-----------------------------------------------------------------------------
+void register_dof_transformations()
+{
+  constexpr std::size_t ncells = 1000;
+  constexpr int block_size = 3;
+
+  using fn_t = void (element_t::*)(std::span<double>, int, std::uint32_t)
+      const;
+  const std::vector<std::pair<std::string, fn_t>> transformations = {
+      {"pre_apply", &element_t::pre_apply_dof_transformation<double>},
+      {"pre_apply_transpose",
+       &element_t::pre_apply_transpose_dof_transformation<double>},
+      {"pre_apply_inverse",
+       &element_t::pre_apply_inverse_dof_transformation<double>},
+      {"pre_apply_inverse_transpose",
+       &element_t::pre_apply_inverse_transpose_dof_transformation<double>},
+      {"post_apply", &element_t::post_apply_dof_transformation<double>},
+      {"post_apply_transpose",
+       &element_t::post_apply_transpose_dof_transformation<double>},
+      {"post_apply_inverse",
+       &element_t::post_apply_inverse_dof_transformation<double>},
+      {"post_apply_inverse_transpose",
+       &element_t::post_apply_inverse_transpose_dof_transformation<double>}};
+
+  const std::vector<std::tuple<std::string, family_info, cell::type, int>>
+      cases = {{"P", all_families[0], cell::type::tetrahedron, 4},
+               {"N1E", all_families[2], cell::type::tetrahedron, 3},
+               {"N1E", all_families[2], cell::type::hexahedron, 2},
+               {"RT", all_families[1], cell::type::prism, 2}};
+
+  for (auto& [family_name, f, cell, degree] : cases)
+  {
+    std::shared_ptr<const element_t> e = try_create(f, cell, degree);
+    if (!e)
+      continue;
+    for (auto& [t_name, fn] : transformations)
+    {
+      for (bool random : {false, true})
+      {
+        std::string name = "dof_transformation/" + t_name + "/" + family_name
+                           + "/" + cell_name(cell) + "/degree:"
+                           + std::to_string(degree)
+                           + (random ? "/random_numbering" : "/ordered");
+        benchmark::RegisterBenchmark(
+            name.c_str(),
+            [e, fn, random](benchmark::State& state)
+            {
+              // Ordered meshes (eg created with increasing vertex numbers
+              // on each cell) have no reflected or rotated entities
+              std::mt19937 gen(0);
+              std::vector<std::uint32_t> cell_info
+                  = random ? random_cell_info(e->cell_type(), ncells, gen)
+                           : std::vector<std::uint32_t>(ncells, 0);
+              const std::size_t size = e->dim() * block_size;
+              std::vector<double> data(ncells * size, 1.0);
+              for (auto _ : state)
+              {
+                for (std::size_t c = 0; c < ncells; ++c)
+                {
+                  ((*e).*fn)(std::span(data.data() + c * size, size),
+                             block_size, cell_info[c]);
+                }
+                benchmark::DoNotOptimize(data.data());
+              }
+              state.SetItemsProcessed(state.iterations() * ncells);
+            });
+      }
+    }
+  }
+}
+//-----------------------------------------------------------------------------
+void register_interpolation_operator()
+{
+  const std::vector<std::tuple<std::string, family_info, int, family_info,
+                               int, cell::type>>
+      cases = {{"P2_to_P5", all_families[0], 2, all_families[0], 5,
+                cell::type::tetrahedron},
+               {"N1E2_to_N1E4", all_families[2], 2, all_families[2], 4,
+                cell::type::tetrahedron},
+               {"RT2_to_N1E3", all_families[1], 2, all_families[2], 3,
+                cell::type::triangle},
+               {"serendipity3_to_P3", all_families[10], 3, all_families[0],
+                3, cell::type::quadrilateral}};
+  for (auto& [case_name, f0, d0, f1, d1, cell] : cases)
+  {
+    std::shared_ptr<const element_t> e0 = try_create(f0, cell, d0);
+    std::shared_ptr<const element_t> e1 = try_create(f1, cell, d1);
+    if (!e0 or !e1)
+      continue;
+    std::string name = "interpolation_operator/" + case_name + "/"
+                       + cell_name(cell);
+    benchmark::RegisterBenchmark(
+        name.c_str(),
+        [e0, e1](benchmark::State& state)
+        {
+          for (auto _ : state)
+            benchmark::DoNotOptimize(compute_interpolation_operator(*e0, *e1));
+        });
+  }
+}
+//-----------------------------------------------------------------------------
+void register_quadrature()
+{
+  for (auto& [cell, cname] : all_cells)
+  {
+    for (auto [qtype, qname] :
+         {std::pair{quadrature::type::Default, "default"},
+          std::pair{quadrature::type::gauss_jacobi, "gauss_jacobi"}})
+    {
+      for (int m : {2, 5, 10, 20})
+      {
+        std::string name = "make_quadrature/" + std::string(qname) + "/"
+                           + cname + "/degree:" + std::to_string(m);
+        benchmark::RegisterBenchmark(
+            name.c_str(),
+            [cell, qtype, m](benchmark::State& state)
+            {
+              for (auto _ : state)
+              {
+                benchmark::DoNotOptimize(quadrature::make_quadrature<double>(
+                    qtype, cell, polyset::type::standard, m));
+              }
+            });
+      }
+    }
+  }
+}
+//-----------------------------------------------------------------------------
+} // namespace
+
+int main(int argc, char** argv)
+{
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    return 1;
+
+  register_polyset();
+  register_tabulate();
+  register_maps();
+  register_dof_transformations();
+  register_interpolation_operator();
+  register_quadrature();
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
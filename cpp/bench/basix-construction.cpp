@@ -0,0 +1,263 @@
+// Copyright (c) 2024 Basix contributors
+// FEniCS Project
+// SPDX-License-Identifier:    MIT
+
+// Benchmark of the construction of elements. For each family, cell and
+// degree, an element is created and the wall time of each stage of its
+// construction, the peak heap memory used while creating it and the
+// memory held by the element are written as a row of a table. The
+// cache of moments is cleared before each element is created, so the
+// measurements are of a cold construction.
+//
+// Usage:
+//
+//   basix_construction_bench [--family NAME] [--cell NAME]
+//       [--max-degree N] [--time-limit SECONDS] [--format csv|json]
+//
+// The degrees 1 to N (default 5) are swept for each family and cell. As
+// construction time grows quickly with degree, larger degrees of a
+// family on a cell are skipped after a construction takes longer than
+// the time limit (default 10 seconds). For example, run
+// `basix_construction_bench --family N1E --cell tetrahedron
+// --max-degree 10` to see how the construction of N1E elements on
+// tetrahedra scales.
+
+#include <basix/cell.h>
+#include <basix/finite-element.h>
+#include <basix/moments.h>
+#include <basix/stats.h>
+#include "bench-elements.h"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace basix;
+using namespace basix::bench;
+
+//-----------------------------------------------------------------------------
+// Replacements of the global allocation functions that track the number
+// of bytes currently allocated, and the peak, so that the peak heap
+// memory used while an element is created can be measured. The size of
+// each allocation is stored in front of it.
+namespace
+{
+constexpr std::size_t header = alignof(std::max_align_t);
+std::atomic<std::size_t> heap_current = 0;
+std::atomic<std::size_t> heap_peak = 0;
+} // namespace
+
+void* operator new(std::size_t size)
+{
+  void* p = std::malloc(size + header);
+  if (!p)
+    throw std::bad_alloc();
+  *static_cast<std::size_t*>(p) = size;
+  const std::size_t current = heap_current += size;
+  std::size_t peak = heap_peak;
+  while (current > peak and !heap_peak.compare_exchange_weak(peak, current))
+    ;
+  return static_cast<char*>(p) + header;
+}
+
+void operator delete(void* p) noexcept
+{
+  if (!p)
+    return;
+  void* q = static_cast<char*>(p) - header;
+  heap_current -= *static_cast<std::size_t*>(q);
+  std::free(q);
+}
+
+void* operator new[](std::size_t size) { return ::operator new(size); }
+void operator delete[](void* p) noexcept { ::operator delete(p); }
+void operator delete(void* p, std::size_t) noexcept { ::operator delete(p); }
+void operator delete[](void* p, std::size_t) noexcept { ::operator delete(p); }
+//-----------------------------------------------------------------------------
+
+namespace
+{
+/// The stages of the constructor of FiniteElement, in the order in
+/// which they are reported by FiniteElement::construction_times
+const std::vector<std::string> stages
+    = {"dual_matrix",          "coefficients", "entity_transformations",
+       "interpolation_matrix", "entity_dofs",  "dof_transformations"};
+
+/// The measurements for one element
+struct row
+{
+  std::string family;
+  std::string cell;
+  int degree;
+  std::size_t dim;
+  double total;
+  double definition;
+  std::vector<double> stage_times;
+  std::size_t peak_heap;
+  std::size_t footprint;
+};
+
+//-----------------------------------------------------------------------------
+/// Number of bytes of heap memory held by an element
+std::size_t footprint(const FiniteElement<double>& e)
+{
+  std::size_t n = 0;
+  for (auto& [member, bytes] : e.memory_footprint())
+    n += bytes;
+  return n;
+}
+//-----------------------------------------------------------------------------
+/// Create an element and measure its construction, or return nothing
+/// if the element does not exist for the given cell and degree
+std::optional<row> measure(const family_info& f, cell::type cell,
+                           const std::string& cell_name, int degree)
+{
+  // Measure a cold construction, without moments cached by the
+  // construction of earlier elements
+  moments::clear_cache();
+
+  const std::size_t heap_start = heap_current;
+  heap_peak = heap_start;
+  try
+  {
+    auto t0 = std::chrono::steady_clock::now();
+    FiniteElement<double> e = create_element<double>(
+        f.family, cell, degree, f.lvariant, f.dvariant,
+        f.family == element::family::DPC);
+    auto t1 = std::chrono::steady_clock::now();
+
+    row r{f.name,
+          cell_name,
+          degree,
+          static_cast<std::size_t>(e.dim()),
+          std::chrono::duration<double>(t1 - t0).count(),
+          0.0,
+          std::vector<double>(stages.size(), 0.0),
+          heap_peak - heap_start,
+          footprint(e)};
+    for (auto& [name, time] : e.construction_times())
+    {
+      for (std::size_t i = 0; i < stages.size(); ++i)
+        if (stages[i] == name)
+          r.stage_times[i] += time;
+    }
+
+    // Some elements, for example discontinuous elements, are created by
+    // constructing more than one element, so the time spent outside the
+    // stages of the returned element is reported as definition time
+    r.definition = r.total
+                   - std::accumulate(r.stage_times.begin(),
+                                     r.stage_times.end(), 0.0);
+    return r;
+  }
+  catch (const std::exception&)
+  {
+    return std::nullopt;
+  }
+}
+//-----------------------------------------------------------------------------
+void write_csv(const std::vector<row>& rows)
+{
+  std::cout << "family,cell,degree,dim,total_s,definition_s";
+  for (auto& s : stages)
+    std::cout << "," << s << "_s";
+  std::cout << ",peak_heap_bytes,footprint_bytes\n";
+  for (const row& r : rows)
+  {
+    std::cout << r.family << "," << r.cell << "," << r.degree << "," << r.dim
+              << "," << r.total << "," << r.definition;
+    for (double t : r.stage_times)
+      std::cout << "," << t;
+    std::cout << "," << r.peak_heap << "," << r.footprint << "\n";
+  }
+}
+//-----------------------------------------------------------------------------
+void write_json(const std::vector<row>& rows)
+{
+  std::cout << "[";
+  for (std::size_t i = 0; i < rows.size(); ++i)
+  {
+    const row& r = rows[i];
+    std::cout << (i == 0 ? "\n" : ",\n") << "  {\"family\": \"" << r.family
+              << "\", \"cell\": \"" << r.cell << "\", \"degree\": " << r.degree
+              << ", \"dim\": " << r.dim << ", \"total_s\": " << r.total
+              << ", \"definition_s\": " << r.definition;
+    for (std::size_t j = 0; j < stages.size(); ++j)
+      std::cout << ", \"" << stages[j] << "_s\": " << r.stage_times[j];
+    std::cout << ", \"peak_heap_bytes\": " << r.peak_heap
+              << ", \"footprint_bytes\": " << r.footprint << "}";
+  }
+  std::cout << "\n]\n";
+}
+//-----------------------------------------------------------------------------
+} // namespace
+
+int main(int argc, char** argv)
+{
+  std::string family_filter, cell_filter, format = "csv";
+  int max_degree = 5;
+  double time_limit = 10.0;
+  for (int i = 1; i < argc; ++i)
+  {
+    const std::string arg = argv[i];
+    if (i + 1 == argc)
+    {
+      std::cerr << "Missing value for argument " << arg << "\n";
+      return 1;
+    }
+    const std::string value = argv[++i];
+    if (arg == "--family")
+      family_filter = value;
+    else if (arg == "--cell")
+      cell_filter = value;
+    else if (arg == "--max-degree")
+      max_degree = std::stoi(value);
+    else if (arg == "--time-limit")
+      time_limit = std::stod(value);
+    else if (arg == "--format" and (value == "csv" or value == "json"))
+      format = value;
+    else
+    {
+      std::cerr << "Unrecognised argument " << arg << " " << value << "\n";
+      return 1;
+    }
+  }
+
+  // The stage times of an element are only recorded while statistics
+  // are collected
+  stats::set_enabled(true);
+
+  std::vector<row> rows;
+  for (const family_info& f : all_families)
+  {
+    if (!family_filter.empty() and f.name != family_filter)
+      continue;
+    for (auto& [cell, cell_name] : all_cells)
+    {
+      if (!cell_filter.empty() and cell_name != cell_filter)
+        continue;
+      for (int degree = 1; degree <= max_degree; ++degree)
+      {
+        std::optional<row> r = measure(f, cell, cell_name, degree);
+        if (!r)
+          continue;
+        rows.push_back(*r);
+        if (r->total > time_limit)
+          break;
+      }
+    }
+  }
+
+  if (format == "csv")
+    write_csv(rows);
+  else
+    write_json(rows);
+
+  return 0;
+}
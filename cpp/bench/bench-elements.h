@@ -0,0 +1,79 @@
+// Copyright (c) 2024 Basix contributors
+// FEniCS Project
+// SPDX-License-Identifier:    MIT
+
+// The families and cells that are swept by the benchmarks and by the
+// allocation test in test/test_allocations. The Python benchmarks in
+// python/basix/benchmark.py sweep the same families and should be kept
+// in step with this list.
+
+#pragma once
+
+#include <basix/cell.h>
+#include <basix/element-families.h>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace basix::bench
+{
+/// A family of elements, with the variants used to create it
+struct family_info
+{
+  element::family family;
+  std::string name;
+  element::lagrange_variant lvariant;
+  element::dpc_variant dvariant;
+};
+
+/// The families that are benchmarked
+inline const std::vector<family_info> all_families = {
+    {element::family::P, "P", element::lagrange_variant::gll_warped,
+     element::dpc_variant::unset},
+    {element::family::RT, "RT", element::lagrange_variant::legendre,
+     element::dpc_variant::unset},
+    {element::family::N1E, "N1E", element::lagrange_variant::legendre,
+     element::dpc_variant::unset},
+    {element::family::BDM, "BDM", element::lagrange_variant::legendre,
+     element::dpc_variant::legendre},
+    {element::family::N2E, "N2E", element::lagrange_variant::legendre,
+     element::dpc_variant::legendre},
+    {element::family::CR, "CR", element::lagrange_variant::unset,
+     element::dpc_variant::unset},
+    {element::family::Regge, "Regge", element::lagrange_variant::unset,
+     element::dpc_variant::unset},
+    {element::family::HHJ, "HHJ", element::lagrange_variant::unset,
+     element::dpc_variant::unset},
+    {element::family::DPC, "DPC", element::lagrange_variant::unset,
+     element::dpc_variant::legendre},
+    {element::family::bubble, "bubble", element::lagrange_variant::unset,
+     element::dpc_variant::unset},
+    {element::family::serendipity, "serendipity",
+     element::lagrange_variant::legendre, element::dpc_variant::legendre},
+    {element::family::Hermite, "Hermite", element::lagrange_variant::unset,
+     element::dpc_variant::unset},
+    {element::family::iso, "iso", element::lagrange_variant::gll_warped,
+     element::dpc_variant::unset}};
+
+/// The cells that are benchmarked, with their names
+inline const std::vector<std::pair<cell::type, std::string>> all_cells
+    = {{cell::type::interval, "interval"},
+       {cell::type::triangle, "triangle"},
+       {cell::type::quadrilateral, "quadrilateral"},
+       {cell::type::tetrahedron, "tetrahedron"},
+       {cell::type::hexahedron, "hexahedron"},
+       {cell::type::prism, "prism"},
+       {cell::type::pyramid, "pyramid"}};
+
+/// The name of a cell in all_cells
+inline const std::string& cell_name(cell::type cell)
+{
+  for (const auto& [c, name] : all_cells)
+  {
+    if (c == cell)
+      return name;
+  }
+  throw std::runtime_error("Unknown cell type");
+}
+} // namespace basix::bench
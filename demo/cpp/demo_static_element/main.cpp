@@ -0,0 +1,66 @@
+// ===============================
+// Elements fixed at compile time
+// ===============================
+//
+// This demo shows how an element whose cell, family and degree are
+// known at compile time can be represented by a `StaticElement`. The
+// data of a `StaticElement` is held in fixed-size arrays, and its
+// functions take arguments with static extents, so they can be inlined
+// into user kernels without any memory allocation.
+
+#include <basix/finite-element.h>
+#include <basix/static-element.h>
+#include <cmath>
+#include <iostream>
+
+using T = double;
+
+int main(int argc, char* argv[])
+{
+  // Create a degree 2 Lagrange element on a triangle
+  using element_t = basix::StaticElement<
+      basix::cell::type::triangle, basix::element::family::P, 2,
+      basix::element::lagrange_variant::equispaced, T>;
+  element_t element = basix::create_static_element<
+      basix::cell::type::triangle, basix::element::family::P, 2,
+      basix::element::lagrange_variant::equispaced, T>();
+
+  // The number of DOFs is a compile-time constant
+  static_assert(element_t::dim == 6);
+
+  // Tabulate the basis functions and their first derivatives at a fixed
+  // number of points. The sizes of all the arrays are known at compile
+  // time.
+  constexpr std::size_t npoints = 3;
+  std::array<T, npoints * element_t::tdim> x = {0.0, 0.0, 0.2, 0.3, 0.5, 0.5};
+  std::array<T, element_t::nderivs<1> * npoints * element_t::dim> basis;
+  element.tabulate<1, npoints>(element_t::points_type<npoints>(x.data()),
+                               element_t::basis_type<1, npoints>(basis.data()));
+
+  // Compare with the runtime element
+  basix::FiniteElement<T> lagrange = basix::create_element<T>(
+      basix::element::family::P, basix::cell::type::triangle, 2,
+      basix::element::lagrange_variant::equispaced,
+      basix::element::dpc_variant::unset, false);
+  auto [tab, shape] = lagrange.tabulate(1, x, {npoints, element_t::tdim});
+  for (std::size_t i = 0; i < tab.size(); ++i)
+  {
+    if (std::abs(tab[i] - basis[i]) > 1e-12)
+    {
+      std::cerr << "Tabulated values do not match" << std::endl;
+      return 1;
+    }
+  }
+
+  // Apply the DOF transformations for a cell with its first edge
+  // reflected
+  std::array<T, element_t::dim> data = {1, 2, 3, 4, 5, 6};
+  element.pre_apply_dof_transformation(std::span(data), 1);
+
+  std::cout << "Transformed data: [ ";
+  for (T d : data)
+    std::cout << d << " ";
+  std::cout << "]" << std::endl;
+
+  return 0;
+}
@@ -3,13 +3,17 @@
 The core of the library is written in C++, but the majority of Basix's
 functionality can be used via this Python interface.
 """
-from basix import cell, finite_element, lattice, polynomials, quadrature, sobolev_spaces
+from basix import (c_api, cell, codegen, finite_element, lattice, mixed_element, modal, polynomials,
+                   quadrature, sobolev_spaces, stats)
 from basix._basixcpp import __version__
 from basix.cell import CellType, geometry, topology
-from basix.finite_element import DPCVariant, ElementFamily, LagrangeVariant, create_custom_element, create_element
-from basix.interpolation import compute_interpolation_operator
+from basix.finite_element import (DPCVariant, DifferentialOperator, ElementFamily, LagrangeVariant,
+                                  create_custom_element, create_element)
+from basix.interpolation import InterfaceConstraints, compute_interface_constraint, compute_interpolation_operator
 from basix.lattice import LatticeSimplexMethod, LatticeType, create_lattice
 from basix.maps import MapType
+from basix.mixed_element import create_blocked_element, create_mixed_element
+from basix.modal import create_modal_basis
 from basix.polynomials import PolynomialType, PolysetType
 from basix.polynomials import restriction as polyset_restriction
 from basix.polynomials import superset as polyset_superset
@@ -18,9 +22,12 @@ from basix.quadrature import QuadratureType, make_quadrature
 from basix.sobolev_spaces import SobolevSpace
 from basix.utils import index
 
-__all__ = ["cell", "finite_element", "lattice", "polynomials", "quadrature", "sobolev_spaces",
-           "CellType", "DPCVariant", "ElementFamily", "LagrangeVariant", "LatticeSimplexMethod", "LatticeType",
+__all__ = ["c_api", "cell", "codegen", "finite_element", "lattice", "mixed_element", "modal", "polynomials",
+           "quadrature", "sobolev_spaces", "stats",
+           "CellType", "DifferentialOperator", "DPCVariant", "ElementFamily", "LagrangeVariant", "LatticeSimplexMethod",
+           "LatticeType",
            "MapType", "PolynomialType", "PolysetType", "QuadratureType", "SobolevSpace", "__version__",
            "create_lattice", "geometry", "index", "polyset_restriction", "polyset_superset",
            "tabulate_polynomials", "topology", "create_custom_element", "create_element",
-           "make_quadrature", "compute_interpolation_operator"]
+           "make_quadrature", "compute_interpolation_operator", "create_mixed_element", "create_blocked_element",
+           "create_modal_basis", "compute_interface_constraint", "InterfaceConstraints"]
@@ -1,12 +1,18 @@
 from typing import Any, ClassVar
 
 import nanobind
+c_api_function_address: nanobind.nb_func
 cell_facet_jacobians: nanobind.nb_func
 cell_facet_normals: nanobind.nb_func
 cell_facet_orientations: nanobind.nb_func
 cell_facet_outward_normals: nanobind.nb_func
 cell_facet_reference_volumes: nanobind.nb_func
 cell_volume: nanobind.nb_func
+codegen_dof_transformation: nanobind.nb_func
+codegen_preamble: nanobind.nb_func
+codegen_static_element_tables: nanobind.nb_func
+codegen_tabulate: nanobind.nb_func
+compute_interface_constraint: nanobind.nb_func
 compute_interpolation_operator: nanobind.nb_func
 create_custom_element: nanobind.nb_func
 create_element: nanobind.nb_func
@@ -14,9 +20,15 @@ create_lattice: nanobind.nb_func
 geometry: nanobind.nb_func
 index: nanobind.nb_func
 make_quadrature: nanobind.nb_func
+moments_clear_cache: nanobind.nb_func
 polynomials_dim: nanobind.nb_func
 restriction: nanobind.nb_func
 sobolev_space_intersection: nanobind.nb_func
+stats_enabled: nanobind.nb_func
+stats_read: nanobind.nb_func
+stats_read_element: nanobind.nb_func
+stats_reset: nanobind.nb_func
+stats_set_enabled: nanobind.nb_func
 sub_entity_connectivity: nanobind.nb_func
 sub_entity_geometry: nanobind.nb_func
 superset: nanobind.nb_func
@@ -25,6 +37,66 @@ tabulate_polynomials: nanobind.nb_func
 topology: nanobind.nb_func
 __version__: str
 
+class BlockedElement_float32:
+    def __init__(self, *args, **kwargs) -> None: ...
+    def permute_dofs(self, *args, **kwargs) -> Any: ...
+    def post_apply_dof_transformation(self, *args, **kwargs) -> Any: ...
+    def post_apply_inverse_dof_transformation(self, *args, **kwargs) -> Any: ...
+    def post_apply_inverse_transpose_dof_transformation(self, *args, **kwargs) -> Any: ...
+    def post_apply_transpose_dof_transformation(self, *args, **kwargs) -> Any: ...
+    def pre_apply_dof_transformation(self, *args, **kwargs) -> Any: ...
+    def pre_apply_inverse_dof_transformation(self, *args, **kwargs) -> Any: ...
+    def pre_apply_inverse_transpose_dof_transformation(self, *args, **kwargs) -> Any: ...
+    def pre_apply_transpose_dof_transformation(self, *args, **kwargs) -> Any: ...
+    def tabulate(self, *args, **kwargs) -> Any: ...
+    def unpermute_dofs(self, *args, **kwargs) -> Any: ...
+    @property
+    def block_size(self) -> int: ...
+    @property
+    def cell_type(self) -> CellType: ...
+    @property
+    def dim(self) -> int: ...
+    @property
+    def dof_transformations_are_identity(self) -> bool: ...
+    @property
+    def dof_transformations_are_permutations(self) -> bool: ...
+    @property
+    def entity_closure_dofs(self) -> list[list[list[int]]]: ...
+    @property
+    def entity_dofs(self) -> list[list[list[int]]]: ...
+    @property
+    def value_size(self) -> int: ...
+
+class BlockedElement_float64:
+    def __init__(self, *args, **kwargs) -> None: ...
+    def permute_dofs(self, *args, **kwargs) -> Any: ...
+    def post_apply_dof_transformation(self, *args, **kwargs) -> Any: ...
+    def post_apply_inverse_dof_transformation(self, *args, **kwargs) -> Any: ...
+    def post_apply_inverse_transpose_dof_transformation(self, *args, **kwargs) -> Any: ...
+    def post_apply_transpose_dof_transformation(self, *args, **kwargs) -> Any: ...
+    def pre_apply_dof_transformation(self, *args, **kwargs) -> Any: ...
+    def pre_apply_inverse_dof_transformation(self, *args, **kwargs) -> Any: ...
+    def pre_apply_inverse_transpose_dof_transformation(self, *args, **kwargs) -> Any: ...
+    def pre_apply_transpose_dof_transformation(self, *args, **kwargs) -> Any: ...
+    def tabulate(self, *args, **kwargs) -> Any: ...
+    def unpermute_dofs(self, *args, **kwargs) -> Any: ...
+    @property
+    def block_size(self) -> int: ...
+    @property
+    def cell_type(self) -> CellType: ...
+    @property
+    def dim(self) -> int: ...
+    @property
+    def dof_transformations_are_identity(self) -> bool: ...
+    @property
+    def dof_transformations_are_permutations(self) -> bool: ...
+    @property
+    def entity_closure_dofs(self) -> list[list[list[int]]]: ...
+    @property
+    def entity_dofs(self) -> list[list[list[int]]]: ...
+    @property
+    def value_size(self) -> int: ...
+
 class CellType:
     __entries__: ClassVar[dict] = ...
     hexahedron: ClassVar[CellType] = ...
@@ -48,6 +120,23 @@ class CellType:
     @property
     def name(self) -> str: ...
 
+class CodegenLanguage:
+    __entries__: ClassVar[dict] = ...
+    C: ClassVar[CodegenLanguage] = ...
+    CPP: ClassVar[CodegenLanguage] = ...
+    __name__: str
+    def __init__(self, *args, **kwargs) -> None: ...
+    def __eq__(self, other) -> bool: ...
+    def __ge__(self, other) -> bool: ...
+    def __gt__(self, other) -> bool: ...
+    def __hash__(self) -> int: ...
+    def __int__(self) -> int: ...
+    def __le__(self, other) -> bool: ...
+    def __lt__(self, other) -> bool: ...
+    def __ne__(self, other) -> bool: ...
+    @property
+    def name(self) -> str: ...
+
 class DPCVariant:
     __entries__: ClassVar[dict] = ...
     diagonal_equispaced: ClassVar[DPCVariant] = ...
@@ -71,6 +160,48 @@ class DPCVariant:
     @property
     def name(self) -> str: ...
 
+class DifferentialOperator:
+    __entries__: ClassVar[dict] = ...
+    curl: ClassVar[DifferentialOperator] = ...
+    divergence: ClassVar[DifferentialOperator] = ...
+    symmetric_gradient: ClassVar[DifferentialOperator] = ...
+    trace: ClassVar[DifferentialOperator] = ...
+    __name__: str
+    def __init__(self, *args, **kwargs) -> None: ...
+    def __eq__(self, other) -> bool: ...
+    def __ge__(self, other) -> bool: ...
+    def __gt__(self, other) -> bool: ...
+    def __hash__(self) -> int: ...
+    def __int__(self) -> int: ...
+    def __le__(self, other) -> bool: ...
+    def __lt__(self, other) -> bool: ...
+    def __ne__(self, other) -> bool: ...
+    @property
+    def name(self) -> str: ...
+
+class DofTransformationType:
+    __entries__: ClassVar[dict] = ...
+    post_apply: ClassVar[DofTransformationType] = ...
+    post_apply_inverse: ClassVar[DofTransformationType] = ...
+    post_apply_inverse_transpose: ClassVar[DofTransformationType] = ...
+    post_apply_transpose: ClassVar[DofTransformationType] = ...
+    pre_apply: ClassVar[DofTransformationType] = ...
+    pre_apply_inverse: ClassVar[DofTransformationType] = ...
+    pre_apply_inverse_transpose: ClassVar[DofTransformationType] = ...
+    pre_apply_transpose: ClassVar[DofTransformationType] = ...
+    __name__: str
+    def __init__(self, *args, **kwargs) -> None: ...
+    def __eq__(self, other) -> bool: ...
+    def __ge__(self, other) -> bool: ...
+    def __gt__(self, other) -> bool: ...
+    def __hash__(self) -> int: ...
+    def __int__(self) -> int: ...
+    def __le__(self, other) -> bool: ...
+    def __lt__(self, other) -> bool: ...
+    def __ne__(self, other) -> bool: ...
+    @property
+    def name(self) -> str: ...
+
 class ElementFamily:
     __entries__: ClassVar[dict] = ...
     BDM: ClassVar[ElementFamily] = ...
@@ -102,15 +233,23 @@ class ElementFamily:
 
 class FiniteElement_float32:
     def __init__(self, *args, **kwargs) -> None: ...
+    def __getstate__(self) -> bytes: ...
+    def __setstate__(self, state: bytes) -> None: ...
     def base_transformations(self, *args, **kwargs) -> Any: ...
     def entity_transformations(self) -> dict: ...
     def get_tensor_product_representation(self) -> list[tuple[list[FiniteElement_float32],list[int]]]: ...
+    def memory_footprint(self) -> dict[str, int]: ...
+    def physical_operator_size(self, op: DifferentialOperator, gdim: int) -> int: ...
     def post_apply_transpose_dof_transformation(self, *args, **kwargs) -> Any: ...
     def pre_apply_dof_transformation(self, *args, **kwargs) -> Any: ...
     def pre_apply_inverse_transpose_dof_transformation(self, *args, **kwargs) -> Any: ...
     def pull_back(self, *args, **kwargs) -> Any: ...
     def push_forward(self, *args, **kwargs) -> Any: ...
+    def push_forward_operator(self, *args, **kwargs) -> Any: ...
     def tabulate(self, *args, **kwargs) -> Any: ...
+    def tabulate_batch(self, *args, **kwargs) -> Any: ...
+    def tabulate_directional_derivative(self, *args, **kwargs) -> Any: ...
+    def tabulate_operator(self, *args, **kwargs) -> Any: ...
     def __eq__(self, other) -> Any: ...
     @property
     def M(self) -> Any: ...
@@ -119,6 +258,8 @@ class FiniteElement_float32:
     @property
     def coefficient_matrix(self) -> Any: ...
     @property
+    def construction_times(self) -> list[tuple[str, float]]: ...
+    @property
     def degree(self) -> int: ...
     @property
     def dim(self) -> int: ...
@@ -147,6 +288,10 @@ class FiniteElement_float32:
     @property
     def family(self) -> ElementFamily: ...
     @property
+    def fingerprint(self) -> int: ...
+    @property
+    def handle(self) -> int: ...
+    @property
     def has_tensor_product_factorisation(self) -> bool: ...
     @property
     def interpolation_is_identity(self) -> bool: ...
@@ -179,15 +324,23 @@ class FiniteElement_float32:
 
 class FiniteElement_float64:
     def __init__(self, *args, **kwargs) -> None: ...
+    def __getstate__(self) -> bytes: ...
+    def __setstate__(self, state: bytes) -> None: ...
     def base_transformations(self, *args, **kwargs) -> Any: ...
     def entity_transformations(self) -> dict: ...
     def get_tensor_product_representation(self) -> list[tuple[list[FiniteElement_float64],list[int]]]: ...
+    def memory_footprint(self) -> dict[str, int]: ...
+    def physical_operator_size(self, op: DifferentialOperator, gdim: int) -> int: ...
     def post_apply_transpose_dof_transformation(self, *args, **kwargs) -> Any: ...
     def pre_apply_dof_transformation(self, *args, **kwargs) -> Any: ...
     def pre_apply_inverse_transpose_dof_transformation(self, *args, **kwargs) -> Any: ...
     def pull_back(self, *args, **kwargs) -> Any: ...
     def push_forward(self, *args, **kwargs) -> Any: ...
+    def push_forward_operator(self, *args, **kwargs) -> Any: ...
     def tabulate(self, *args, **kwargs) -> Any: ...
+    def tabulate_batch(self, *args, **kwargs) -> Any: ...
+    def tabulate_directional_derivative(self, *args, **kwargs) -> Any: ...
+    def tabulate_operator(self, *args, **kwargs) -> Any: ...
     def __eq__(self, other) -> Any: ...
     @property
     def M(self) -> Any: ...
@@ -196,6 +349,8 @@ class FiniteElement_float64:
     @property
     def coefficient_matrix(self) -> Any: ...
     @property
+    def construction_times(self) -> list[tuple[str, float]]: ...
+    @property
     def degree(self) -> int: ...
     @property
     def dim(self) -> int: ...
@@ -224,6 +379,10 @@ class FiniteElement_float64:
     @property
     def family(self) -> ElementFamily: ...
     @property
+    def fingerprint(self) -> int: ...
+    @property
+    def handle(self) -> int: ...
+    @property
     def has_tensor_product_factorisation(self) -> bool: ...
     @property
     def interpolation_is_identity(self) -> bool: ...
@@ -254,6 +413,16 @@ class FiniteElement_float64:
     @property
     def x(self) -> Any: ...
 
+class InterfaceConstraints_float32:
+    def __init__(self, *args, **kwargs) -> None: ...
+    def constraint(self, *args, **kwargs) -> Any: ...
+    def __len__(self) -> int: ...
+
+class InterfaceConstraints_float64:
+    def __init__(self, *args, **kwargs) -> None: ...
+    def constraint(self, *args, **kwargs) -> Any: ...
+    def __len__(self) -> int: ...
+
 class LagrangeVariant:
     __entries__: ClassVar[dict] = ...
     bernstein: ClassVar[LagrangeVariant] = ...
@@ -341,6 +510,138 @@ class MapType:
     @property
     def name(self) -> str: ...
 
+class MixedElement_float32:
+    def __init__(self, *args, **kwargs) -> None: ...
+    def permute_dofs(self, *args, **kwargs) -> Any: ...
+    def post_apply_dof_transformation(self, *args, **kwargs) -> Any: ...
+    def post_apply_inverse_dof_transformation(self, *args, **kwargs) -> Any: ...
+    def post_apply_inverse_transpose_dof_transformation(self, *args, **kwargs) -> Any: ...
+    def post_apply_transpose_dof_transformation(self, *args, **kwargs) -> Any: ...
+    def pre_apply_dof_transformation(self, *args, **kwargs) -> Any: ...
+    def pre_apply_inverse_dof_transformation(self, *args, **kwargs) -> Any: ...
+    def pre_apply_inverse_transpose_dof_transformation(self, *args, **kwargs) -> Any: ...
+    def pre_apply_transpose_dof_transformation(self, *args, **kwargs) -> Any: ...
+    def tabulate(self, *args, **kwargs) -> Any: ...
+    def unpermute_dofs(self, *args, **kwargs) -> Any: ...
+    @property
+    def cell_type(self) -> CellType: ...
+    @property
+    def dim(self) -> int: ...
+    @property
+    def dof_offsets(self) -> list[int]: ...
+    @property
+    def dof_transformations_are_identity(self) -> bool: ...
+    @property
+    def dof_transformations_are_permutations(self) -> bool: ...
+    @property
+    def entity_closure_dofs(self) -> list[list[list[int]]]: ...
+    @property
+    def entity_dofs(self) -> list[list[list[int]]]: ...
+    @property
+    def interpolation_matrix(self) -> Any: ...
+    @property
+    def interpolation_nderivs(self) -> int: ...
+    @property
+    def num_sub_elements(self) -> int: ...
+    @property
+    def point_maps(self) -> list[list[int]]: ...
+    @property
+    def points(self) -> Any: ...
+    @property
+    def value_offsets(self) -> list[int]: ...
+    @property
+    def value_size(self) -> int: ...
+
+class MixedElement_float64:
+    def __init__(self, *args, **kwargs) -> None: ...
+    def permute_dofs(self, *args, **kwargs) -> Any: ...
+    def post_apply_dof_transformation(self, *args, **kwargs) -> Any: ...
+    def post_apply_inverse_dof_transformation(self, *args, **kwargs) -> Any: ...
+    def post_apply_inverse_transpose_dof_transformation(self, *args, **kwargs) -> Any: ...
+    def post_apply_transpose_dof_transformation(self, *args, **kwargs) -> Any: ...
+    def pre_apply_dof_transformation(self, *args, **kwargs) -> Any: ...
+    def pre_apply_inverse_dof_transformation(self, *args, **kwargs) -> Any: ...
+    def pre_apply_inverse_transpose_dof_transformation(self, *args, **kwargs) -> Any: ...
+    def pre_apply_transpose_dof_transformation(self, *args, **kwargs) -> Any: ...
+    def tabulate(self, *args, **kwargs) -> Any: ...
+    def unpermute_dofs(self, *args, **kwargs) -> Any: ...
+    @property
+    def cell_type(self) -> CellType: ...
+    @property
+    def dim(self) -> int: ...
+    @property
+    def dof_offsets(self) -> list[int]: ...
+    @property
+    def dof_transformations_are_identity(self) -> bool: ...
+    @property
+    def dof_transformations_are_permutations(self) -> bool: ...
+    @property
+    def entity_closure_dofs(self) -> list[list[list[int]]]: ...
+    @property
+    def entity_dofs(self) -> list[list[list[int]]]: ...
+    @property
+    def interpolation_matrix(self) -> Any: ...
+    @property
+    def interpolation_nderivs(self) -> int: ...
+    @property
+    def num_sub_elements(self) -> int: ...
+    @property
+    def point_maps(self) -> list[list[int]]: ...
+    @property
+    def points(self) -> Any: ...
+    @property
+    def value_offsets(self) -> list[int]: ...
+    @property
+    def value_size(self) -> int: ...
+
+class ModalBasis_float32:
+    def __init__(self, *args, **kwargs) -> None: ...
+    def apply_filter(self, *args, **kwargs) -> Any: ...
+    def cutoff_filter(self, *args, **kwargs) -> Any: ...
+    def decay_rate(self, *args, **kwargs) -> Any: ...
+    def exponential_filter(self, *args, **kwargs) -> Any: ...
+    def filter_matrix(self, *args, **kwargs) -> Any: ...
+    def modal_energy(self, *args, **kwargs) -> Any: ...
+    def smoothness_indicator(self, *args, **kwargs) -> Any: ...
+    def to_modal(self, *args, **kwargs) -> Any: ...
+    def to_nodal(self, *args, **kwargs) -> Any: ...
+    @property
+    def degree(self) -> int: ...
+    @property
+    def dim(self) -> int: ...
+    @property
+    def modal_to_nodal(self) -> Any: ...
+    @property
+    def mode_degrees(self) -> list[int]: ...
+    @property
+    def nodal_to_modal(self) -> Any: ...
+    @property
+    def num_modes(self) -> int: ...
+
+class ModalBasis_float64:
+    def __init__(self, *args, **kwargs) -> None: ...
+    def apply_filter(self, *args, **kwargs) -> Any: ...
+    def cutoff_filter(self, *args, **kwargs) -> Any: ...
+    def decay_rate(self, *args, **kwargs) -> Any: ...
+    def exponential_filter(self, *args, **kwargs) -> Any: ...
+    def filter_matrix(self, *args, **kwargs) -> Any: ...
+    def modal_energy(self, *args, **kwargs) -> Any: ...
+    def smoothness_indicator(self, *args, **kwargs) -> Any: ...
+    def to_modal(self, *args, **kwargs) -> Any: ...
+    def to_nodal(self, *args, **kwargs) -> Any: ...
+    @property
+    def degree(self) -> int: ...
+    @property
+    def dim(self) -> int: ...
+    @property
+    def modal_to_nodal(self) -> Any: ...
+    @property
+    def mode_degrees(self) -> list[int]: ...
+    @property
+    def nodal_to_modal(self) -> Any: ...
+    @property
+    def num_modes(self) -> int: ...
+
 class PolynomialType:
     __entries__: ClassVar[dict] = ...
     bernstein: ClassVar[PolynomialType] = ...
@@ -417,3 +718,27 @@ class SobolevSpace:
     def __ne__(self, other) -> bool: ...
     @property
     def name(self) -> str: ...
+
+class TabulationStream_float32:
+    def __init__(self, *args, **kwargs) -> None: ...
+    def next(self) -> bool: ...
+    @property
+    def chunk_size(self) -> int: ...
+    @property
+    def num_points(self) -> int: ...
+    @property
+    def points(self) -> Any: ...
+    @property
+    def table(self) -> Any: ...
+
+class TabulationStream_float64:
+    def __init__(self, *args, **kwargs) -> None: ...
+    def next(self) -> bool: ...
+    @property
+    def chunk_size(self) -> int: ...
+    @property
+    def num_points(self) -> int: ...
+    @property
+    def points(self) -> Any: ...
+    @property
+    def table(self) -> Any: ...
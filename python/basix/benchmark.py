@@ -0,0 +1,179 @@
+"""Benchmark of the construction of elements.
+
+For each family, cell and degree, an element is created and the wall
+time of each stage of its construction, the peak memory of the process
+and the memory held by the element are recorded as a row of a table.
+Run ``python -m basix.benchmark --help`` for the options, for example::
+
+    python -m basix.benchmark --family N1E --cell tetrahedron --max-degree 10
+
+The ``basix_construction_bench`` program, which is built with the C++
+benchmarks, produces the same table. It measures the peak heap memory
+used by each construction, rather than the peak memory of the process.
+"""
+
+import argparse
+import csv
+import json
+import sys
+import time
+import typing
+
+import numpy as np
+import numpy.typing as npt
+
+from basix import stats as _stats
+from basix.cell import CellType, string_to_type
+from basix.finite_element import DPCVariant, ElementFamily, LagrangeVariant, clear_moment_cache, create_element
+
+try:
+    import resource as _resource
+except ImportError:  # pragma: no cover
+    _resource = None  # type: ignore
+
+__all__ = ["stages", "all_families", "construction_benchmark", "main"]
+
+# The stages of the construction of an element, in the order in which
+# they are reported by FiniteElement.construction_times
+stages = ["dual_matrix", "coefficients", "entity_transformations", "interpolation_matrix", "entity_dofs",
+          "dof_transformations"]
+
+# The families that are benchmarked, with the variants used to create
+# them
+all_families = [
+    (ElementFamily.P, LagrangeVariant.gll_warped, DPCVariant.unset),
+    (ElementFamily.RT, LagrangeVariant.legendre, DPCVariant.unset),
+    (ElementFamily.N1E, LagrangeVariant.legendre, DPCVariant.unset),
+    (ElementFamily.BDM, LagrangeVariant.legendre, DPCVariant.legendre),
+    (ElementFamily.N2E, LagrangeVariant.legendre, DPCVariant.legendre),
+    (ElementFamily.CR, LagrangeVariant.unset, DPCVariant.unset),
+    (ElementFamily.Regge, LagrangeVariant.unset, DPCVariant.unset),
+    (ElementFamily.HHJ, LagrangeVariant.unset, DPCVariant.unset),
+    (ElementFamily.DPC, LagrangeVariant.unset, DPCVariant.legendre),
+    (ElementFamily.bubble, LagrangeVariant.unset, DPCVariant.unset),
+    (ElementFamily.serendipity, LagrangeVariant.legendre, DPCVariant.legendre),
+    (ElementFamily.Hermite, LagrangeVariant.unset, DPCVariant.unset),
+    (ElementFamily.iso, LagrangeVariant.gll_warped, DPCVariant.unset),
+]
+
+_all_cells = [CellType.interval, CellType.triangle, CellType.quadrilateral, CellType.tetrahedron,
+              CellType.hexahedron, CellType.prism, CellType.pyramid]
+
+
+def _max_rss() -> int:
+    """Peak resident set size of the process in bytes, or 0 if unknown."""
+    if _resource is None:
+        return 0
+    rss = _resource.getrusage(_resource.RUSAGE_SELF).ru_maxrss
+    # ru_maxrss is in bytes on macOS and in kilobytes elsewhere
+    return rss if sys.platform == "darwin" else rss * 1024
+
+
+def construction_benchmark(families: typing.Optional[list[ElementFamily]] = None,
+                           cells: typing.Optional[list[CellType]] = None, max_degree: int = 5,
+                           time_limit: float = 10.0, dtype: npt.DTypeLike = np.float64) -> list[dict]:
+    """Measure the construction of elements.
+
+    The degrees 1 to ``max_degree`` are swept for each family and cell.
+    Larger degrees of a family on a cell are skipped after a
+    construction takes longer than ``time_limit`` seconds. Elements that
+    do not exist for a cell and degree are skipped.
+
+    Args:
+        families: The families to benchmark. If not given, all families
+            are benchmarked.
+        cells: The cells to benchmark. If not given, all cells except
+            the point are benchmarked.
+        max_degree: The highest degree.
+        time_limit: The construction time in seconds after which larger
+            degrees are skipped.
+        dtype: Element scalar type.
+
+    Returns:
+        A row for each element, with the family, cell, degree and
+        dimension of the element, the total time (``total_s``), the time
+        taken to define the element before its construction
+        (``definition_s``), the time of each stage of its construction
+        (``<stage>_s``), the peak resident set size of the process after
+        the construction (``max_rss_bytes``) and the number of bytes of
+        heap memory held by the element (``footprint_bytes``).
+
+    The cache of moments is cleared before each element is created, so
+    the measurements are of a cold construction.
+
+    Statistics are collected (see :mod:`basix.stats`) while the
+    benchmark runs, so that the stage times are recorded.
+    """
+    collecting = _stats.enabled()
+    _stats.enable()
+    rows = []
+    try:
+        for family, lvariant, dvariant in all_families:
+            if families is not None and family not in families:
+                continue
+            for cell in _all_cells:
+                if cells is not None and cell not in cells:
+                    continue
+                for degree in range(1, max_degree + 1):
+                    clear_moment_cache()
+                    start = time.perf_counter()
+                    try:
+                        e = create_element(family, cell, degree, lvariant, dvariant,
+                                           discontinuous=family == ElementFamily.DPC, dtype=dtype)
+                    except RuntimeError:
+                        continue
+                    total = time.perf_counter() - start
+
+                    stage_times = {f"{s}_s": 0.0 for s in stages}
+                    for name, t in e.construction_times:
+                        stage_times[f"{name}_s"] += t
+                    rows.append({"family": family.name, "cell": cell.name, "degree": degree, "dim": e.dim,
+                                 "total_s": total, "definition_s": total - sum(stage_times.values()), **stage_times,
+                                 "max_rss_bytes": _max_rss(), "footprint_bytes": sum(e.memory_footprint().values())})
+                    if total > time_limit:
+                        break
+    finally:
+        if not collecting:
+            _stats.disable()
+    return rows
+
+
+def main(argv: typing.Optional[list[str]] = None) -> int:
+    """Run the benchmark and write the table to standard output.
+
+    Args:
+        argv: The command line arguments. If not given, ``sys.argv`` is
+            used.
+
+    Returns:
+        The exit code.
+    """
+    parser = argparse.ArgumentParser(prog="python -m basix.benchmark",
+                                     description="Benchmark of the construction of elements.")
+    parser.add_argument("--family", action="append", help="family to benchmark (may be repeated)")
+    parser.add_argument("--cell", action="append", help="cell to benchmark (may be repeated)")
+    parser.add_argument("--max-degree", type=int, default=5, help="highest degree")
+    parser.add_argument("--time-limit", type=float, default=10.0,
+                        help="construction time in seconds after which larger degrees are skipped")
+    parser.add_argument("--dtype", choices=["float32", "float64"], default="float64")
+    parser.add_argument("--format", choices=["csv", "json"], default="csv")
+    args = parser.parse_args(argv)
+
+    families = None if args.family is None else [getattr(ElementFamily, f) for f in args.family]
+    cells = None if args.cell is None else [string_to_type(c) for c in args.cell]
+    rows = construction_benchmark(families, cells, args.max_degree, args.time_limit, np.dtype(args.dtype))
+
+    if args.format == "json":
+        json.dump(rows, sys.stdout, indent=2)
+        sys.stdout.write("\n")
+    else:
+        fields = ["family", "cell", "degree", "dim", "total_s", "definition_s"] + [f"{s}_s" for s in stages] + [
+            "max_rss_bytes", "footprint_bytes"]
+        writer = csv.DictWriter(sys.stdout, fieldnames=fields)
+        writer.writeheader()
+        writer.writerows(rows)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,90 @@
+"""C interface to the runtime functions of finite elements.
+
+The functions in this module are C functions that take the handle of
+an element and pointers to C-contiguous arrays. They can be called from inside Numba-jitted code, or through
+cffi, with no Python overhead, for example to evaluate basis functions
+at each point of a particle method::
+
+    tabulate = basix.c_api.tabulate_float64
+    handle = element.handle_float64
+
+    @numba.njit
+    def kernel(x, basis):
+        tabulate(handle, 0, x.ctypes, x.shape[0], basis.ctypes)
+
+The ``kind`` argument of the DOF transformation functions is the value
+of a :class:`basix.codegen.DofTransformationType`, for example
+``int(DofTransformationType.pre_apply.value)``.
+
+The handle is an integer, so a C function cannot check the float type
+of the element that it is given: passing the handle of a ``float32``
+element to a ``_float64`` function is undefined behaviour. Take the
+handle from :attr:`FiniteElement.handle_float64` or
+:attr:`FiniteElement.handle_float32`, which raise an error if the
+element has a different float type, to the function with the same
+suffix.
+
+The functions return 0 on success, and a non-zero value if an error
+occurred, in which case :func:`last_error` describes the error. The
+element must be kept alive while its handle is in use.
+"""
+
+import ctypes as _ctypes
+
+from basix._basixcpp import c_api_function_address as _function_address
+
+__all__ = ["cdef", "last_error", "tabulate_float64", "tabulate_float32",
+           "dof_transformation_float64", "dof_transformation_float32", "push_forward_float64",
+           "push_forward_float32"]
+
+# Declarations of the C functions, in the format used by cffi.FFI.cdef
+cdef = """
+typedef struct basix_element_float64 basix_element_float64;
+typedef struct basix_element_float32 basix_element_float32;
+const char* basix_last_error(void);
+int basix_tabulate_float64(const basix_element_float64* element, int nd, const double* x, size_t num_points,
+                           double* basis);
+int basix_tabulate_float32(const basix_element_float32* element, int nd, const float* x, size_t num_points,
+                           float* basis);
+int basix_dof_transformation_float64(const basix_element_float64* element, int kind, double* data, int block_size,
+                                     uint32_t cell_info);
+int basix_dof_transformation_float32(const basix_element_float32* element, int kind, float* data, int block_size,
+                                     uint32_t cell_info);
+int basix_push_forward_float64(const basix_element_float64* element, const double* U, const double* J,
+                               const double* detJ, const double* K, size_t num_points, size_t num_functions,
+                               size_t gdim, double* u);
+int basix_push_forward_float32(const basix_element_float32* element, const float* U, const float* J,
+                               const float* detJ, const float* K, size_t num_points, size_t num_functions,
+                               size_t gdim, float* u);
+"""
+
+# The element handle is passed as an integer, so that Numba can pass
+# the value of FiniteElement.handle_float64 (or handle_float32) without
+# a cast. All arrays are passed as void pointers, so that Numba can pass
+# the ctypes attribute of an array.
+_handle = _ctypes.c_size_t
+_ptr = _ctypes.c_void_p
+
+tabulate_float64 = _ctypes.CFUNCTYPE(_ctypes.c_int, _handle, _ctypes.c_int, _ptr, _ctypes.c_size_t, _ptr)(
+    _function_address("basix_tabulate_float64"))
+tabulate_float32 = _ctypes.CFUNCTYPE(_ctypes.c_int, _handle, _ctypes.c_int, _ptr, _ctypes.c_size_t, _ptr)(
+    _function_address("basix_tabulate_float32"))
+dof_transformation_float64 = _ctypes.CFUNCTYPE(_ctypes.c_int, _handle, _ctypes.c_int, _ptr, _ctypes.c_int,
+                                               _ctypes.c_uint32)(
+    _function_address("basix_dof_transformation_float64"))
+dof_transformation_float32 = _ctypes.CFUNCTYPE(_ctypes.c_int, _handle, _ctypes.c_int, _ptr, _ctypes.c_int,
+                                               _ctypes.c_uint32)(
+    _function_address("basix_dof_transformation_float32"))
+push_forward_float64 = _ctypes.CFUNCTYPE(_ctypes.c_int, _handle, _ptr, _ptr, _ptr, _ptr, _ctypes.c_size_t,
+                                         _ctypes.c_size_t, _ctypes.c_size_t, _ptr)(
+    _function_address("basix_push_forward_float64"))
+push_forward_float32 = _ctypes.CFUNCTYPE(_ctypes.c_int, _handle, _ptr, _ptr, _ptr, _ptr, _ctypes.c_size_t,
+                                         _ctypes.c_size_t, _ctypes.c_size_t, _ptr)(
+    _function_address("basix_push_forward_float32"))
+
+_last_error = _ctypes.CFUNCTYPE(_ctypes.c_char_p)(_function_address("basix_last_error"))
+
+
+def last_error() -> str:
+    """Get the description of the last error that occurred on this thread."""
+    return _last_error().decode()
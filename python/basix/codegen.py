@@ -0,0 +1,110 @@
+"""Generation of C and C++ code for finite elements.
+
+The code generated by these functions has no dependency on Basix, so it
+can be inlined into kernels created by form compilers.
+"""
+
+import numpy.typing as npt
+
+from basix._basixcpp import CodegenLanguage as _CL
+from basix._basixcpp import DofTransformationType as _DTT
+from basix._basixcpp import codegen_dof_transformation as _dof_transformation
+from basix._basixcpp import codegen_preamble as _preamble
+from basix._basixcpp import codegen_static_element_tables as _static_element_tables
+from basix._basixcpp import codegen_tabulate as _tabulate
+from basix.finite_element import FiniteElement
+from basix.utils import Enum
+
+__all__ = ["preamble", "tabulate", "dof_transformation", "static_element_tables"]
+
+
+class CodegenLanguage(Enum):
+    """Language of generated code."""
+    C = _CL.C
+    CPP = _CL.CPP
+
+
+class DofTransformationType(Enum):
+    """DOF transformation kernel."""
+    pre_apply = _DTT.pre_apply
+    pre_apply_transpose = _DTT.pre_apply_transpose
+    pre_apply_inverse = _DTT.pre_apply_inverse
+    pre_apply_inverse_transpose = _DTT.pre_apply_inverse_transpose
+    post_apply = _DTT.post_apply
+    post_apply_transpose = _DTT.post_apply_transpose
+    post_apply_inverse = _DTT.post_apply_inverse
+    post_apply_inverse_transpose = _DTT.post_apply_inverse_transpose
+
+
+def preamble(language: CodegenLanguage = CodegenLanguage.C) -> str:
+    """Get the lines that generated code needs to be preceded by.
+
+    Args:
+        language: The language of the generated code.
+
+    Returns:
+        The ``#include`` lines.
+    """
+    return _preamble(language.value)
+
+
+def tabulate(element: FiniteElement, n: int, x: npt.NDArray, name: str,
+             language: CodegenLanguage = CodegenLanguage.C) -> str:
+    """Generate a table of the basis functions of an element at fixed points.
+
+    The table is a static array with the same shape as the output of
+    :func:`basix.finite_element.FiniteElement.tabulate`.
+
+    Args:
+        element: The element.
+        n: The order of derivatives, up to and including, to compute.
+            Use 0 for the basis functions only.
+        x: The points at which to compute the basis functions. The
+            shape of x is (number of points, geometric dimension).
+        name: The name of the array.
+        language: The language of the generated code.
+
+    Returns:
+        The generated code.
+    """
+    return _tabulate(element._e, n, x, name, language.value)
+
+
+def dof_transformation(element: FiniteElement, name: str,
+                       kind: DofTransformationType = DofTransformationType.pre_apply,
+                       language: CodegenLanguage = CodegenLanguage.C) -> str:
+    """Generate a DOF transformation kernel for an element.
+
+    The kernel has the signature ``void name(T* data, int block_size,
+    uint32_t cell_info)`` and has the same effect as the
+    :class:`basix.finite_element.FiniteElement` method with the same name
+    as ``kind``. All transformation matrices are written out explicitly.
+
+    Args:
+        element: The element.
+        name: The name of the function.
+        kind: The transformation to generate.
+        language: The language of the generated code.
+
+    Returns:
+        The generated code.
+    """
+    return _dof_transformation(element._e, kind.value, name, language.value)
+
+
+def static_element_tables(element: FiniteElement, name: str) -> str:
+    """Generate the tables of a C++ StaticElement.
+
+    The generated C++ code is a ``constexpr`` initialiser of
+    ``basix::StaticElement::tables``. Unlike the other generated code,
+    it must be compiled with ``basix/static-element.h`` included.
+
+    Args:
+        element: The element. This must be a Lagrange, Raviart-Thomas or
+            Nédélec first kind element.
+        name: The name of the variable.
+
+    Returns:
+        The generated code.
+    """
+    return _static_element_tables(element._e, name)
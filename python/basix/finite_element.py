@@ -6,20 +6,24 @@ import numpy as np
 import numpy.typing as npt
 
 from basix._basixcpp import DPCVariant as _DPCV
+from basix._basixcpp import DifferentialOperator as _DO
 from basix._basixcpp import ElementFamily as _EF
 from basix._basixcpp import FiniteElement_float32 as _FiniteElement_float32
 from basix._basixcpp import FiniteElement_float64 as _FiniteElement_float64
 from basix._basixcpp import LagrangeVariant as _LV
+from basix._basixcpp import TabulationStream_float32 as _TabulationStream_float32
+from basix._basixcpp import TabulationStream_float64 as _TabulationStream_float64
 from basix._basixcpp import create_custom_element as _create_custom_element
 from basix._basixcpp import create_element as _create_element
+from basix._basixcpp import moments_clear_cache as _moments_clear_cache
 from basix.cell import CellType
 from basix.maps import MapType
 from basix.polynomials import PolysetType
 from basix.sobolev_spaces import SobolevSpace
 from basix.utils import Enum
 
-__all__ = ["FiniteElement", "create_element", "create_custom_element", "string_to_family",
-           "string_to_lagrange_variant", "string_to_dpc_variant"]
+__all__ = ["FiniteElement", "DifferentialOperator", "create_element", "create_custom_element", "string_to_family",
+           "string_to_lagrange_variant", "string_to_dpc_variant", "clear_moment_cache"]
 
 
 class ElementFamily(Enum):
@@ -69,8 +73,26 @@ class DPCVariant(Enum):
     legendre = _DPCV.legendre
 
 
+class DifferentialOperator(Enum):
+    """Operator applied to the basis functions by :meth:`FiniteElement.tabulate_operator`."""
+    divergence = _DO.divergence
+    curl = _DO.curl
+    symmetric_gradient = _DO.symmetric_gradient
+    trace = _DO.trace
+
+
 class FiniteElement:
-    """Finite element class."""
+    """Finite element class.
+
+    Note:
+        The arrays returned by :attr:`points`,
+        :attr:`interpolation_matrix`, :attr:`dual_matrix`,
+        :attr:`coefficient_matrix`, :attr:`wcoeffs`, :attr:`M`,
+        :attr:`x` and :meth:`entity_transformations` are read-only views
+        of the data of the element that keep the element alive. Accessing
+        them does not copy any data, and they can be passed to other
+        array libraries without a copy through ``__dlpack__``.
+    """
     _e: typing.Union[_FiniteElement_float32, _FiniteElement_float64]
 
     def __init__(self, e: typing.Union[_FiniteElement_float32, _FiniteElement_float64]):
@@ -81,19 +103,21 @@ class FiniteElement:
         """
         self._e = e
 
-    def tabulate(self, n: int, x: npt.NDArray) -> npt.NDArray[np.floating]:
+    def tabulate(self, n: int, x: npt.NDArray,
+                 out: typing.Optional[npt.NDArray[np.floating]] = None) -> npt.NDArray[np.floating]:
         """Compute basis values and derivatives at set of points.
 
         Note:
-            The version of `FiniteElement::tabulate` with the basis data
-            as an out argument should be preferred for repeated call where
-            performance is critical
+            Passing a pre-allocated array as ``out`` should be preferred
+            for repeated calls where performance is critical
 
         Args:
             n: The order of derivatives, up to and including, to
               compute. Use 0 for the basis functions only.
             x: The points at which to compute the basis functions. The
                 shape of x is (number of points, geometric dimension).
+            out: A C-contiguous array to write the result into. If this
+                is ``None``, a new array is allocated.
 
         Returns:
             The basis functions (and derivatives). The shape is
@@ -113,7 +137,205 @@ class FiniteElement:
             * The third index is the basis function index one for scalar
                 basis functions.
         """
-        return self._e.tabulate(n, x)
+        if out is None:
+            return self._e.tabulate(n, x)
+        self._e.tabulate(n, x, out)
+        return out
+
+    def tabulate_batch(self, n: int, x: npt.NDArray, offsets: npt.ArrayLike, num_threads: int = 1,
+                       out: typing.Optional[npt.NDArray[np.floating]] = None) -> npt.NDArray[np.floating]:
+        """Compute basis values and derivatives for a batch of cells.
+
+        Each cell has its own set of points. The points of all the
+        cells are concatenated, and the points of cell ``c`` are
+        ``x[offsets[c]:offsets[c + 1]]``. The polynomial set is evaluated
+        for many cells at once, which is faster than calling
+        :func:`tabulate` for each cell when each cell has few points.
+
+        Args:
+            n: The order of derivatives, up to and including, to
+              compute. Use 0 for the basis functions only.
+            x: The points of all the cells. The shape of x is (total
+                number of points, geometric dimension).
+            offsets: The offsets into ``x`` of the points of each cell.
+                The size of ``offsets`` is one more than the number of
+                cells.
+            num_threads: The number of threads to use.
+            out: A C-contiguous array to write the result into. If this
+                is ``None``, a new array is allocated.
+
+        Returns:
+            The tables of all the cells, concatenated into a flat
+            array. If ``t = e.tabulate(n, x[offsets[c]:offsets[c + 1]])``
+            and ``s = t.shape[0] * t.shape[2] * t.shape[3]``, then
+            ``t.flatten()`` is equal to
+            ``tables[offsets[c] * s:offsets[c + 1] * s]``.
+        """
+        offsets = np.asarray(offsets, dtype=np.uintp)
+        if out is None:
+            return self._e.tabulate_batch(n, x, offsets, num_threads)
+        self._e.tabulate_batch(n, x, offsets, num_threads, out)
+        return out
+
+    def tabulate_stream(self, n: int, chunks: typing.Iterable[npt.ArrayLike], chunk_size: int,
+                        pipelined: bool = True) -> typing.Iterator[npt.NDArray[np.floating]]:
+        """Compute basis values and derivatives at a stream of points, in chunks.
+
+        The points are read from ``chunks`` one chunk at a time, so the
+        memory used depends on the chunk size and not on the total
+        number of points. This allows point clouds that do not fit in
+        memory to be tabulated, for example by reading the chunks from
+        a file.
+
+        If ``pipelined`` is true, the next chunk is read when a table is
+        returned and is tabulated on a worker thread while the caller
+        processes the current table.
+
+        Note:
+            Each table is a view of a buffer that is overwritten when
+            the iteration continues. A table that is needed after the
+            next iteration must be copied.
+
+        Args:
+            n: The order of derivatives, up to and including, to
+              compute. Use 0 for the basis functions only.
+            chunks: An iterable of arrays of points. Each array has
+                shape (number of points, geometric dimension) with at
+                most ``chunk_size`` points. An array with no points,
+                of any shape (for example ``np.array([])``), ends the
+                stream.
+            chunk_size: The largest number of points in a chunk.
+            pipelined: Tabulate the next chunk while the current table
+                is processed.
+
+        Returns:
+            An iterator over the tables of the chunks. Each table has
+            the shape and layout of the output of :func:`tabulate` for
+            the points of the chunk.
+        """
+        stream_type = _TabulationStream_float32 if self.dtype == np.float32 else _TabulationStream_float64
+        x = (np.ascontiguousarray(c, dtype=self.dtype) for c in chunks)
+        stream = stream_type(self._e, n, x, chunk_size, pipelined)
+        while stream.next():
+            yield stream.table
+
+    def tabulate_directional_derivative(self, x: npt.NDArray, directions: npt.NDArray,
+                                        out: typing.Optional[npt.NDArray[np.floating]] = None
+                                        ) -> npt.NDArray[np.floating]:
+        """Compute directional derivatives of the basis functions at a set of points.
+
+        For each point ``p`` and basis function ``i``, this computes
+        ``b . grad(phi_i)(x[p])``, where ``b`` is the direction at
+        ``p``. The directions are contracted with the derivatives of the
+        polyset before the basis functions are computed, so the
+        gradients of the basis functions are never stored.
+
+        The directions are on the reference cell. For a direction ``b``
+        on a physical cell, pass ``K @ b``, where ``K`` is the inverse
+        of the Jacobian of the mapping.
+
+        Args:
+            x: The points at which to compute the derivatives. The
+                shape of x is (number of points, tdim).
+            directions: The direction at each point, with shape (number
+                of points, tdim), or the direction at each point of a
+                batch of cells, with shape (number of cells, number of
+                points, tdim). The polyset is evaluated once for all the
+                cells.
+            out: A C-contiguous array to write the result into. If this
+                is ``None``, a new array is allocated.
+
+        Returns:
+            The directional derivatives. The shape is (point, basis fn
+            index, value index), or (cell, point, basis fn index, value
+            index) if ``directions`` has three dimensions.
+        """
+        single = directions.ndim == 2
+        if single:
+            directions = directions[np.newaxis]
+        if out is None:
+            tab = self._e.tabulate_directional_derivative(x, directions)
+            return tab[0] if single else tab
+        self._e.tabulate_directional_derivative(x, directions, out[np.newaxis] if single else out)
+        return out
+
+    def tabulate_operator(self, op: DifferentialOperator, x: npt.NDArray,
+                          out: typing.Optional[npt.NDArray[np.floating]] = None) -> npt.NDArray[np.floating]:
+        """Compute an operator applied to the basis functions at a set of points.
+
+        This computes the same values as contracting the first
+        derivatives returned by :meth:`tabulate`, but only the requested
+        operator is computed. The operator is applied on the reference
+        cell; :meth:`push_forward_operator` maps the values to a physical
+        cell.
+
+        Args:
+            op: The operator. The divergence and curl require a
+                vector-valued element (the divergence can also be applied
+                to a matrix-valued element), the symmetric gradient
+                requires a vector-valued element and the trace requires
+                a matrix-valued element.
+            x: The points at which to compute the basis functions. The
+                shape of x is (number of points, geometric dimension).
+            out: A C-contiguous array to write the result into. If this
+                is ``None``, a new array is allocated.
+
+        Returns:
+            The operator applied to the basis functions. The shape is
+            (point, basis fn index, operator value index). The curl in
+            2D is a scalar, and the symmetric gradient is stored as a
+            full (tdim, tdim) matrix.
+        """
+        if out is None:
+            return self._e.tabulate_operator(op.value, x)
+        self._e.tabulate_operator(op.value, x, out)
+        return out
+
+    def push_forward_operator(self, op: DifferentialOperator, U: npt.NDArray, J: npt.NDArray, detJ: npt.NDArray,
+                              K: npt.NDArray,
+                              out: typing.Optional[npt.NDArray[np.floating]] = None) -> npt.NDArray[np.floating]:
+        """Map the values of an operator from the reference to a physical cell.
+
+        The physical operator is available when it only depends on the
+        reference operator: the divergence of contravariant Piola mapped
+        elements, the curl of covariant Piola mapped elements and the
+        trace of identity mapped elements. For other operators and
+        maps, tabulate the derivatives and use :meth:`push_forward`.
+
+        Args:
+            op: The operator.
+            U: The values on the reference, as returned by
+                :meth:`tabulate_operator`. The indices are [Jacobian
+                index, point index, components].
+            J: The Jacobian of the mapping. The indices are [Jacobian
+                index, J_i, J_j].
+            detJ: The determinant of the Jacobian of the mapping. It has
+                length `J.shape(0)`
+            K: The inverse of the Jacobian of the mapping. The indices
+                are [Jacobian index, K_i, K_j].
+            out: A C-contiguous array to write the result into. If this
+                is ``None``, a new array is allocated.
+
+        Returns:
+            The values on the cell. The indices are [Jacobian index,
+            point index, components].
+        """
+        if out is None:
+            return self._e.push_forward_operator(op.value, U, J, detJ, K)
+        self._e.push_forward_operator(op.value, U, J, detJ, K, out)
+        return out
+
+    def physical_operator_size(self, op: DifferentialOperator, gdim: int) -> int:
+        """Value size of an operator after it is mapped to a physical cell.
+
+        Args:
+            op: The operator.
+            gdim: The geometric dimension of the physical cell.
+
+        Returns:
+            The value size.
+        """
+        return self._e.physical_operator_size(op.value, gdim)
 
     def __eq__(self, other) -> bool:
         """Test element for equality."""
@@ -122,7 +344,8 @@ class FiniteElement:
         except TypeError:
             return False
 
-    def push_forward(self, U, J, detJ, K) -> npt.NDArray[np.floating]:
+    def push_forward(self, U, J, detJ, K,
+                     out: typing.Optional[npt.NDArray[np.floating]] = None) -> npt.NDArray[np.floating]:
         """Map function values from the reference to a physical cell.
 
         This function can perform the mapping for multiple points,
@@ -137,15 +360,20 @@ class FiniteElement:
                 length `J.shape(0)`
             K: The inverse of the Jacobian of the
                mapping. The indices are [Jacobian index, K_i, K_j].
+            out: A C-contiguous array to write the result into. If this
+                is ``None``, a new array is allocated.
 
         Returns:
             The function values on the cell. The indices are [Jacobian
             index, point index, components].
         """
-        return self._e.push_forward(U, J, detJ, K)
+        if out is None:
+            return self._e.push_forward(U, J, detJ, K)
+        self._e.push_forward(U, J, detJ, K, out)
+        return out
 
-    def pull_back(self, u: npt.NDArray, J: npt.NDArray,
-                  detJ: npt.NDArray, K: npt.NDArray) -> npt.NDArray[np.floating]:
+    def pull_back(self, u: npt.NDArray, J: npt.NDArray, detJ: npt.NDArray, K: npt.NDArray,
+                  out: typing.Optional[npt.NDArray[np.floating]] = None) -> npt.NDArray[np.floating]:
         """Map function values from a physical cell to the reference.
 
         Args:
@@ -153,14 +381,20 @@ class FiniteElement:
             J: The Jacobian of the mapping
             detJ: The determinant of the Jacobian of the mapping
             K: The inverse of the Jacobian of the mapping
+            out: A C-contiguous array to write the result into. If this
+                is ``None``, a new array is allocated.
 
         Returns:
             The function values on the reference. The indices are
             [Jacobian index, point index, components].
         """
-        return self._e.pull_back(u, J, detJ, K)
+        if out is None:
+            return self._e.pull_back(u, J, detJ, K)
+        self._e.pull_back(u, J, detJ, K, out)
+        return out
 
-    def pre_apply_dof_transformation(self, data, block_size, cell_info) -> None:
+    def pre_apply_dof_transformation(self, data: npt.NDArray[np.floating], block_size: int,
+                                     cell_info: typing.Union[int, npt.ArrayLike]) -> None:
         """Pre-apply DOF transformations to some data in-place.
 
         Note:
@@ -168,28 +402,56 @@ class FiniteElement:
             performance is critical.
 
         Args:
-            data: The data
+            data: The data. To transform the data of many cells in a
+                single call, this is a two-dimensional array with a row
+                for each cell.
             block_size: The number of data points per DOF
-            cell_info: The permutation info for the cell
-
+            cell_info: The permutation info for the cell, or an array of
+                the permutation info for each cell if data is
+                two-dimensional.
         """
         self._e.pre_apply_dof_transformation(data, block_size, cell_info)
 
-    def post_apply_transpose_dof_transformation(self, data, block_size, cell_info) -> None:
-        """Post-apply DOF transformations to some transposed data in-place.
+    def pre_apply_transpose_dof_transformation(self, data: npt.NDArray[np.floating], block_size: int,
+                                               cell_info: typing.Union[int, npt.ArrayLike]) -> None:
+        """Pre-apply transpose DOF transformations to some data in-place.
 
         Note:
             This function is designed to be called at runtime, so its
             performance is critical.
 
         Args:
-            data: The data
+            data: The data. To transform the data of many cells in a
+                single call, this is a two-dimensional array with a row
+                for each cell.
             block_size: The number of data points per DOF
-            cell_info: The permutation info for the cell
+            cell_info: The permutation info for the cell, or an array of
+                the permutation info for each cell if data is
+                two-dimensional.
         """
-        self._e.post_apply_transpose_dof_transformation(data, block_size, cell_info)
+        self._e.pre_apply_transpose_dof_transformation(data, block_size, cell_info)
 
-    def pre_apply_inverse_transpose_dof_transformation(self, data, block_size, cell_info) -> None:
+    def pre_apply_inverse_dof_transformation(self, data: npt.NDArray[np.floating], block_size: int,
+                                             cell_info: typing.Union[int, npt.ArrayLike]) -> None:
+        """Pre-apply inverse DOF transformations to some data in-place.
+
+        Note:
+            This function is designed to be called at runtime, so its
+            performance is critical.
+
+        Args:
+            data: The data. To transform the data of many cells in a
+                single call, this is a two-dimensional array with a row
+                for each cell.
+            block_size: The number of data points per DOF
+            cell_info: The permutation info for the cell, or an array of
+                the permutation info for each cell if data is
+                two-dimensional.
+        """
+        self._e.pre_apply_inverse_dof_transformation(data, block_size, cell_info)
+
+    def pre_apply_inverse_transpose_dof_transformation(self, data: npt.NDArray[np.floating], block_size: int,
+                                                       cell_info: typing.Union[int, npt.ArrayLike]) -> None:
         """Pre-apply inverse transpose DOF transformations to some data.
 
         Note:
@@ -197,12 +459,124 @@ class FiniteElement:
             performance is critical.
 
         Args:
-            data: The data
+            data: The data. To transform the data of many cells in a
+                single call, this is a two-dimensional array with a row
+                for each cell.
             block_size: The number of data points per DOF
-            cell_info: The permutation info for the cell
+            cell_info: The permutation info for the cell, or an array of
+                the permutation info for each cell if data is
+                two-dimensional.
         """
         self._e.pre_apply_inverse_transpose_dof_transformation(data, block_size, cell_info)
 
+    def post_apply_dof_transformation(self, data: npt.NDArray[np.floating], block_size: int,
+                                      cell_info: typing.Union[int, npt.ArrayLike]) -> None:
+        """Post-apply DOF transformations to some data in-place.
+
+        Note:
+            This function is designed to be called at runtime, so its
+            performance is critical.
+
+        Args:
+            data: The data. To transform the data of many cells in a
+                single call, this is a two-dimensional array with a row
+                for each cell.
+            block_size: The number of data points per DOF
+            cell_info: The permutation info for the cell, or an array of
+                the permutation info for each cell if data is
+                two-dimensional.
+        """
+        self._e.post_apply_dof_transformation(data, block_size, cell_info)
+
+    def post_apply_transpose_dof_transformation(self, data: npt.NDArray[np.floating], block_size: int,
+                                                cell_info: typing.Union[int, npt.ArrayLike]) -> None:
+        """Post-apply DOF transformations to some transposed data in-place.
+
+        Note:
+            This function is designed to be called at runtime, so its
+            performance is critical.
+
+        Args:
+            data: The data. To transform the data of many cells in a
+                single call, this is a two-dimensional array with a row
+                for each cell.
+            block_size: The number of data points per DOF
+            cell_info: The permutation info for the cell, or an array of
+                the permutation info for each cell if data is
+                two-dimensional.
+        """
+        self._e.post_apply_transpose_dof_transformation(data, block_size, cell_info)
+
+    def post_apply_inverse_dof_transformation(self, data: npt.NDArray[np.floating], block_size: int,
+                                              cell_info: typing.Union[int, npt.ArrayLike]) -> None:
+        """Post-apply inverse DOF transformations to some data in-place.
+
+        Note:
+            This function is designed to be called at runtime, so its
+            performance is critical.
+
+        Args:
+            data: The data. To transform the data of many cells in a
+                single call, this is a two-dimensional array with a row
+                for each cell.
+            block_size: The number of data points per DOF
+            cell_info: The permutation info for the cell, or an array of
+                the permutation info for each cell if data is
+                two-dimensional.
+        """
+        self._e.post_apply_inverse_dof_transformation(data, block_size, cell_info)
+
+    def post_apply_inverse_transpose_dof_transformation(self, data: npt.NDArray[np.floating], block_size: int,
+                                                        cell_info: typing.Union[int, npt.ArrayLike]) -> None:
+        """Post-apply inverse transpose DOF transformations to some data.
+
+        Note:
+            This function is designed to be called at runtime, so its
+            performance is critical.
+
+        Args:
+            data: The data. To transform the data of many cells in a
+                single call, this is a two-dimensional array with a row
+                for each cell.
+            block_size: The number of data points per DOF
+            cell_info: The permutation info for the cell, or an array of
+                the permutation info for each cell if data is
+                two-dimensional.
+        """
+        self._e.post_apply_inverse_transpose_dof_transformation(data, block_size, cell_info)
+
+    def permute_dofs(self, dofs: npt.NDArray[np.int32], cell_info: typing.Union[int, npt.ArrayLike]) -> None:
+        """Permute the DOF numbering on a cell in-place.
+
+        This can only be used if the DOF transformations of the element
+        are permutations.
+
+        Args:
+            dofs: The DOF numbering. To permute the numbering of many
+                cells in a single call, this is a two-dimensional array
+                with a row for each cell.
+            cell_info: The permutation info for the cell, or an array of
+                the permutation info for each cell if dofs is
+                two-dimensional.
+        """
+        self._e.permute_dofs(dofs, cell_info)
+
+    def unpermute_dofs(self, dofs: npt.NDArray[np.int32], cell_info: typing.Union[int, npt.ArrayLike]) -> None:
+        """Unpermute the DOF numbering on a cell in-place.
+
+        This can only be used if the DOF transformations of the element
+        are permutations.
+
+        Args:
+            dofs: The DOF numbering. To permute the numbering of many
+                cells in a single call, this is a two-dimensional array
+                with a row for each cell.
+            cell_info: The permutation info for the cell, or an array of
+                the permutation info for each cell if dofs is
+                two-dimensional.
+        """
+        self._e.unpermute_dofs(dofs, cell_info)
+
     def base_transformations(self) -> npt.NDArray[np.floating]:
         r"""Get the base transformations.
 
@@ -304,8 +678,9 @@ class FiniteElement:
         """Return the entity dof transformation matrices.
 
         Returns:
-            The base transformations for this element. The shape is
-            ``(ntranformations, ndofs, ndofs)``.
+            The transformations of the DOFs on each type of sub-entity of
+            the cell. The shape of each array is ``(ntranformations,
+            ndofs, ndofs)``.
         """
         return self._e.entity_transformations()
 
@@ -543,6 +918,69 @@ class FiniteElement:
         """DOF layout."""
         return self._e.dof_ordering
 
+    @property
+    def fingerprint(self) -> int:
+        """A 64-bit hash of the properties that define the element.
+
+        The fingerprint is computed when the element is created. It does
+        not depend on the process, so it can be used as the key of an
+        on-disk cache.
+        """
+        return self._e.fingerprint
+
+    @property
+    def construction_times(self) -> list[tuple[str, float]]:
+        """Wall time in seconds of each stage of the construction of the element.
+
+        The time taken to define the element before the C++ constructor
+        is called is not included. The times are only recorded while
+        statistics are collected (see :func:`basix.stats.enable`), so
+        this is empty for an element created while collection is
+        disabled and for an element that was unpickled.
+        """
+        return self._e.construction_times
+
+    def memory_footprint(self) -> dict[str, int]:
+        """Memory held by the element, broken down by member.
+
+        Returns:
+            Map from the name of a member of the C++ element to the
+            number of bytes of heap memory that it holds. The entries
+            are described in the documentation of the C++ function
+            ``FiniteElement::memory_footprint``.
+        """
+        return self._e.memory_footprint()
+
+    @property
+    def handle_float64(self) -> int:
+        """Address of the C++ element, for the ``float64`` C functions.
+
+        The handle is passed to the ``_float64`` functions of
+        :mod:`basix.c_api`. It is valid for as long as this object is
+        alive.
+
+        Raises:
+            ValueError: If the element float type is not ``float64``.
+        """
+        if self.dtype != np.float64:
+            raise ValueError(f"Element float type is {self.dtype}, not float64.")
+        return self._e.handle
+
+    @property
+    def handle_float32(self) -> int:
+        """Address of the C++ element, for the ``float32`` C functions.
+
+        The handle is passed to the ``_float32`` functions of
+        :mod:`basix.c_api`. It is valid for as long as this object is
+        alive.
+
+        Raises:
+            ValueError: If the element float type is not ``float32``.
+        """
+        if self.dtype != np.float32:
+            raise ValueError(f"Element float type is {self.dtype}, not float32.")
+        return self._e.handle
+
     @property
     def dtype(self) -> npt.DTypeLike:
         """Element float type."""
@@ -743,3 +1181,14 @@ def string_to_dpc_variant(variant: str) -> DPCVariant:
     if not hasattr(DPCVariant, variant.lower()):
         raise ValueError(f"Unknown variant: {variant}")
     return getattr(DPCVariant, variant.lower())
+
+
+def clear_moment_cache():
+    """Free the cache of integral moments.
+
+    The integral moments that define the DOFs of elements such as
+    Nedelec and Raviart-Thomas elements are cached, so that elements
+    that share a moment space reuse them. Clearing the cache frees its
+    memory, and does not change the elements that are created later.
+    """
+    _moments_clear_cache()
@@ -1,7 +1,13 @@
 """Interpolation."""
 
+import typing
+
+import numpy as np
 import numpy.typing as npt
 
+from basix._basixcpp import InterfaceConstraints_float32 as _InterfaceConstraints_float32
+from basix._basixcpp import InterfaceConstraints_float64 as _InterfaceConstraints_float64
+from basix._basixcpp import compute_interface_constraint as _compute_interface_constraint
 from basix._basixcpp import compute_interpolation_operator as _compute_interpolation_operator
 from basix.finite_element import FiniteElement
 
@@ -44,3 +50,100 @@ def compute_interpolation_operator(
         ndofs(element_from))
     """
     return _compute_interpolation_operator(e0._e, e1._e)
+
+
+class InterfaceConstraint(typing.NamedTuple):
+    """A sparse constraint between the DOFs of two elements on a shared facet.
+
+    Row ``i`` expresses DOF ``dofs[i]`` of the fine element as a linear
+    combination of the DOFs ``columns[offsets[i]:offsets[i + 1]]`` of
+    the coarse element with coefficients
+    ``values[offsets[i]:offsets[i + 1]]``.
+    """
+
+    dofs: npt.NDArray[np.int32]
+    offsets: npt.NDArray[np.int32]
+    columns: npt.NDArray[np.int32]
+    values: npt.NDArray[np.floating]
+
+
+def compute_interface_constraint(coarse: FiniteElement, coarse_facet: int, fine: FiniteElement, fine_facet: int,
+                                 subfacet: int = -1, orientation: int = 0) -> InterfaceConstraint:
+    """Compute the constraint that makes a fine element continuous with a coarse element across a nonconforming facet.
+
+    The facet of the fine cell is either the whole of the facet of the
+    coarse cell (``subfacet=-1``), for example if the elements have
+    different degrees, or a sub-facet obtained by uniformly refining it
+    once, for example if the fine cell has a hanging node. The
+    constraint expresses the DOFs of the fine element associated with
+    the closure of its facet in terms of the DOFs of the coarse element.
+
+    Sub-facet ``s`` of an interval is the half that contains vertex
+    ``s``. Sub-facets 0, 1 and 2 of a triangle are the triangles that
+    contain vertex 0, 1 and 2 and sub-facet 3 is the central triangle.
+    Sub-facet ``i + 2 * j`` of a quadrilateral is ``[i/2, (i+1)/2] x
+    [j/2, (j+1)/2]``. The orientation is ``2 * rotations +
+    reflection``, where the vertices of the facet of the fine cell are
+    the vertices of the (sub-)facet of the coarse cell rotated and then
+    reflected.
+
+    Note:
+        Only elements with an identity map whose facet DOFs are defined
+        by point evaluations on the facet are supported. For a blocked
+        element, apply the constraint of its sub-element to each
+        component.
+
+    Args:
+        coarse: The coarse element.
+        coarse_facet: The local index of the shared facet of the
+            coarse cell.
+        fine: The fine element.
+        fine_facet: The local index of the shared facet of the fine
+            cell.
+        subfacet: The sub-facet of the facet of the coarse cell, or -1
+            if the facets are the same.
+        orientation: The orientation of the facet of the fine cell.
+
+    Returns:
+        The constraint.
+    """
+    return InterfaceConstraint(*_compute_interface_constraint(coarse._e, coarse_facet, fine._e, fine_facet, subfacet,
+                                                              orientation))
+
+
+class InterfaceConstraints:
+    """The interface constraints between a pair of elements.
+
+    The constraints for every combination of facets, sub-facets and
+    orientations are computed when the object is created, so it should
+    be created once for each pair of elements and reused.
+    """
+
+    _c: typing.Union[_InterfaceConstraints_float32, _InterfaceConstraints_float64]
+
+    def __init__(self, coarse: FiniteElement, fine: FiniteElement):
+        """Compute the interface constraints between two elements.
+
+        Args:
+            coarse: The coarse element.
+            fine: The fine element.
+        """
+        if coarse.dtype != fine.dtype:
+            raise ValueError("Elements must have the same scalar type.")
+        if coarse.dtype == np.float32:
+            self._c = _InterfaceConstraints_float32(coarse._e, fine._e)
+        else:
+            self._c = _InterfaceConstraints_float64(coarse._e, fine._e)
+
+    def __len__(self) -> int:
+        """Number of constraints."""
+        return len(self._c)
+
+    def constraint(self, coarse_facet: int, fine_facet: int, subfacet: int = -1,
+                   orientation: int = 0) -> InterfaceConstraint:
+        """Get a constraint.
+
+        See :func:`compute_interface_constraint` for the meaning of the
+        arguments.
+        """
+        return InterfaceConstraint(*self._c.constraint(coarse_facet, fine_facet, subfacet, orientation))
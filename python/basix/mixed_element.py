@@ -0,0 +1,298 @@
+"""Elements built from other elements.
+
+A mixed element combines several elements defined on the same cell, and
+a blocked element contains a copy of a scalar element for each value
+component. Both are tabulated by a single call into the C++ library,
+which evaluates the polynomial set once for all the sub-elements that
+share it and writes the combined table directly.
+"""
+
+import typing
+
+import numpy as np
+import numpy.typing as npt
+
+from basix._basixcpp import BlockedElement_float32 as _BlockedElement_float32
+from basix._basixcpp import BlockedElement_float64 as _BlockedElement_float64
+from basix._basixcpp import MixedElement_float32 as _MixedElement_float32
+from basix._basixcpp import MixedElement_float64 as _MixedElement_float64
+from basix.cell import CellType
+from basix.finite_element import FiniteElement
+
+__all__ = ["MixedElement", "BlockedElement", "create_mixed_element", "create_blocked_element"]
+
+
+class _CompositeElement:
+    """Functionality shared by mixed and blocked elements."""
+    _e: typing.Union[_MixedElement_float32, _MixedElement_float64,
+                     _BlockedElement_float32, _BlockedElement_float64]
+
+    def tabulate(self, n: int, x: npt.NDArray,
+                 out: typing.Optional[npt.NDArray[np.floating]] = None) -> npt.NDArray[np.floating]:
+        """Compute basis values and derivatives at set of points.
+
+        Args:
+            n: The order of derivatives, up to and including, to
+              compute. Use 0 for the basis functions only.
+            x: The points at which to compute the basis functions. The
+                shape of x is (number of points, geometric dimension).
+            out: A C-contiguous array to write the result into. If this
+                is ``None``, a new array is allocated.
+
+        Returns:
+            The basis functions (and derivatives). The shape and layout
+            are the same as for :func:`FiniteElement.tabulate`.
+        """
+        if out is None:
+            return self._e.tabulate(n, x)
+        self._e.tabulate(n, x, out)
+        return out
+
+    @property
+    def cell_type(self) -> CellType:
+        """Element cell type."""
+        return getattr(CellType, self._e.cell_type.name)
+
+    @property
+    def dim(self) -> int:
+        """Number of degrees-of-freedom of the element."""
+        return self._e.dim
+
+    @property
+    def value_size(self) -> int:
+        """Number of value components of the element."""
+        return self._e.value_size
+
+    @property
+    def entity_dofs(self) -> list[list[list[int]]]:
+        """DOFs associated with each topological entity."""
+        return self._e.entity_dofs
+
+    @property
+    def entity_closure_dofs(self) -> list[list[list[int]]]:
+        """DOFs associated with the closure of each topological entity."""
+        return self._e.entity_closure_dofs
+
+    @property
+    def dof_transformations_are_identity(self) -> bool:
+        """True if the DOF transformations of all sub-elements are identities."""
+        return self._e.dof_transformations_are_identity
+
+    @property
+    def dof_transformations_are_permutations(self) -> bool:
+        """True if the DOF transformations of all sub-elements are permutations."""
+        return self._e.dof_transformations_are_permutations
+
+    def pre_apply_dof_transformation(self, data: npt.NDArray[np.floating], block_size: int,
+                                     cell_info: typing.Union[int, npt.ArrayLike]) -> None:
+        """Pre-apply DOF transformations to some data in-place.
+
+        See :func:`FiniteElement.pre_apply_dof_transformation`.
+        """
+        self._e.pre_apply_dof_transformation(data, block_size, cell_info)
+
+    def pre_apply_transpose_dof_transformation(self, data: npt.NDArray[np.floating], block_size: int,
+                                               cell_info: typing.Union[int, npt.ArrayLike]) -> None:
+        """Pre-apply transpose DOF transformations to some data in-place.
+
+        See :func:`FiniteElement.pre_apply_transpose_dof_transformation`.
+        """
+        self._e.pre_apply_transpose_dof_transformation(data, block_size, cell_info)
+
+    def pre_apply_inverse_dof_transformation(self, data: npt.NDArray[np.floating], block_size: int,
+                                             cell_info: typing.Union[int, npt.ArrayLike]) -> None:
+        """Pre-apply inverse DOF transformations to some data in-place.
+
+        See :func:`FiniteElement.pre_apply_inverse_dof_transformation`.
+        """
+        self._e.pre_apply_inverse_dof_transformation(data, block_size, cell_info)
+
+    def pre_apply_inverse_transpose_dof_transformation(self, data: npt.NDArray[np.floating], block_size: int,
+                                                       cell_info: typing.Union[int, npt.ArrayLike]) -> None:
+        """Pre-apply inverse transpose DOF transformations to some data in-place.
+
+        See :func:`FiniteElement.pre_apply_inverse_transpose_dof_transformation`.
+        """
+        self._e.pre_apply_inverse_transpose_dof_transformation(data, block_size, cell_info)
+
+    def post_apply_dof_transformation(self, data: npt.NDArray[np.floating], block_size: int,
+                                      cell_info: typing.Union[int, npt.ArrayLike]) -> None:
+        """Post-apply DOF transformations to some data in-place.
+
+        See :func:`FiniteElement.post_apply_dof_transformation`.
+        """
+        self._e.post_apply_dof_transformation(data, block_size, cell_info)
+
+    def post_apply_transpose_dof_transformation(self, data: npt.NDArray[np.floating], block_size: int,
+                                                cell_info: typing.Union[int, npt.ArrayLike]) -> None:
+        """Post-apply transpose DOF transformations to some data in-place.
+
+        See :func:`FiniteElement.post_apply_transpose_dof_transformation`.
+        """
+        self._e.post_apply_transpose_dof_transformation(data, block_size, cell_info)
+
+    def post_apply_inverse_dof_transformation(self, data: npt.NDArray[np.floating], block_size: int,
+                                              cell_info: typing.Union[int, npt.ArrayLike]) -> None:
+        """Post-apply inverse DOF transformations to some data in-place.
+
+        See :func:`FiniteElement.post_apply_inverse_dof_transformation`.
+        """
+        self._e.post_apply_inverse_dof_transformation(data, block_size, cell_info)
+
+    def post_apply_inverse_transpose_dof_transformation(self, data: npt.NDArray[np.floating], block_size: int,
+                                                        cell_info: typing.Union[int, npt.ArrayLike]) -> None:
+        """Post-apply inverse transpose DOF transformations to some data in-place.
+
+        See :func:`FiniteElement.post_apply_inverse_transpose_dof_transformation`.
+        """
+        self._e.post_apply_inverse_transpose_dof_transformation(data, block_size, cell_info)
+
+    def permute_dofs(self, dofs: npt.NDArray[np.int32], cell_info: typing.Union[int, npt.ArrayLike]) -> None:
+        """Permute the DOF numbering on a cell in-place.
+
+        See :func:`FiniteElement.permute_dofs`.
+        """
+        self._e.permute_dofs(dofs, cell_info)
+
+    def unpermute_dofs(self, dofs: npt.NDArray[np.int32], cell_info: typing.Union[int, npt.ArrayLike]) -> None:
+        """Unpermute the DOF numbering on a cell in-place.
+
+        See :func:`FiniteElement.unpermute_dofs`.
+        """
+        self._e.unpermute_dofs(dofs, cell_info)
+
+
+class MixedElement(_CompositeElement):
+    """Mixed element class.
+
+    The DOFs of a mixed element are the DOFs of the first sub-element,
+    followed by the DOFs of the second sub-element, and so on. The value
+    components are ordered in the same way.
+    """
+    _e: typing.Union[_MixedElement_float32, _MixedElement_float64]
+
+    def __init__(self, e: typing.Union[_MixedElement_float32, _MixedElement_float64]):
+        """Initialise a mixed element wrapper.
+
+        Note:
+            This initialiser is intended for internal library use.
+        """
+        self._e = e
+
+    @property
+    def num_sub_elements(self) -> int:
+        """Number of sub-elements."""
+        return self._e.num_sub_elements
+
+    @property
+    def dof_offsets(self) -> list[int]:
+        """Offset of the DOFs of each sub-element.
+
+        The DOFs of sub-element ``i`` are ``dof_offsets[i]`` to
+        ``dof_offsets[i + 1]`` (not inclusive).
+        """
+        return self._e.dof_offsets
+
+    @property
+    def value_offsets(self) -> list[int]:
+        """Offset of the value components of each sub-element.
+
+        The components of sub-element ``i`` are ``value_offsets[i]`` to
+        ``value_offsets[i + 1]`` (not inclusive).
+        """
+        return self._e.value_offsets
+
+    @property
+    def points(self) -> npt.NDArray[np.floating]:
+        """Interpolation points.
+
+        The interpolation points of all the sub-elements, merged so that
+        a point shared by several sub-elements appears once. A function
+        evaluated at these points can be interpolated into every
+        sub-element. Shape is ``(num_points, tdim)``.
+        """
+        return self._e.points
+
+    @property
+    def point_maps(self) -> list[list[int]]:
+        """Rows of :attr:`points` that are the interpolation points of each sub-element.
+
+        Point ``p`` of the interpolation points of sub-element ``i`` is
+        ``points[point_maps[i][p]]``.
+        """
+        return self._e.point_maps
+
+    @property
+    def interpolation_nderivs(self) -> int:
+        """Highest number of derivatives that any sub-element needs when interpolating."""
+        return self._e.interpolation_nderivs
+
+    @property
+    def interpolation_matrix(self) -> npt.NDArray[np.floating]:
+        """Interpolation matrix.
+
+        The matrix that maps the values of a function at :attr:`points`
+        to the DOFs of the mixed element, with the same layout as
+        :attr:`FiniteElement.interpolation_matrix`. For a function
+        without derivatives, ``interpolation_matrix @ f(points).T.flatten()``
+        is the DOFs of the interpolant, where ``f`` returns an array with
+        shape ``(num_points, value_size)``.
+        """
+        return self._e.interpolation_matrix
+
+
+class BlockedElement(_CompositeElement):
+    """Blocked element class.
+
+    A blocked element has a copy of a scalar sub-element for each value
+    component. DOF ``i`` of the copy for component ``b`` is DOF
+    ``i * block_size + b`` of the blocked element.
+    """
+    _e: typing.Union[_BlockedElement_float32, _BlockedElement_float64]
+
+    def __init__(self, e: typing.Union[_BlockedElement_float32, _BlockedElement_float64]):
+        """Initialise a blocked element wrapper.
+
+        Note:
+            This initialiser is intended for internal library use.
+        """
+        self._e = e
+
+    @property
+    def block_size(self) -> int:
+        """Number of copies of the sub-element."""
+        return self._e.block_size
+
+
+def create_mixed_element(elements: list[FiniteElement]) -> MixedElement:
+    """Create a mixed element.
+
+    Args:
+        elements: The sub-elements. All sub-elements must be defined on
+            the same cell and have the same scalar type.
+
+    Returns:
+        A mixed element.
+    """
+    if len(elements) == 0:
+        raise ValueError("A mixed element needs at least one sub-element.")
+    if any(e.dtype != elements[0].dtype for e in elements):
+        raise ValueError("Sub-elements must have the same scalar type.")
+    if elements[0].dtype == np.float32:
+        return MixedElement(_MixedElement_float32([e._e for e in elements]))
+    return MixedElement(_MixedElement_float64([e._e for e in elements]))
+
+
+def create_blocked_element(element: FiniteElement, block_size: int) -> BlockedElement:
+    """Create a blocked element.
+
+    Args:
+        element: The sub-element. It must be scalar-valued.
+        block_size: The number of copies of the sub-element.
+
+    Returns:
+        A blocked element.
+    """
+    if element.dtype == np.float32:
+        return BlockedElement(_BlockedElement_float32(element._e, block_size))
+    return BlockedElement(_BlockedElement_float64(element._e, block_size))
@@ -0,0 +1,232 @@
+"""Modal representations of finite element functions.
+
+The modes of an element are the orthonormal polynomials of its
+polynomial set, one set for each value component. A modal basis holds
+the operators that map the DOFs of a function to its modal coefficients
+and back, and uses them to filter functions and to measure how fast
+their modal coefficients decay. All functions act on arrays with a row
+of DOFs for each cell, so a whole mesh is processed in a single call.
+"""
+
+import typing
+
+import numpy as np
+import numpy.typing as npt
+
+from basix._basixcpp import ModalBasis_float32 as _ModalBasis_float32
+from basix._basixcpp import ModalBasis_float64 as _ModalBasis_float64
+from basix.finite_element import FiniteElement
+
+__all__ = ["ModalBasis", "create_modal_basis"]
+
+
+class ModalBasis:
+    """Modal basis of an element.
+
+    The degree of a mode is the lowest degree of polynomial set that
+    contains it, so on tensor product cells the degree of a mode is its
+    highest degree in any direction.
+    """
+    _b: typing.Union[_ModalBasis_float32, _ModalBasis_float64]
+
+    def __init__(self, b: typing.Union[_ModalBasis_float32, _ModalBasis_float64]):
+        """Initialise a modal basis wrapper.
+
+        Note:
+            This initialiser is intended for internal library use.
+        """
+        self._b = b
+
+    @property
+    def dim(self) -> int:
+        """Number of degrees-of-freedom of the element."""
+        return self._b.dim
+
+    @property
+    def num_modes(self) -> int:
+        """Number of modes."""
+        return self._b.num_modes
+
+    @property
+    def degree(self) -> int:
+        """Highest degree of any mode."""
+        return self._b.degree
+
+    @property
+    def mode_degrees(self) -> list[int]:
+        """Degree of each mode."""
+        return self._b.mode_degrees
+
+    @property
+    def nodal_to_modal(self) -> npt.NDArray[np.floating]:
+        """Matrix that maps DOFs to modal coefficients.
+
+        The shape of the matrix is ``(num_modes, dim)``.
+        """
+        return self._b.nodal_to_modal
+
+    @property
+    def modal_to_nodal(self) -> npt.NDArray[np.floating]:
+        """Matrix that maps modal coefficients to DOFs.
+
+        The modal coefficients are projected in L2 onto the element, so
+        ``modal_to_nodal @ nodal_to_modal`` is the identity. The shape
+        of the matrix is ``(dim, num_modes)``.
+        """
+        return self._b.modal_to_nodal
+
+    def filter_matrix(self, sigma: npt.ArrayLike) -> npt.NDArray[np.floating]:
+        """Create a filter that scales the modes of each degree.
+
+        Args:
+            sigma: The factor for each degree, from 0 to ``degree``.
+
+        Returns:
+            The filter matrix, with shape ``(dim, dim)``.
+        """
+        return self._b.filter_matrix(np.ascontiguousarray(sigma, dtype=self.nodal_to_modal.dtype))
+
+    def exponential_filter(self, order: int, strength: float, cutoff: int = 0) -> npt.NDArray[np.floating]:
+        """Create an exponential filter.
+
+        Modes of degree ``n`` up to and including ``cutoff`` are
+        unchanged, and modes of higher degree are multiplied by
+        ``exp(-strength * ((n - cutoff) / (degree - cutoff))**order)``.
+
+        Args:
+            order: The order of the filter.
+            strength: The strength of the filter. A strength of
+                ``-log(machine epsilon)`` reduces the modes of the
+                highest degree to machine precision.
+            cutoff: The highest degree that is not filtered.
+
+        Returns:
+            The filter matrix, with shape ``(dim, dim)``.
+        """
+        return self._b.exponential_filter(order, strength, cutoff)
+
+    def cutoff_filter(self, cutoff: int) -> npt.NDArray[np.floating]:
+        """Create a filter that removes all modes of degree greater than ``cutoff``.
+
+        Args:
+            cutoff: The highest degree that is kept.
+
+        Returns:
+            The filter matrix, with shape ``(dim, dim)``.
+        """
+        return self._b.cutoff_filter(cutoff)
+
+    def to_modal(self, u: npt.NDArray[np.floating],
+                 out: typing.Optional[npt.NDArray[np.floating]] = None) -> npt.NDArray[np.floating]:
+        """Compute the modal coefficients of a set of functions.
+
+        Args:
+            u: The DOFs of the functions, with shape ``(num_cells, dim)``.
+            out: A C-contiguous array to write the result into. If this
+                is ``None``, a new array is allocated.
+
+        Returns:
+            The modal coefficients, with shape ``(num_cells, num_modes)``.
+        """
+        if out is None:
+            return self._b.to_modal(u)
+        self._b.to_modal(u, out)
+        return out
+
+    def to_nodal(self, m: npt.NDArray[np.floating],
+                 out: typing.Optional[npt.NDArray[np.floating]] = None) -> npt.NDArray[np.floating]:
+        """Compute the DOFs of a set of functions from their modal coefficients.
+
+        Args:
+            m: The modal coefficients, with shape ``(num_cells, num_modes)``.
+            out: A C-contiguous array to write the result into. If this
+                is ``None``, a new array is allocated.
+
+        Returns:
+            The DOFs, with shape ``(num_cells, dim)``.
+        """
+        if out is None:
+            return self._b.to_nodal(m)
+        self._b.to_nodal(m, out)
+        return out
+
+    def apply_filter(self, matrix: npt.NDArray[np.floating], u: npt.NDArray[np.floating],
+                     out: typing.Optional[npt.NDArray[np.floating]] = None) -> npt.NDArray[np.floating]:
+        """Apply a filter to a set of functions.
+
+        Args:
+            matrix: A filter matrix, with shape ``(dim, dim)``.
+            u: The DOFs of the functions, with shape ``(num_cells, dim)``.
+            out: A C-contiguous array to write the result into. It must
+                not overlap with ``u``. If this is ``None``, a new array
+                is allocated.
+
+        Returns:
+            The filtered DOFs, with shape ``(num_cells, dim)``.
+        """
+        if out is None:
+            out = np.empty_like(u)
+        self._b.apply_filter(matrix, u, out)
+        return out
+
+    def modal_energy(self, u: npt.NDArray[np.floating]) -> npt.NDArray[np.floating]:
+        """Compute the energy of the modes of each degree.
+
+        The energy of degree ``n`` is the sum of the squares of the modal
+        coefficients of degree ``n``.
+
+        Args:
+            u: The DOFs of the functions, with shape ``(num_cells, dim)``.
+
+        Returns:
+            The energies, with shape ``(num_cells, degree + 1)``.
+        """
+        return self._b.modal_energy(u)
+
+    def smoothness_indicator(self, u: npt.NDArray[np.floating]) -> npt.NDArray[np.floating]:
+        """Compute a smoothness indicator for a set of functions.
+
+        The indicator of a function is ``log10(E_N / E)``, where ``E_N``
+        is the energy of the modes of the highest degree and ``E`` is
+        the total energy. It is ``-inf`` for a function that is zero.
+
+        Args:
+            u: The DOFs of the functions, with shape ``(num_cells, dim)``.
+
+        Returns:
+            The indicator of each function.
+        """
+        return self._b.smoothness_indicator(u)
+
+    def decay_rate(self, u: npt.NDArray[np.floating]) -> npt.NDArray[np.floating]:
+        """Estimate the rate at which the modal coefficients of a set of functions decay.
+
+        The rate is minus the slope of the least squares line fit of
+        ``log(sqrt(E_n))`` against ``log(n)`` for the degrees ``n > 0``
+        that have a non-zero energy ``E_n``. It is NaN if fewer than two
+        degrees have a non-zero energy.
+
+        Args:
+            u: The DOFs of the functions, with shape ``(num_cells, dim)``.
+
+        Returns:
+            The decay rate of each function.
+        """
+        return self._b.decay_rate(u)
+
+
+def create_modal_basis(element: FiniteElement) -> ModalBasis:
+    """Create the modal basis of an element.
+
+    The transfer operators are computed when the basis is created, so
+    the basis should be created once and reused.
+
+    Args:
+        element: The element. Elements on pyramids are not supported.
+
+    Returns:
+        A modal basis.
+    """
+    if element.dtype == np.float32:
+        return ModalBasis(_ModalBasis_float32(element._e))
+    return ModalBasis(_ModalBasis_float64(element._e))
@@ -9,7 +9,10 @@ except ImportError:
 import numpy as np
 import numpy.typing as npt
 
-__all__ = ["pre_apply_dof_transformation", "pre_apply_dof_transformation_interval",
+from basix.cell import topology as _topology
+
+__all__ = ["create_batched_pre_apply_dof_transformation", "create_batched_post_apply_transpose_dof_transformation",
+           "pre_apply_dof_transformation", "pre_apply_dof_transformation_interval",
            "pre_apply_dof_transformation_triangle", "pre_apply_dof_transformation_quadrilateral",
            "pre_apply_dof_transformation_tetrahedron",  "pre_apply_dof_transformation_hexahedron",
            "pre_apply_dof_transformation_prism", "pre_apply_dof_transformation_pyramid",
@@ -371,3 +374,141 @@ def post_apply_transpose_dof_transformation_pyramid(entity_transformations: dict
     post_apply_transpose_dof_transformation(3, 8, 5, entity_transformations, entity_dofs,
                                             data, cell_info,
                                             _numba.typed.List(["quadrilateral"] + ["triangle"] * 4))
+
+
+def _entity_transformation_data(element) -> tuple[npt.NDArray, ...]:
+    """Get the data used to apply the DOF transformations of an element.
+
+    Args:
+        element: The element.
+
+    Returns:
+        The first DOF of each transformed entity, the number of DOFs of
+        each entity, the bit of ``cell_info`` that gives the reflection
+        of each entity, the first of the two bits that give the rotation
+        of each entity (or -1 for edges), and the reflection and
+        rotation matrices of each entity, with shape ``(num_entities, 2,
+        n, n)``.
+    """
+    num_entity_dofs = element.num_entity_dofs
+    tdim = len(num_entity_dofs) - 1
+    transformations = element.entity_transformations()
+
+    starts = []
+    sizes = []
+    reflection_bits = []
+    rotation_bits = []
+    matrices = []
+    if tdim >= 2:
+        face_start = 3 * len(num_entity_dofs[2]) if tdim == 3 else 0
+        dofstart = sum(num_entity_dofs[0])
+        for e, edofs in enumerate(num_entity_dofs[1]):
+            if edofs > 0:
+                starts.append(dofstart)
+                sizes.append(edofs)
+                reflection_bits.append(face_start + e)
+                rotation_bits.append(-1)
+                matrices.append((transformations["interval"][0], np.eye(edofs)))
+            dofstart += edofs
+
+        if tdim == 3:
+            faces = _topology(element.cell_type)[2]
+            for f, fdofs in enumerate(num_entity_dofs[2]):
+                if fdofs > 0:
+                    face_type = "triangle" if len(faces[f]) == 3 else "quadrilateral"
+                    starts.append(dofstart)
+                    sizes.append(fdofs)
+                    reflection_bits.append(3 * f)
+                    rotation_bits.append(3 * f + 1)
+                    matrices.append((transformations[face_type][1], transformations[face_type][0]))
+                dofstart += fdofs
+
+    n = max(sizes, default=0)
+    matrix_data = np.zeros((len(matrices), 2, n, n), dtype=element.dtype)
+    for i, (reflection, rotation) in enumerate(matrices):
+        matrix_data[i, 0, :sizes[i], :sizes[i]] = reflection
+        matrix_data[i, 1, :sizes[i], :sizes[i]] = rotation
+
+    return (np.array(starts, dtype=np.int64), np.array(sizes, dtype=np.int64),
+            np.array(reflection_bits, dtype=np.int64), np.array(rotation_bits, dtype=np.int64), matrix_data)
+
+
+@_numba.jit(nopython=True)
+def _apply_matrix(matrix: npt.NDArray, data: npt.NDArray, start: int, size: int):
+    """Apply a matrix in-place to the rows start to start + size of some data."""
+    tmp = np.empty(size, dtype=data.dtype)
+    for b in range(data.shape[1]):
+        for i in range(size):
+            tmp[i] = 0
+            for j in range(size):
+                tmp[i] += matrix[i, j] * data[start + j, b]
+        for i in range(size):
+            data[start + i, b] = tmp[i]
+
+
+@_numba.jit(nopython=True)
+def _transform_cell(data: npt.NDArray, cell_info: int, starts: npt.NDArray, sizes: npt.NDArray,
+                    reflection_bits: npt.NDArray, rotation_bits: npt.NDArray, matrices: npt.NDArray):
+    """Pre-apply dof transformations to the data of one cell, with shape (ndofs, block_size)."""
+    for i in range(starts.shape[0]):
+        if cell_info >> reflection_bits[i] & 1:
+            _apply_matrix(matrices[i, 0], data, starts[i], sizes[i])
+        if rotation_bits[i] >= 0:
+            for _ in range(cell_info >> rotation_bits[i] & 3):
+                _apply_matrix(matrices[i, 1], data, starts[i], sizes[i])
+
+
+def create_batched_pre_apply_dof_transformation(element, parallel: bool = True):
+    """Create a function that pre-applies dof transformations to the data of many cells.
+
+    The returned function is compiled by Numba for the given element,
+    so it does not dispatch on the cell type at runtime and can be
+    called from inside Numba-jitted kernels.
+
+    Args:
+        element: The element.
+        parallel: If ``True``, the cells are processed in parallel using
+            ``numba.prange``.
+
+    Returns:
+        A function ``f(data, cell_info)``, where ``data`` has shape
+        ``(ncells, ndofs, block_size)`` and ``cell_info`` has shape
+        ``(ncells, )``. The data is changed in-place.
+    """
+    starts, sizes, reflection_bits, rotation_bits, matrices = _entity_transformation_data(element)
+
+    @_numba.jit(nopython=True, parallel=parallel)
+    def apply(data: npt.NDArray, cell_info: npt.NDArray):
+        for c in _numba.prange(data.shape[0]):
+            _transform_cell(data[c], np.int64(cell_info[c]), starts, sizes, reflection_bits, rotation_bits,
+                            matrices)
+
+    return apply
+
+
+def create_batched_post_apply_transpose_dof_transformation(element, parallel: bool = True):
+    """Create a function that post-applies dof transformations to the transposed data of many cells.
+
+    The returned function is compiled by Numba for the given element,
+    so it does not dispatch on the cell type at runtime and can be
+    called from inside Numba-jitted kernels.
+
+    Args:
+        element: The element.
+        parallel: If ``True``, the cells are processed in parallel using
+            ``numba.prange``.
+
+    Returns:
+        A function ``f(data, cell_info)``, where ``data`` has shape
+        ``(ncells, block_size, ndofs)`` and ``cell_info`` has shape
+        ``(ncells, )``. The data is changed in-place.
+    """
+    starts, sizes, reflection_bits, rotation_bits, matrices = _entity_transformation_data(element)
+
+    @_numba.jit(nopython=True, parallel=parallel)
+    def apply(data: npt.NDArray, cell_info: npt.NDArray):
+        for c in _numba.prange(data.shape[0]):
+            _transform_cell(data[c].T, np.int64(cell_info[c]), starts, sizes, reflection_bits, rotation_bits,
+                            matrices)
+
+    return apply
@@ -0,0 +1,76 @@
+"""Runtime statistics of the use of elements.
+
+Collection is off by default, and is enabled with :func:`enable`. When
+it is enabled, each thread counts the tabulations that it does in its
+own counters, and the counters of all threads are summed when they are
+read, so collection adds little overhead to tabulation. Elements are
+identified by their :attr:`FiniteElement.fingerprint`, so elements with
+the same definition share counters::
+
+    basix.stats.enable()
+    element.tabulate(1, points)
+    basix.stats.counters(element)["tabulate_points"]
+
+The memory held by an element is reported by
+:meth:`FiniteElement.memory_footprint`.
+"""
+
+import typing
+
+from basix._basixcpp import stats_enabled as _stats_enabled
+from basix._basixcpp import stats_read as _stats_read
+from basix._basixcpp import stats_read_element as _stats_read_element
+from basix._basixcpp import stats_reset as _stats_reset
+from basix._basixcpp import stats_set_enabled as _stats_set_enabled
+from basix.finite_element import FiniteElement
+
+__all__ = ["enable", "disable", "enabled", "counters", "all_counters", "reset"]
+
+
+def enable():
+    """Start collecting statistics."""
+    _stats_set_enabled(True)
+
+
+def disable():
+    """Stop collecting statistics.
+
+    The counters keep their values.
+    """
+    _stats_set_enabled(False)
+
+
+def enabled() -> bool:
+    """Check if statistics are collected."""
+    return _stats_enabled()
+
+
+def all_counters() -> dict[int, dict[str, int]]:
+    """Get the counters of all elements, summed over all threads.
+
+    Returns:
+        Map from element fingerprint to the counters of the element:
+        the number of calls to ``tabulate`` and ``tabulate_batch``
+        (``tabulate_calls``), the number of points tabulated
+        (``tabulate_points``) and the number of bytes of tables produced
+        (``tabulate_bytes``).
+    """
+    return _stats_read()
+
+
+def counters(element: typing.Union[FiniteElement, int]) -> dict[str, int]:
+    """Get the counters of an element, summed over all threads.
+
+    Args:
+        element: The element, or its fingerprint.
+
+    Returns:
+        The counters of the element. See :func:`all_counters`.
+    """
+    fingerprint = element.fingerprint if isinstance(element, FiniteElement) else element
+    return _stats_read_element(fingerprint)
+
+
+def reset():
+    """Set all counters to zero."""
+    _stats_reset()
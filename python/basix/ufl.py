@@ -1,7 +1,6 @@
 """Functions to directly wrap Basix elements in UFL."""
 
 import functools as _functools
-import hashlib as _hashlib
 import itertools as _itertools
 import typing as _typing
 from abc import abstractmethod as _abstractmethod
@@ -115,6 +114,14 @@ class _ElementBase(_AbstractFiniteElement):
         self._pullback = pullback
         self._gdim = _cellname_to_tdim(cellname) if gdim is None else gdim
 
+    def __getstate__(self) -> dict:
+        """Get the state of the element for pickling.
+
+        Cached Basix composite elements are left out, as they are
+        recreated when they are next used.
+        """
+        return {key: value for key, value in self.__dict__.items() if not key.startswith("_basix_")}
+
     # Implementation of methods for UFL AbstractFiniteElement
     def __repr__(self):
         """Format as string for evaluation as Python object."""
@@ -871,18 +878,64 @@ class _MixedElement(_ElementBase):
             Tabulated basis functions
 
         """
+        if self._basix_mixed_element is not None:
+            tab = self._basix_mixed_element.tabulate(nderivs, points).transpose((0, 1, 3, 2))
+            if all(isinstance(e, _BasixElement) for e in self._sub_elements):
+                return tab.reshape((tab.shape[0], tab.shape[1], -1))
+
+            # The Basix mixed element holds the sub-element of each
+            # blocked element once, so its table is copied into each
+            # component of the block
+            mixed = self._basix_mixed_element
+            table = np.zeros((tab.shape[0], tab.shape[1], self.value_size, self.dim), dtype=tab.dtype)
+            dof_start = 0
+            value_start = 0
+            for i, e in enumerate(self._sub_elements):
+                d0, d1 = mixed.dof_offsets[i], mixed.dof_offsets[i + 1]
+                v0, v1 = mixed.value_offsets[i], mixed.value_offsets[i + 1]
+                block_size = e._block_size if isinstance(e, _BlockedElement) else 1
+                for b in range(block_size):
+                    table[:, :, value_start + b * (v1 - v0): value_start + (b + 1) * (v1 - v0),
+                          dof_start + b: dof_start + e.dim: block_size] = tab[:, :, v0:v1, d0:d1]
+                dof_start += e.dim
+                value_start += e.value_size
+            return table.reshape((tab.shape[0], tab.shape[1], -1))
+
         tables = []
         results = [e.tabulate(nderivs, points) for e in self._sub_elements]
         for deriv_tables in zip(*results):
-            new_table = np.zeros((len(points), self.value_size * self.dim))
-            start = 0
+            new_table = np.zeros((len(points), self.value_size, self.dim))
+            dof_start = 0
+            value_start = 0
             for e, t in zip(self._sub_elements, deriv_tables):
-                for i in range(0, e.dim, e.value_size):
-                    new_table[:, start: start + e.value_size] = t[:, i: i + e.value_size]
-                    start += self.value_size
-            tables.append(new_table)
+                new_table[:, value_start: value_start + e.value_size, dof_start: dof_start + e.dim] = t.reshape(
+                    (len(points), e.value_size, e.dim))
+                dof_start += e.dim
+                value_start += e.value_size
+            tables.append(new_table.reshape((len(points), -1)))
         return np.asarray(tables, dtype=np.float64)
 
+    @_functools.cached_property
+    def _basix_mixed_element(self) -> _typing.Optional[_basix.mixed_element.MixedElement]:
+        """Basix mixed element that tabulates all the sub-elements in one call.
+
+        A blocked sub-element whose block shape has rank 1 is represented
+        by its sub-element. This is ``None`` if any other sub-element is
+        not a Basix element.
+        """
+        elements = []
+        for e in self._sub_elements:
+            if isinstance(e, _BasixElement):
+                elements.append(e._element)
+            elif (isinstance(e, _BlockedElement) and isinstance(e._sub_element, _BasixElement)
+                  and len(e._block_shape) == 1):
+                elements.append(e._sub_element._element)
+            else:
+                return None
+        if len(set(e.dtype for e in elements)) != 1:
+            return None
+        return _basix.create_mixed_element(elements)
+
     def get_component_element(self, flat_component: int) -> tuple[_ElementBase, int, int]:
         """Get element that represents a component of the element, and the offset and stride of the component.
 
@@ -1170,6 +1223,10 @@ class _BlockedElement(_ElementBase):
         """
         assert len(self._block_shape) == 1  # TODO: block shape
         assert self.value_size == self._block_size  # TODO: remove this assumption
+        if self._basix_blocked_element is not None:
+            tab = self._basix_blocked_element.tabulate(nderivs, points)
+            return np.ascontiguousarray(tab.transpose((0, 1, 3, 2)))
+
         output = []
         for table in self._sub_element.tabulate(nderivs, points):
             # Repeat sub element horizontally
@@ -1198,6 +1255,16 @@ class _BlockedElement(_ElementBase):
         """
         return self._sub_element, flat_component, self._block_size
 
+    @_functools.cached_property
+    def _basix_blocked_element(self) -> _typing.Optional[_basix.mixed_element.BlockedElement]:
+        """Basix blocked element that tabulates the sub-element once for all the components.
+
+        This is ``None`` if the sub-element is not a Basix element.
+        """
+        if isinstance(self._sub_element, _BasixElement) and len(self._block_shape) == 1:
+            return _basix.create_blocked_element(self._sub_element._element, self._block_size)
+        return None
+
     def get_tensor_product_representation(self):
         """Get the element's tensor product factorisation."""
         if not self.has_tensor_product_factorisation:
@@ -1819,24 +1886,7 @@ def _compute_signature(element: _basix.finite_element.FiniteElement) -> str:
     signature = (f"{element.cell_type.name}, {element.value_shape}, {element.map_type.name}, "
                  f"{element.discontinuous}, {element.embedded_subdegree}, {element.embedded_superdegree}, "
                  f"{element.dtype}, {element.dof_ordering}")
-    data = ",".join([f"{i}" for row in element.wcoeffs for i in row])
-    data += "__"
-    for entity in element.x:
-        for points in entity:
-            data += ",".join([f"{i}" for p in points for i in p])
-            data += "_"
-    data += "__"
-
-    for entity in element.M:
-        for matrices in entity:
-            data += ",".join([f"{i}" for mat in matrices for row in mat for i in row])
-            data += "_"
-    data += "__"
-
-    for mat in element.entity_transformations().values():
-        data += ",".join([f"{i}" for row in mat for i in row])
-        data += "__"
-    signature += _hashlib.sha1(data.encode('utf-8')).hexdigest()
+    signature += f"{element.fingerprint:016x}"
 
     return signature
 
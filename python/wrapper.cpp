@@ -2,21 +2,29 @@
 // FEniCS Project
 // SPDX-License-Identifier:    MIT
 
+#include <basix/c-api.h>
 #include <basix/cell.h>
+#include <basix/codegen.h>
 #include <basix/element-families.h>
 #include <basix/finite-element.h>
 #include <basix/indexing.h>
 #include <basix/interpolation.h>
 #include <basix/lattice.h>
 #include <basix/maps.h>
+#include <basix/mixed-element.h>
 #include <basix/mdspan.hpp>
+#include <basix/modal.h>
+#include <basix/moments.h>
 #include <basix/polynomials.h>
 #include <basix/polyset.h>
 #include <basix/quadrature.h>
 #include <basix/sobolev-spaces.h>
+#include <basix/stats.h>
+#include <basix/tabulation-stream.h>
 #include <memory>
 #include <nanobind/nanobind.h>
 #include <nanobind/ndarray.h>
+#include <nanobind/stl/map.h>
 #include <nanobind/stl/pair.h>
 #include <nanobind/stl/string.h>
 #include <nanobind/stl/tuple.h>
@@ -84,18 +92,353 @@ auto as_nbarrayp(std::pair<V, std::array<std::size_t, U>>&& x)
   return as_nbarray(std::move(x.first), x.second.size(), x.second.data());
 }
 
+/// Check that an output array has the expected shape
+template <typename V, std::size_t N>
+void check_out_shape(const V& out, const std::array<std::size_t, N>& shape)
+{
+  for (std::size_t i = 0; i < N; ++i)
+  {
+    if (out.shape(i) != shape[i])
+      throw std::runtime_error("Output array has the wrong shape.");
+  }
+}
+
+/// Bind a DOF transformation function of an element class E. Two
+/// overloads are created: one that transforms the data of a single
+/// cell, and one that takes an array with a row of data for each cell
+/// and an array of cell info, and transforms all the cells in a single
+/// call.
+template <typename T, typename E, typename Fn>
+void declare_transformation(nb::class_<E>& element, const char* name, Fn fn)
+{
+  element
+      .def(
+          name,
+          [fn](const E& self,
+               nb::ndarray<T, nb::ndim<1>, nb::c_contig> data, int block_size,
+               std::uint32_t cell_info)
+          {
+            (self.*fn)(std::span(data.data(), data.size()), block_size,
+                       cell_info);
+          },
+          "data"_a.noconvert(), "block_size"_a, "cell_info"_a,
+          nb::call_guard<nb::gil_scoped_release>())
+      .def(
+          name,
+          [fn](const E& self,
+               nb::ndarray<T, nb::ndim<2>, nb::c_contig> data, int block_size,
+               nb::ndarray<const std::uint32_t, nb::ndim<1>, nb::c_contig>
+                   cell_info)
+          {
+            if (data.shape(0) != cell_info.shape(0))
+            {
+              throw std::runtime_error(
+                  "Data and cell info have different numbers of cells.");
+            }
+            const std::size_t n = data.shape(1);
+            if (block_size < 1
+                or n != static_cast<std::size_t>(self.dim()) * block_size)
+            {
+              throw std::runtime_error(
+                  "Rows of data must have length dim * block_size.");
+            }
+            for (std::size_t c = 0; c < data.shape(0); ++c)
+            {
+              (self.*fn)(std::span(data.data() + c * n, n), block_size,
+                         cell_info.data()[c]);
+            }
+          },
+          "data"_a.noconvert(), "block_size"_a, "cell_info"_a,
+          nb::call_guard<nb::gil_scoped_release>());
+}
+
+/// Bind a DOF permutation function of an element class E, for a single
+/// cell and for a batch of cells
+template <typename E, typename Fn>
+void declare_permutation(nb::class_<E>& element, const char* name, Fn fn)
+{
+  element
+      .def(
+          name,
+          [fn](const E& self,
+               nb::ndarray<std::int32_t, nb::ndim<1>, nb::c_contig> dofs,
+               std::uint32_t cell_info)
+          { (self.*fn)(std::span(dofs.data(), dofs.size()), cell_info); },
+          "dofs"_a.noconvert(), "cell_info"_a,
+          nb::call_guard<nb::gil_scoped_release>())
+      .def(
+          name,
+          [fn](const E& self,
+               nb::ndarray<std::int32_t, nb::ndim<2>, nb::c_contig> dofs,
+               nb::ndarray<const std::uint32_t, nb::ndim<1>, nb::c_contig>
+                   cell_info)
+          {
+            if (dofs.shape(0) != cell_info.shape(0))
+            {
+              throw std::runtime_error(
+                  "DOFs and cell info have different numbers of cells.");
+            }
+            const std::size_t n = dofs.shape(1);
+            if (n != static_cast<std::size_t>(self.dim()))
+              throw std::runtime_error("Rows of DOFs must have length dim.");
+            for (std::size_t c = 0; c < dofs.shape(0); ++c)
+            {
+              (self.*fn)(std::span(dofs.data() + c * n, n),
+                         cell_info.data()[c]);
+            }
+          },
+          "dofs"_a.noconvert(), "cell_info"_a,
+          nb::call_guard<nb::gil_scoped_release>());
+}
+
+/// Bind all the DOF transformation and permutation functions of an
+/// element class E
+template <typename T, typename E>
+void declare_transformations(nb::class_<E>& element)
+{
+  declare_transformation<T>(element, "pre_apply_dof_transformation",
+                            &E::template pre_apply_dof_transformation<T>);
+  declare_transformation<T>(
+      element, "pre_apply_transpose_dof_transformation",
+      &E::template pre_apply_transpose_dof_transformation<T>);
+  declare_transformation<T>(
+      element, "pre_apply_inverse_dof_transformation",
+      &E::template pre_apply_inverse_dof_transformation<T>);
+  declare_transformation<T>(
+      element, "pre_apply_inverse_transpose_dof_transformation",
+      &E::template pre_apply_inverse_transpose_dof_transformation<T>);
+  declare_transformation<T>(element, "post_apply_dof_transformation",
+                            &E::template post_apply_dof_transformation<T>);
+  declare_transformation<T>(
+      element, "post_apply_transpose_dof_transformation",
+      &E::template post_apply_transpose_dof_transformation<T>);
+  declare_transformation<T>(
+      element, "post_apply_inverse_dof_transformation",
+      &E::template post_apply_inverse_dof_transformation<T>);
+  declare_transformation<T>(
+      element, "post_apply_inverse_transpose_dof_transformation",
+      &E::template post_apply_inverse_transpose_dof_transformation<T>);
+  declare_permutation(element, "permute_dofs", &E::permute_dofs);
+  declare_permutation(element, "unpermute_dofs", &E::unpermute_dofs);
+}
+
+/// Bind the functions that MixedElement and BlockedElement share
+template <typename T, typename E>
+void declare_composite_element(nb::class_<E>& element)
+{
+  element
+      .def("tabulate",
+           [](const E& self, int n,
+              nb::ndarray<const T, nb::ndim<2>, nb::c_contig> x)
+           {
+             mdspan_t<const T, 2> _x(x.data(), x.shape(0), x.shape(1));
+             std::pair<std::vector<T>, std::array<std::size_t, 4>> tab;
+             {
+               nb::gil_scoped_release release;
+               tab = self.tabulate(n, _x);
+             }
+             return as_nbarrayp(std::move(tab));
+           })
+      .def(
+          "tabulate",
+          [](const E& self, int n,
+             nb::ndarray<const T, nb::ndim<2>, nb::c_contig> x,
+             nb::ndarray<T, nb::ndim<4>, nb::c_contig> out)
+          {
+            check_out_shape(out, self.tabulate_shape(n, x.shape(0)));
+            mdspan_t<const T, 2> _x(x.data(), x.shape(0), x.shape(1));
+            self.tabulate(n, _x,
+                          mdspan_t<T, 4>(out.data(), out.shape(0),
+                                         out.shape(1), out.shape(2),
+                                         out.shape(3)));
+          },
+          "n"_a, "x"_a, "out"_a.noconvert(),
+          nb::call_guard<nb::gil_scoped_release>())
+      .def_prop_ro("cell_type", &E::cell_type)
+      .def_prop_ro("dim", &E::dim)
+      .def_prop_ro("value_size", &E::value_size)
+      .def_prop_ro("entity_dofs", &E::entity_dofs)
+      .def_prop_ro("entity_closure_dofs", &E::entity_closure_dofs)
+      .def_prop_ro("dof_transformations_are_identity",
+                   &E::dof_transformations_are_identity)
+      .def_prop_ro("dof_transformations_are_permutations",
+                   &E::dof_transformations_are_permutations);
+
+  declare_transformations<T>(element);
+}
+
 template <typename T>
 void declare_float(nb::module_& m, std::string type)
 {
   std::string name = "FiniteElement_" + type;
-  nb::class_<FiniteElement<T>>(m, name.c_str())
+  nb::class_<FiniteElement<T>> element(m, name.c_str());
+  element
       .def("tabulate",
            [](const FiniteElement<T>& self, int n,
               nb::ndarray<const T, nb::ndim<2>, nb::c_contig> x)
            {
              mdspan_t<const T, 2> _x(x.data(), x.shape(0), x.shape(1));
-             return as_nbarrayp(self.tabulate(n, _x));
+             std::pair<std::vector<T>, std::array<std::size_t, 4>> tab;
+             {
+               nb::gil_scoped_release release;
+               tab = self.tabulate(n, _x);
+             }
+             return as_nbarrayp(std::move(tab));
            })
+      .def(
+          "tabulate",
+          [](const FiniteElement<T>& self, int n,
+             nb::ndarray<const T, nb::ndim<2>, nb::c_contig> x,
+             nb::ndarray<T, nb::ndim<4>, nb::c_contig> out)
+          {
+            check_out_shape(out, self.tabulate_shape(n, x.shape(0)));
+            mdspan_t<const T, 2> _x(x.data(), x.shape(0), x.shape(1));
+            self.tabulate(n, _x,
+                          mdspan_t<T, 4>(out.data(), out.shape(0),
+                                         out.shape(1), out.shape(2),
+                                         out.shape(3)));
+          },
+          "n"_a, "x"_a, "out"_a.noconvert(),
+          nb::call_guard<nb::gil_scoped_release>())
+      .def(
+          "tabulate_batch",
+          [](const FiniteElement<T>& self, int n,
+             nb::ndarray<const T, nb::ndim<2>, nb::c_contig> x,
+             nb::ndarray<const std::size_t, nb::ndim<1>, nb::c_contig> offsets,
+             int num_threads)
+          {
+            mdspan_t<const T, 2> _x(x.data(), x.shape(0), x.shape(1));
+            std::vector<T> tab;
+            {
+              nb::gil_scoped_release release;
+              tab = self.tabulate_batch(
+                  n, _x, std::span(offsets.data(), offsets.size()),
+                  num_threads);
+            }
+            return as_nbarray(std::move(tab));
+          },
+          "n"_a, "x"_a, "offsets"_a, "num_threads"_a = 1)
+      .def(
+          "tabulate_batch",
+          [](const FiniteElement<T>& self, int n,
+             nb::ndarray<const T, nb::ndim<2>, nb::c_contig> x,
+             nb::ndarray<const std::size_t, nb::ndim<1>, nb::c_contig> offsets,
+             int num_threads, nb::ndarray<T, nb::ndim<1>, nb::c_contig> out)
+          {
+            mdspan_t<const T, 2> _x(x.data(), x.shape(0), x.shape(1));
+            self.tabulate_batch(n, _x,
+                                std::span(offsets.data(), offsets.size()),
+                                std::span(out.data(), out.size()),
+                                num_threads);
+          },
+          "n"_a, "x"_a, "offsets"_a, "num_threads"_a, "out"_a.noconvert(),
+          nb::call_guard<nb::gil_scoped_release>())
+      .def("tabulate_directional_derivative",
+           [](const FiniteElement<T>& self,
+              nb::ndarray<const T, nb::ndim<2>, nb::c_contig> x,
+              nb::ndarray<const T, nb::ndim<3>, nb::c_contig> directions)
+           {
+             mdspan_t<const T, 2> _x(x.data(), x.shape(0), x.shape(1));
+             mdspan_t<const T, 3> _d(directions.data(), directions.shape(0),
+                                     directions.shape(1), directions.shape(2));
+             std::pair<std::vector<T>, std::array<std::size_t, 4>> tab;
+             {
+               nb::gil_scoped_release release;
+               tab = self.tabulate_directional_derivative(_x, _d);
+             }
+             return as_nbarrayp(std::move(tab));
+           })
+      .def(
+          "tabulate_directional_derivative",
+          [](const FiniteElement<T>& self,
+             nb::ndarray<const T, nb::ndim<2>, nb::c_contig> x,
+             nb::ndarray<const T, nb::ndim<3>, nb::c_contig> directions,
+             nb::ndarray<T, nb::ndim<4>, nb::c_contig> out)
+          {
+            mdspan_t<const T, 2> _x(x.data(), x.shape(0), x.shape(1));
+            mdspan_t<const T, 3> _d(directions.data(), directions.shape(0),
+                                    directions.shape(1), directions.shape(2));
+            self.tabulate_directional_derivative(
+                _x, _d,
+                mdspan_t<T, 4>(out.data(), out.shape(0), out.shape(1),
+                               out.shape(2), out.shape(3)));
+          },
+          "x"_a, "directions"_a, "out"_a.noconvert(),
+          nb::call_guard<nb::gil_scoped_release>())
+      .def("tabulate_operator",
+           [](const FiniteElement<T>& self, element::differential_operator op,
+              nb::ndarray<const T, nb::ndim<2>, nb::c_contig> x)
+           {
+             mdspan_t<const T, 2> _x(x.data(), x.shape(0), x.shape(1));
+             std::pair<std::vector<T>, std::array<std::size_t, 3>> tab;
+             {
+               nb::gil_scoped_release release;
+               tab = self.tabulate_operator(op, _x);
+             }
+             return as_nbarrayp(std::move(tab));
+           })
+      .def(
+          "tabulate_operator",
+          [](const FiniteElement<T>& self, element::differential_operator op,
+             nb::ndarray<const T, nb::ndim<2>, nb::c_contig> x,
+             nb::ndarray<T, nb::ndim<3>, nb::c_contig> out)
+          {
+            check_out_shape(out,
+                            self.tabulate_operator_shape(op, x.shape(0)));
+            mdspan_t<const T, 2> _x(x.data(), x.shape(0), x.shape(1));
+            self.tabulate_operator(op, _x,
+                                   mdspan_t<T, 3>(out.data(), out.shape(0),
+                                                  out.shape(1), out.shape(2)));
+          },
+          "op"_a, "x"_a, "out"_a.noconvert(),
+          nb::call_guard<nb::gil_scoped_release>())
+      .def("physical_operator_size", &FiniteElement<T>::physical_operator_size,
+           "op"_a, "gdim"_a)
+      .def("push_forward_operator",
+           [](const FiniteElement<T>& self, element::differential_operator op,
+              nb::ndarray<const T, nb::ndim<3>, nb::c_contig> U,
+              nb::ndarray<const T, nb::ndim<3>, nb::c_contig> J,
+              nb::ndarray<const T, nb::ndim<1>, nb::c_contig> detJ,
+              nb::ndarray<const T, nb::ndim<3>, nb::c_contig> K)
+           {
+             std::pair<std::vector<T>, std::array<std::size_t, 3>> u;
+             {
+               nb::gil_scoped_release release;
+               u = self.push_forward_operator(
+                   op,
+                   mdspan_t<const T, 3>(U.data(), U.shape(0), U.shape(1),
+                                        U.shape(2)),
+                   mdspan_t<const T, 3>(J.data(), J.shape(0), J.shape(1),
+                                        J.shape(2)),
+                   std::span<const T>(detJ.data(), detJ.shape(0)),
+                   mdspan_t<const T, 3>(K.data(), K.shape(0), K.shape(1),
+                                        K.shape(2)));
+             }
+             return as_nbarrayp(std::move(u));
+           })
+      .def(
+          "push_forward_operator",
+          [](const FiniteElement<T>& self, element::differential_operator op,
+             nb::ndarray<const T, nb::ndim<3>, nb::c_contig> U,
+             nb::ndarray<const T, nb::ndim<3>, nb::c_contig> J,
+             nb::ndarray<const T, nb::ndim<1>, nb::c_contig> detJ,
+             nb::ndarray<const T, nb::ndim<3>, nb::c_contig> K,
+             nb::ndarray<T, nb::ndim<3>, nb::c_contig> out)
+          {
+            self.push_forward_operator(
+                op,
+                mdspan_t<const T, 3>(U.data(), U.shape(0), U.shape(1),
+                                     U.shape(2)),
+                mdspan_t<const T, 3>(J.data(), J.shape(0), J.shape(1),
+                                     J.shape(2)),
+                std::span<const T>(detJ.data(), detJ.shape(0)),
+                mdspan_t<const T, 3>(K.data(), K.shape(0), K.shape(1),
+                                     K.shape(2)),
+                mdspan_t<T, 3>(out.data(), out.shape(0), out.shape(1),
+                               out.shape(2)));
+          },
+          "op"_a, "U"_a, "J"_a, "detJ"_a, "K"_a, "out"_a.noconvert(),
+          nb::call_guard<nb::gil_scoped_release>())
       .def("__eq__", &FiniteElement<T>::operator==)
       .def("push_forward",
            [](const FiniteElement<T>& self,
@@ -104,14 +447,18 @@ void declare_float(nb::module_& m, std::string type)
               nb::ndarray<const T, nb::ndim<1>, nb::c_contig> detJ,
               nb::ndarray<const T, nb::ndim<3>, nb::c_contig> K)
            {
-             auto u = self.push_forward(
-                 mdspan_t<const T, 3>(U.data(), U.shape(0), U.shape(1),
-                                      U.shape(2)),
-                 mdspan_t<const T, 3>(J.data(), J.shape(0), J.shape(1),
-                                      J.shape(2)),
-                 std::span<const T>(detJ.data(), detJ.shape(0)),
-                 mdspan_t<const T, 3>(K.data(), K.shape(0), K.shape(1),
-                                      K.shape(2)));
+             std::pair<std::vector<T>, std::array<std::size_t, 3>> u;
+             {
+               nb::gil_scoped_release release;
+               u = self.push_forward(
+                   mdspan_t<const T, 3>(U.data(), U.shape(0), U.shape(1),
+                                        U.shape(2)),
+                   mdspan_t<const T, 3>(J.data(), J.shape(0), J.shape(1),
+                                        J.shape(2)),
+                   std::span<const T>(detJ.data(), detJ.shape(0)),
+                   mdspan_t<const T, 3>(K.data(), K.shape(0), K.shape(1),
+                                        K.shape(2)));
+             }
              return as_nbarrayp(std::move(u));
            })
       .def("pull_back",
@@ -121,48 +468,81 @@ void declare_float(nb::module_& m, std::string type)
               nb::ndarray<const T, nb::ndim<1>, nb::c_contig> detJ,
               nb::ndarray<const T, nb::ndim<3>, nb::c_contig> K)
            {
-             auto U = self.pull_back(
-                 mdspan_t<const T, 3>(u.data(), u.shape(0), u.shape(1),
-                                      u.shape(2)),
-                 mdspan_t<const T, 3>(J.data(), J.shape(0), J.shape(1),
-                                      J.shape(2)),
-                 std::span<const T>(detJ.data(), detJ.shape(0)),
-                 mdspan_t<const T, 3>(K.data(), K.shape(0), K.shape(1),
-                                      K.shape(2)));
+             std::pair<std::vector<T>, std::array<std::size_t, 3>> U;
+             {
+               nb::gil_scoped_release release;
+               U = self.pull_back(
+                   mdspan_t<const T, 3>(u.data(), u.shape(0), u.shape(1),
+                                        u.shape(2)),
+                   mdspan_t<const T, 3>(J.data(), J.shape(0), J.shape(1),
+                                        J.shape(2)),
+                   std::span<const T>(detJ.data(), detJ.shape(0)),
+                   mdspan_t<const T, 3>(K.data(), K.shape(0), K.shape(1),
+                                        K.shape(2)));
+             }
              return as_nbarrayp(std::move(U));
            })
-      .def("pre_apply_dof_transformation",
-           [](const FiniteElement<T>& self,
-              nb::ndarray<T, nb::ndim<1>, nb::c_contig> data, int block_size,
-              std::uint32_t cell_info)
-           {
-             self.pre_apply_dof_transformation(
-                 std::span(data.data(), data.size()), block_size, cell_info);
-           })
-      .def("post_apply_transpose_dof_transformation",
-           [](const FiniteElement<T>& self,
-              nb::ndarray<T, nb::ndim<1>, nb::c_contig> data, int block_size,
-              std::uint32_t cell_info)
-           {
-             self.post_apply_transpose_dof_transformation(
-                 std::span(data.data(), data.size()), block_size, cell_info);
-           })
-      .def("pre_apply_inverse_transpose_dof_transformation",
-           [](const FiniteElement<T>& self,
-              nb::ndarray<T, nb::ndim<1>, nb::c_contig> data, int block_size,
-              std::uint32_t cell_info)
-           {
-             self.pre_apply_inverse_transpose_dof_transformation(
-                 std::span(data.data(), data.size()), block_size, cell_info);
-           })
+      .def(
+          "push_forward",
+          [](const FiniteElement<T>& self,
+             nb::ndarray<const T, nb::ndim<3>, nb::c_contig> U,
+             nb::ndarray<const T, nb::ndim<3>, nb::c_contig> J,
+             nb::ndarray<const T, nb::ndim<1>, nb::c_contig> detJ,
+             nb::ndarray<const T, nb::ndim<3>, nb::c_contig> K,
+             nb::ndarray<T, nb::ndim<3>, nb::c_contig> out)
+          {
+            // The shapes of the arrays are checked by push_forward
+            self.push_forward(
+                mdspan_t<const T, 3>(U.data(), U.shape(0), U.shape(1),
+                                     U.shape(2)),
+                mdspan_t<const T, 3>(J.data(), J.shape(0), J.shape(1),
+                                     J.shape(2)),
+                std::span<const T>(detJ.data(), detJ.shape(0)),
+                mdspan_t<const T, 3>(K.data(), K.shape(0), K.shape(1),
+                                     K.shape(2)),
+                mdspan_t<T, 3>(out.data(), out.shape(0), out.shape(1),
+                               out.shape(2)));
+          },
+          "U"_a, "J"_a, "detJ"_a, "K"_a, "out"_a.noconvert(),
+          nb::call_guard<nb::gil_scoped_release>())
+      .def(
+          "pull_back",
+          [](const FiniteElement<T>& self,
+             nb::ndarray<const T, nb::ndim<3>, nb::c_contig> u,
+             nb::ndarray<const T, nb::ndim<3>, nb::c_contig> J,
+             nb::ndarray<const T, nb::ndim<1>, nb::c_contig> detJ,
+             nb::ndarray<const T, nb::ndim<3>, nb::c_contig> K,
+             nb::ndarray<T, nb::ndim<3>, nb::c_contig> out)
+          {
+            // The shapes of the arrays are checked by pull_back
+            self.pull_back(
+                mdspan_t<const T, 3>(u.data(), u.shape(0), u.shape(1),
+                                     u.shape(2)),
+                mdspan_t<const T, 3>(J.data(), J.shape(0), J.shape(1),
+                                     J.shape(2)),
+                std::span<const T>(detJ.data(), detJ.shape(0)),
+                mdspan_t<const T, 3>(K.data(), K.shape(0), K.shape(1),
+                                     K.shape(2)),
+                mdspan_t<T, 3>(out.data(), out.shape(0), out.shape(1),
+                               out.shape(2)));
+          },
+          "u"_a, "J"_a, "detJ"_a, "K"_a, "out"_a.noconvert(),
+          nb::call_guard<nb::gil_scoped_release>())
       .def("base_transformations", [](const FiniteElement<T>& self)
            { return as_nbarrayp(self.base_transformations()); })
       .def("entity_transformations",
            [](const FiniteElement<T>& self)
            {
+             // The arrays are views that keep the element alive
+             nb::object owner = nb::find(self);
              nb::dict t;
              for (auto& [key, data] : self.entity_transformations())
-               t[cell_type_to_str(key).c_str()] = as_nbarrayp(std::move(data));
+             {
+               auto& [M, shape] = data;
+               t[cell_type_to_str(key).c_str()]
+                   = nb::ndarray<const T, nb::ndim<3>, nb::numpy>(
+                       M.data(), shape.size(), shape.data(), owner);
+             }
              return t;
            })
       .def("get_tensor_product_representation", [](const FiniteElement<T>& self)
@@ -319,6 +699,27 @@ void declare_float(nb::module_& m, std::string type)
       .def_prop_ro("interpolation_nderivs",
                    &FiniteElement<T>::interpolation_nderivs)
       .def_prop_ro("dof_ordering", &FiniteElement<T>::dof_ordering)
+      .def_prop_ro("fingerprint", &FiniteElement<T>::fingerprint)
+      .def_prop_ro("construction_times",
+                   &FiniteElement<T>::construction_times)
+      .def("memory_footprint", &FiniteElement<T>::memory_footprint)
+      .def_prop_ro("handle",
+                   [](const FiniteElement<T>& self)
+                   { return reinterpret_cast<std::uintptr_t>(&self); })
+      .def("__getstate__",
+           [](const FiniteElement<T>& self)
+           {
+             std::vector<std::uint8_t> data = self.serialize();
+             return nb::bytes(reinterpret_cast<const char*>(data.data()),
+                              data.size());
+           })
+      .def("__setstate__",
+           [](FiniteElement<T>& self, nb::bytes state)
+           {
+             new (&self) FiniteElement<T>(FiniteElement<T>::deserialize(
+                 std::span(reinterpret_cast<const std::uint8_t*>(state.c_str()),
+                           state.size())));
+           })
       .def_prop_ro("dtype",
                    [](const FiniteElement<T>&) -> char
                    {
@@ -330,6 +731,275 @@ void declare_float(nb::module_& m, std::string type)
                        return 'd';
                    });
 
+  // DOF transformations, for a single cell and for a batch of cells
+  declare_transformations<T>(element);
+
+  // Mixed and blocked elements
+  std::string mixed_name = "MixedElement_" + type;
+  nb::class_<MixedElement<T>> mixed(m, mixed_name.c_str());
+  mixed.def(nb::init<std::vector<FiniteElement<T>>>(), "elements"_a)
+      .def_prop_ro("num_sub_elements",
+                   [](const MixedElement<T>& self)
+                   { return self.sub_elements().size(); })
+      .def_prop_ro("dof_offsets", &MixedElement<T>::dof_offsets)
+      .def_prop_ro("value_offsets", &MixedElement<T>::value_offsets)
+      .def_prop_ro(
+          "points",
+          [](const MixedElement<T>& self)
+          {
+            auto& [x, shape] = self.points();
+            return nb::ndarray<const T, nb::ndim<2>, nb::numpy>(
+                x.data(), shape.size(), shape.data());
+          },
+          nb::rv_policy::reference_internal)
+      .def_prop_ro("point_maps", &MixedElement<T>::point_maps)
+      .def_prop_ro("interpolation_nderivs",
+                   &MixedElement<T>::interpolation_nderivs)
+      .def_prop_ro(
+          "interpolation_matrix",
+          [](const MixedElement<T>& self)
+          {
+            auto& [P, shape] = self.interpolation_matrix();
+            return nb::ndarray<const T, nb::ndim<2>, nb::numpy>(
+                P.data(), shape.size(), shape.data());
+          },
+          nb::rv_policy::reference_internal);
+  declare_composite_element<T>(mixed);
+
+  std::string blocked_name = "BlockedElement_" + type;
+  nb::class_<BlockedElement<T>> blocked(m, blocked_name.c_str());
+  blocked.def(nb::init<FiniteElement<T>, int>(), "element"_a, "block_size"_a)
+      .def_prop_ro("block_size", &BlockedElement<T>::block_size);
+  declare_composite_element<T>(blocked);
+
+  // Modal bases
+  std::string modal_name = "ModalBasis_" + type;
+  nb::class_<ModalBasis<T>>(m, modal_name.c_str())
+      .def(nb::init<const FiniteElement<T>&>(), "element"_a)
+      .def_prop_ro("dim", &ModalBasis<T>::dim)
+      .def_prop_ro("num_modes", &ModalBasis<T>::num_modes)
+      .def_prop_ro("degree", &ModalBasis<T>::degree)
+      .def_prop_ro("mode_degrees", &ModalBasis<T>::mode_degrees)
+      .def_prop_ro(
+          "nodal_to_modal",
+          [](const ModalBasis<T>& self)
+          {
+            auto& [x, shape] = self.nodal_to_modal();
+            return nb::ndarray<const T, nb::ndim<2>, nb::numpy>(
+                x.data(), shape.size(), shape.data());
+          },
+          nb::rv_policy::reference_internal)
+      .def_prop_ro(
+          "modal_to_nodal",
+          [](const ModalBasis<T>& self)
+          {
+            auto& [x, shape] = self.modal_to_nodal();
+            return nb::ndarray<const T, nb::ndim<2>, nb::numpy>(
+                x.data(), shape.size(), shape.data());
+          },
+          nb::rv_policy::reference_internal)
+      .def(
+          "filter_matrix",
+          [](const ModalBasis<T>& self,
+             nb::ndarray<const T, nb::ndim<1>, nb::c_contig> sigma)
+          {
+            return as_nbarrayp(self.filter_matrix(
+                std::span<const T>(sigma.data(), sigma.size())));
+          },
+          "sigma"_a.noconvert())
+      .def(
+          "exponential_filter",
+          [](const ModalBasis<T>& self, int order, T strength, int cutoff)
+          {
+            return as_nbarrayp(
+                self.exponential_filter(order, strength, cutoff));
+          },
+          "order"_a, "strength"_a, "cutoff"_a)
+      .def(
+          "cutoff_filter", [](const ModalBasis<T>& self, int cutoff)
+          { return as_nbarrayp(self.cutoff_filter(cutoff)); }, "cutoff"_a)
+      .def(
+          "to_modal",
+          [](const ModalBasis<T>& self,
+             nb::ndarray<const T, nb::ndim<2>, nb::c_contig> u)
+          {
+            mdspan_t<const T, 2> _u(u.data(), u.shape(0), u.shape(1));
+            std::pair<std::vector<T>, std::array<std::size_t, 2>> m;
+            {
+              nb::gil_scoped_release release;
+              m = self.to_modal(_u);
+            }
+            return as_nbarrayp(std::move(m));
+          },
+          "u"_a.noconvert())
+      .def(
+          "to_modal",
+          [](const ModalBasis<T>& self,
+             nb::ndarray<const T, nb::ndim<2>, nb::c_contig> u,
+             nb::ndarray<T, nb::ndim<2>, nb::c_contig> out)
+          {
+            self.to_modal(
+                mdspan_t<const T, 2>(u.data(), u.shape(0), u.shape(1)),
+                mdspan_t<T, 2>(out.data(), out.shape(0), out.shape(1)));
+          },
+          "u"_a.noconvert(), "out"_a.noconvert(),
+          nb::call_guard<nb::gil_scoped_release>())
+      .def(
+          "to_nodal",
+          [](const ModalBasis<T>& self,
+             nb::ndarray<const T, nb::ndim<2>, nb::c_contig> m)
+          {
+            mdspan_t<const T, 2> _m(m.data(), m.shape(0), m.shape(1));
+            std::pair<std::vector<T>, std::array<std::size_t, 2>> u;
+            {
+              nb::gil_scoped_release release;
+              u = self.to_nodal(_m);
+            }
+            return as_nbarrayp(std::move(u));
+          },
+          "m"_a.noconvert())
+      .def(
+          "to_nodal",
+          [](const ModalBasis<T>& self,
+             nb::ndarray<const T, nb::ndim<2>, nb::c_contig> m,
+             nb::ndarray<T, nb::ndim<2>, nb::c_contig> out)
+          {
+            self.to_nodal(
+                mdspan_t<const T, 2>(m.data(), m.shape(0), m.shape(1)),
+                mdspan_t<T, 2>(out.data(), out.shape(0), out.shape(1)));
+          },
+          "m"_a.noconvert(), "out"_a.noconvert(),
+          nb::call_guard<nb::gil_scoped_release>())
+      .def(
+          "apply_filter",
+          [](const ModalBasis<T>& self,
+             nb::ndarray<const T, nb::ndim<2>, nb::c_contig> filter,
+             nb::ndarray<const T, nb::ndim<2>, nb::c_contig> u,
+             nb::ndarray<T, nb::ndim<2>, nb::c_contig> out)
+          {
+            self.apply_filter(
+                mdspan_t<const T, 2>(filter.data(), filter.shape(0),
+                                     filter.shape(1)),
+                mdspan_t<const T, 2>(u.data(), u.shape(0), u.shape(1)),
+                mdspan_t<T, 2>(out.data(), out.shape(0), out.shape(1)));
+          },
+          "filter"_a.noconvert(), "u"_a.noconvert(), "out"_a.noconvert(),
+          nb::call_guard<nb::gil_scoped_release>())
+      .def(
+          "modal_energy",
+          [](const ModalBasis<T>& self,
+             nb::ndarray<const T, nb::ndim<2>, nb::c_contig> u)
+          {
+            mdspan_t<const T, 2> _u(u.data(), u.shape(0), u.shape(1));
+            std::pair<std::vector<T>, std::array<std::size_t, 2>> energy;
+            {
+              nb::gil_scoped_release release;
+              energy = self.modal_energy(_u);
+            }
+            return as_nbarrayp(std::move(energy));
+          },
+          "u"_a.noconvert())
+      .def(
+          "smoothness_indicator",
+          [](const ModalBasis<T>& self,
+             nb::ndarray<const T, nb::ndim<2>, nb::c_contig> u)
+          {
+            mdspan_t<const T, 2> _u(u.data(), u.shape(0), u.shape(1));
+            std::vector<T> s;
+            {
+              nb::gil_scoped_release release;
+              s = self.smoothness_indicator(_u);
+            }
+            return as_nbarray(std::move(s));
+          },
+          "u"_a.noconvert())
+      .def(
+          "decay_rate",
+          [](const ModalBasis<T>& self,
+             nb::ndarray<const T, nb::ndim<2>, nb::c_contig> u)
+          {
+            mdspan_t<const T, 2> _u(u.data(), u.shape(0), u.shape(1));
+            std::vector<T> rate;
+            {
+              nb::gil_scoped_release release;
+              rate = self.decay_rate(_u);
+            }
+            return as_nbarray(std::move(rate));
+          },
+          "u"_a.noconvert());
+
+  // Streams of tabulated chunks
+  std::string stream_name = "TabulationStream_" + type;
+  nb::class_<TabulationStream<T>>(m, stream_name.c_str())
+      .def(
+          "__init__",
+          [](TabulationStream<T>* self, const FiniteElement<T>& element,
+             int nd, nb::iterable chunks, std::size_t chunk_size,
+             bool pipelined)
+          {
+            // The producer is called with the GIL released, and takes
+            // the next chunk from the Python iterator
+            auto producer = [it = nb::iter(chunks)](mdspan_t<T, 2> x)
+            {
+              nb::gil_scoped_acquire acquire;
+              nb::object chunk;
+              try
+              {
+                chunk = it.attr("__next__")();
+              }
+              catch (nb::python_error& e)
+              {
+                if (e.matches(PyExc_StopIteration))
+                  return std::size_t(0);
+                throw;
+              }
+
+              // A chunk with no points ends the stream, whatever its
+              // shape
+              if (nb::hasattr(chunk, "size")
+                  and nb::cast<std::size_t>(chunk.attr("size")) == 0)
+              {
+                return std::size_t(0);
+              }
+
+              auto _x = nb::cast<
+                  nb::ndarray<const T, nb::ndim<2>, nb::c_contig>>(chunk);
+              if (_x.shape(0) > x.extent(0) or _x.shape(1) != x.extent(1))
+                throw std::runtime_error("Chunk has the wrong shape.");
+              std::copy_n(_x.data(), _x.size(), x.data_handle());
+              return _x.shape(0);
+            };
+            new (self) TabulationStream<T>(element, nd, chunk_size,
+                                           std::move(producer), pipelined);
+          },
+          "element"_a, "nd"_a, "chunks"_a, "chunk_size"_a, "pipelined"_a,
+          nb::keep_alive<1, 2>())
+      .def("next", &TabulationStream<T>::next,
+           nb::call_guard<nb::gil_scoped_release>())
+      .def_prop_ro(
+          "points",
+          [](const TabulationStream<T>& self)
+          {
+            auto x = self.points();
+            std::array<std::size_t, 2> shape = {x.extent(0), x.extent(1)};
+            return nb::ndarray<const T, nb::ndim<2>, nb::numpy>(
+                x.data_handle(), shape.size(), shape.data());
+          },
+          nb::rv_policy::reference_internal)
+      .def_prop_ro(
+          "table",
+          [](const TabulationStream<T>& self)
+          {
+            auto t = self.table();
+            std::array<std::size_t, 4> shape
+                = {t.extent(0), t.extent(1), t.extent(2), t.extent(3)};
+            return nb::ndarray<const T, nb::ndim<4>, nb::numpy>(
+                t.data_handle(), shape.size(), shape.data());
+          },
+          nb::rv_policy::reference_internal)
+      .def_prop_ro("chunk_size", &TabulationStream<T>::chunk_size)
+      .def_prop_ro("num_points", &TabulationStream<T>::num_points);
+
   // Create FiniteElement
   m.def(
       "create_custom_element",
@@ -389,19 +1059,86 @@ void declare_float(nb::module_& m, std::string type)
         [](const FiniteElement<T>& element_from,
            const FiniteElement<T>& element_to)
         {
-          return as_nbarrayp(
-              basix::compute_interpolation_operator(element_from, element_to));
+          std::pair<std::vector<T>, std::array<std::size_t, 2>> op;
+          {
+            nb::gil_scoped_release release;
+            op = basix::compute_interpolation_operator(element_from,
+                                                       element_to);
+          }
+          return as_nbarrayp(std::move(op));
         });
 
+  // Constraints across nonconforming facets
+  auto constraint_to_tuple = [](const interface_constraint<T>& c)
+  {
+    return nb::make_tuple(as_nbarray(std::vector<int>(c.dofs)),
+                          as_nbarray(std::vector<int>(c.offsets)),
+                          as_nbarray(std::vector<int>(c.columns)),
+                          as_nbarray(std::vector<T>(c.values)));
+  };
+  m.def(
+      "compute_interface_constraint",
+      [constraint_to_tuple](const FiniteElement<T>& coarse, int coarse_facet,
+                            const FiniteElement<T>& fine, int fine_facet,
+                            int subfacet, int orientation)
+      {
+        interface_constraint<T> c;
+        {
+          nb::gil_scoped_release release;
+          c = basix::compute_interface_constraint(
+              coarse, coarse_facet, fine, fine_facet, subfacet, orientation);
+        }
+        return constraint_to_tuple(c);
+      },
+      "coarse"_a, "coarse_facet"_a, "fine"_a, "fine_facet"_a, "subfacet"_a,
+      "orientation"_a);
+
+  std::string constraints_name = "InterfaceConstraints_" + type;
+  nb::class_<InterfaceConstraints<T>>(m, constraints_name.c_str())
+      .def(nb::init<const FiniteElement<T>&, const FiniteElement<T>&>(),
+           "coarse"_a, "fine"_a, nb::call_guard<nb::gil_scoped_release>())
+      .def(
+          "constraint",
+          [constraint_to_tuple](const InterfaceConstraints<T>& self,
+                                int coarse_facet, int fine_facet,
+                                int subfacet, int orientation)
+          {
+            return constraint_to_tuple(self.constraint(
+                coarse_facet, fine_facet, subfacet, orientation));
+          },
+          "coarse_facet"_a, "fine_facet"_a, "subfacet"_a, "orientation"_a)
+      .def("__len__", &InterfaceConstraints<T>::size);
+
   m.def(
       "tabulate_polynomial_set",
       [](cell::type celltype, polyset::type polytype, int d, int n,
          nb::ndarray<const T, nb::ndim<2>, nb::c_contig> x)
       {
         mdspan_t<const T, 2> _x(x.data(), x.shape(0), x.shape(1));
-        return as_nbarrayp(polyset::tabulate(celltype, polytype, d, n, _x));
+        std::pair<std::vector<T>, std::array<std::size_t, 3>> P;
+        {
+          nb::gil_scoped_release release;
+          P = polyset::tabulate(celltype, polytype, d, n, _x);
+        }
+        return as_nbarrayp(std::move(P));
       },
       "celltype"_a, "polytype"_a, "d"_a, "n"_a, "x"_a.noconvert());
+
+  // Generate code
+  m.def(
+      "codegen_tabulate",
+      [](const FiniteElement<T>& element, int n,
+         nb::ndarray<const T, nb::ndim<2>, nb::c_contig> x,
+         const std::string& name, codegen::language lang)
+      {
+        mdspan_t<const T, 2> _x(x.data(), x.shape(0), x.shape(1));
+        return codegen::tabulate(element, n, _x, name, lang);
+      },
+      "element"_a, "n"_a, "x"_a.noconvert(), "name"_a, "lang"_a);
+  m.def("codegen_dof_transformation", &codegen::dof_transformation<T>,
+        "element"_a, "kind"_a, "name"_a, "lang"_a);
+  m.def("codegen_static_element_tables",
+        &codegen::static_element_tables<T>, "element"_a, "name"_a);
 }
 
 } // namespace
@@ -427,6 +1164,30 @@ NB_MODULE(_basixcpp, m)
 
   m.def("sobolev_space_intersection", &sobolev::space_intersection);
 
+  m.def("moments_clear_cache", &moments::clear_cache);
+
+  m.def("stats_set_enabled", &stats::set_enabled);
+  m.def("stats_enabled", &stats::enabled);
+  m.def("stats_reset", &stats::reset);
+  auto counters_to_map = [](const stats::counters& c)
+  {
+    return std::map<std::string, std::uint64_t>{
+        {"tabulate_calls", c.tabulate_calls},
+        {"tabulate_points", c.tabulate_points},
+        {"tabulate_bytes", c.tabulate_bytes}};
+  };
+  m.def("stats_read",
+        [counters_to_map]()
+        {
+          std::map<std::uint64_t, std::map<std::string, std::uint64_t>> out;
+          for (auto& [fingerprint, c] : stats::read())
+            out[fingerprint] = counters_to_map(c);
+          return out;
+        });
+  m.def("stats_read_element",
+        [counters_to_map](std::uint64_t fingerprint)
+        { return counters_to_map(stats::read(fingerprint)); });
+
   nb::enum_<lattice::type>(m, "LatticeType")
       .value("equispaced", lattice::type::equispaced)
       .value("gll", lattice::type::gll)
@@ -556,6 +1317,15 @@ NB_MODULE(_basixcpp, m)
       .def_prop_ro("name",
                    [](nb::object obj) { return nb::getattr(obj, "__name__"); });
 
+  nb::enum_<element::differential_operator>(m, "DifferentialOperator")
+      .value("divergence", element::differential_operator::divergence)
+      .value("curl", element::differential_operator::curl)
+      .value("symmetric_gradient",
+             element::differential_operator::symmetric_gradient)
+      .value("trace", element::differential_operator::trace)
+      .def_prop_ro("name",
+                   [](nb::object obj) { return nb::getattr(obj, "__name__"); });
+
   nb::enum_<element::lagrange_variant>(m, "LagrangeVariant")
       .value("unset", element::lagrange_variant::unset)
       .value("equispaced", element::lagrange_variant::equispaced)
@@ -612,7 +1382,8 @@ NB_MODULE(_basixcpp, m)
       "family_name"_a, "cell_name"_a, "degree"_a, "dtype"_a,
       "lagrange_variant"_a = element::lagrange_variant::unset,
       "dpc_variant"_a = element::dpc_variant::unset, "discontinuous"_a = false,
-      "dof_ordering"_a = std::vector<int>());
+      "dof_ordering"_a = std::vector<int>(),
+      nb::call_guard<nb::gil_scoped_release>());
 
   nb::enum_<polyset::type>(m, "PolysetType")
       .value("standard", polyset::type::standard)
@@ -635,13 +1406,71 @@ NB_MODULE(_basixcpp, m)
       [](quadrature::type rule, cell::type celltype, polyset::type polytype,
          int m)
       {
-        auto [pts, w]
-            = quadrature::make_quadrature<double>(rule, celltype, polytype, m);
+        std::array<std::vector<double>, 2> q;
+        {
+          nb::gil_scoped_release release;
+          q = quadrature::make_quadrature<double>(rule, celltype, polytype, m);
+        }
+        auto& [pts, w] = q;
         std::array shape{w.size(), pts.size() / w.size()};
         return std::pair(as_nbarray(std::move(pts), shape.size(), shape.data()),
                          as_nbarray(std::move(w)));
       });
 
+  nb::enum_<codegen::language>(m, "CodegenLanguage")
+      .value("C", codegen::language::C)
+      .value("CPP", codegen::language::CPP)
+      .def_prop_ro("name",
+                   [](nb::object obj) { return nb::getattr(obj, "__name__"); });
+
+  nb::enum_<codegen::transformation>(m, "DofTransformationType")
+      .value("pre_apply", codegen::transformation::pre_apply)
+      .value("pre_apply_transpose", codegen::transformation::pre_apply_transpose)
+      .value("pre_apply_inverse", codegen::transformation::pre_apply_inverse)
+      .value("pre_apply_inverse_transpose",
+             codegen::transformation::pre_apply_inverse_transpose)
+      .value("post_apply", codegen::transformation::post_apply)
+      .value("post_apply_transpose",
+             codegen::transformation::post_apply_transpose)
+      .value("post_apply_inverse", codegen::transformation::post_apply_inverse)
+      .value("post_apply_inverse_transpose",
+             codegen::transformation::post_apply_inverse_transpose)
+      .def_prop_ro("name",
+                   [](nb::object obj) { return nb::getattr(obj, "__name__"); });
+
+  m.def("codegen_preamble", &codegen::preamble);
+
+  m.def(
+      "c_api_function_address",
+      [](const std::string& name) -> std::uintptr_t
+      {
+        const std::array<std::pair<std::string, std::uintptr_t>, 7> functions
+            = {{{"basix_last_error",
+                 reinterpret_cast<std::uintptr_t>(&basix_last_error)},
+                {"basix_tabulate_float64",
+                 reinterpret_cast<std::uintptr_t>(&basix_tabulate_float64)},
+                {"basix_tabulate_float32",
+                 reinterpret_cast<std::uintptr_t>(&basix_tabulate_float32)},
+                {"basix_dof_transformation_float64",
+                 reinterpret_cast<std::uintptr_t>(
+                     &basix_dof_transformation_float64)},
+                {"basix_dof_transformation_float32",
+                 reinterpret_cast<std::uintptr_t>(
+                     &basix_dof_transformation_float32)},
+                {"basix_push_forward_float64",
+                 reinterpret_cast<std::uintptr_t>(&basix_push_forward_float64)},
+                {"basix_push_forward_float32",
+                 reinterpret_cast<std::uintptr_t>(
+                     &basix_push_forward_float32)}}};
+        for (auto& [n, address] : functions)
+        {
+          if (n == name)
+            return address;
+        }
+        throw std::runtime_error("Unknown function: " + name);
+      },
+      "name"_a);
+
   m.def("index", nb::overload_cast<int>(&basix::indexing::idx));
   m.def("index", nb::overload_cast<int, int>(&basix::indexing::idx));
   m.def("index", nb::overload_cast<int, int, int>(&basix::indexing::idx));
@@ -0,0 +1,308 @@
+// Copyright (c) 2024 Basix contributors
+// FEniCS Project
+// SPDX-License-Identifier:    MIT
+
+// Count the heap allocations made by the functions of Basix that are
+// called at runtime, with the output arrays provided by the caller.
+//
+// The DOF transformations, DOF permutations and push forward/pull back
+// must not allocate. Tabulation allocates a small workspace, whose
+// number of allocations must not depend on the number of points or
+// cells. The test fails if any function makes more allocations than
+// its budget.
+
+#include <basix/cell.h>
+#include <basix/finite-element.h>
+#include <basix/maps.h>
+#include <basix/stats.h>
+#include <bench-elements.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace basix;
+using namespace basix::bench;
+
+//-----------------------------------------------------------------------------
+// Replacements of the global allocation functions that count the number
+// of allocations made while counting is switched on
+namespace
+{
+std::atomic<bool> counting = false;
+std::atomic<std::size_t> num_allocations = 0;
+} // namespace
+
+void* operator new(std::size_t size)
+{
+  if (counting.load(std::memory_order_relaxed))
+    ++num_allocations;
+  if (void* p = std::malloc(size == 0 ? 1 : size))
+    return p;
+  throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void* operator new[](std::size_t size) { return ::operator new(size); }
+void operator delete[](void* p) noexcept { ::operator delete(p); }
+void operator delete(void* p, std::size_t) noexcept { ::operator delete(p); }
+void operator delete[](void* p, std::size_t) noexcept { ::operator delete(p); }
+//-----------------------------------------------------------------------------
+
+namespace
+{
+template <typename T, std::size_t d>
+using mdspan_t = MDSPAN_IMPL_STANDARD_NAMESPACE::mdspan<
+    T, MDSPAN_IMPL_STANDARD_NAMESPACE::dextents<std::size_t, d>>;
+
+using T = double;
+
+/// Number of allocations that the workspace of tabulate and of
+/// tabulate_batch (on one thread) may make. Both allocate three work
+/// arrays: the table of the polyset at the points, the coefficients of
+/// one value component and the product of the two. The macro polyset
+/// of an iso element on an interval, quadrilateral or hexahedron
+/// allocates one more array, of factorials, when it is tabulated.
+constexpr std::size_t tabulate_budget = 4;
+
+int num_failures = 0;
+
+//-----------------------------------------------------------------------------
+/// Count the allocations made by a call to f
+template <typename Fn>
+std::size_t count_allocations(Fn f)
+{
+  num_allocations = 0;
+  counting = true;
+  f();
+  counting = false;
+  return num_allocations;
+}
+//-----------------------------------------------------------------------------
+/// Report a failure if count is greater than budget
+void check(const std::string& name, std::size_t count, std::size_t budget)
+{
+  if (count > budget)
+  {
+    std::cerr << "FAILED: " << name << " made " << count
+              << " allocations (budget " << budget << ")\n";
+    ++num_failures;
+  }
+}
+//-----------------------------------------------------------------------------
+/// Report a failure if the numbers of allocations made for different
+/// problem sizes are not the same
+void check_constant(const std::string& name,
+                    const std::vector<std::size_t>& counts)
+{
+  if (std::ranges::adjacent_find(counts, std::not_equal_to{}) != counts.end())
+  {
+    std::cerr << "FAILED: " << name
+              << " made a number of allocations that depends on the problem "
+                 "size\n";
+    ++num_failures;
+  }
+}
+//-----------------------------------------------------------------------------
+/// Points in the reference cell, with shape (num_points, tdim)
+std::vector<T> random_points(std::size_t num_points, std::size_t tdim,
+                             std::mt19937& gen)
+{
+  // Points in [0, 1/tdim]^tdim are inside all reference cells
+  std::uniform_real_distribution<T> dist(0.0, 1.0 / tdim);
+  std::vector<T> x(num_points * tdim);
+  for (T& v : x)
+    v = dist(gen);
+  return x;
+}
+//-----------------------------------------------------------------------------
+void test_tabulate(const FiniteElement<T>& e, const std::string& name,
+                   std::mt19937& gen)
+{
+  const std::size_t tdim = cell::topological_dimension(e.cell_type());
+  std::vector<std::size_t> counts;
+  for (std::size_t num_points : {1, 20})
+  {
+    std::vector<T> x = random_points(num_points, tdim, gen);
+    std::array<std::size_t, 4> shape = e.tabulate_shape(1, num_points);
+    std::vector<T> basis(shape[0] * shape[1] * shape[2] * shape[3]);
+    std::size_t n = count_allocations(
+        [&]()
+        {
+          e.tabulate(1, mdspan_t<const T, 2>(x.data(), num_points, tdim),
+                     mdspan_t<T, 4>(basis.data(), shape));
+        });
+    check(name + " tabulate (" + std::to_string(num_points) + " points)", n,
+          tabulate_budget);
+    counts.push_back(n);
+  }
+  check_constant(name + " tabulate", counts);
+
+  counts.clear();
+  for (std::size_t num_cells : {1, 20})
+  {
+    const std::size_t points_per_cell = 4;
+    std::vector<T> x = random_points(num_cells * points_per_cell, tdim, gen);
+    std::vector<std::size_t> offsets(num_cells + 1);
+    for (std::size_t c = 0; c <= num_cells; ++c)
+      offsets[c] = c * points_per_cell;
+    std::array<std::size_t, 4> shape
+        = e.tabulate_shape(1, num_cells * points_per_cell);
+    std::vector<T> basis(shape[0] * shape[1] * shape[2] * shape[3]);
+    std::size_t n = count_allocations(
+        [&]()
+        {
+          e.tabulate_batch(
+              1, mdspan_t<const T, 2>(x.data(), x.size() / tdim, tdim),
+              offsets, basis, 1);
+        });
+    check(name + " tabulate_batch (" + std::to_string(num_cells) + " cells)",
+          n, tabulate_budget);
+    counts.push_back(n);
+  }
+  check_constant(name + " tabulate_batch", counts);
+}
+//-----------------------------------------------------------------------------
+void test_dof_transformations(const FiniteElement<T>& e,
+                              const std::string& name, std::mt19937& gen)
+{
+  const int block_size = 3;
+  std::vector<T> data(e.dim() * block_size);
+  std::vector<std::int32_t> dofs(e.dim());
+  std::iota(dofs.begin(), dofs.end(), 0);
+  std::uniform_int_distribution<std::uint32_t> dist;
+  const std::uint32_t cell_info = dist(gen);
+
+  std::size_t n = count_allocations(
+      [&]()
+      {
+        std::span<T> d(data);
+        e.pre_apply_dof_transformation(d, block_size, cell_info);
+        e.pre_apply_transpose_dof_transformation(d, block_size, cell_info);
+        e.pre_apply_inverse_dof_transformation(d, block_size, cell_info);
+        e.pre_apply_inverse_transpose_dof_transformation(d, block_size,
+                                                         cell_info);
+        e.post_apply_dof_transformation(d, block_size, cell_info);
+        e.post_apply_transpose_dof_transformation(d, block_size, cell_info);
+        e.post_apply_inverse_dof_transformation(d, block_size, cell_info);
+        e.post_apply_inverse_transpose_dof_transformation(d, block_size,
+                                                          cell_info);
+      });
+  check(name + " DOF transformations", n, 0);
+
+  if (e.dof_transformations_are_permutations())
+  {
+    n = count_allocations(
+        [&]()
+        {
+          e.permute_dofs(dofs, cell_info);
+          e.unpermute_dofs(dofs, cell_info);
+        });
+    check(name + " DOF permutations", n, 0);
+  }
+}
+//-----------------------------------------------------------------------------
+void test_maps(const FiniteElement<T>& e, const std::string& name)
+{
+  const std::size_t tdim = cell::topological_dimension(e.cell_type());
+  const std::size_t gdim = tdim;
+  const std::size_t num_points = 5;
+  const std::size_t nfunctions = e.dim();
+  const std::vector<std::size_t>& vshape = e.value_shape();
+  const std::size_t vs = std::accumulate(vshape.begin(), vshape.end(), 1,
+                                         std::multiplies{});
+  const std::size_t pvs = maps::physical_value_size(e.map_type(), vs, gdim);
+
+  // The identity as the Jacobian of each point
+  std::vector<T> J(num_points * gdim * tdim, 0.0);
+  for (std::size_t p = 0; p < num_points; ++p)
+    for (std::size_t i = 0; i < tdim; ++i)
+      J[p * gdim * tdim + i * tdim + i] = 1.0;
+  std::vector<T> detJ(num_points, 1.0);
+  std::vector<T> K = J;
+
+  std::vector<T> U(num_points * nfunctions * vs, 1.0);
+  std::vector<T> u(num_points * nfunctions * pvs);
+  std::size_t n = count_allocations(
+      [&]()
+      {
+        e.push_forward(
+            mdspan_t<const T, 3>(U.data(), num_points, nfunctions, vs),
+            mdspan_t<const T, 3>(J.data(), num_points, gdim, tdim), detJ,
+            mdspan_t<const T, 3>(K.data(), num_points, tdim, gdim),
+            mdspan_t<T, 3>(u.data(), num_points, nfunctions, pvs));
+        e.pull_back(mdspan_t<const T, 3>(u.data(), num_points, nfunctions, pvs),
+                    mdspan_t<const T, 3>(J.data(), num_points, gdim, tdim),
+                    detJ,
+                    mdspan_t<const T, 3>(K.data(), num_points, tdim, gdim),
+                    mdspan_t<T, 3>(U.data(), num_points, nfunctions, vs));
+      });
+  check(name + " push_forward and pull_back", n, 0);
+}
+//-----------------------------------------------------------------------------
+} // namespace
+
+int main()
+{
+  std::mt19937 gen(42);
+  int num_elements = 0;
+  for (bool collect_stats : {false, true})
+  {
+    stats::set_enabled(collect_stats);
+    for (const family_info& f : all_families)
+    {
+      for (auto& [cell, cell_name] : all_cells)
+      {
+        for (int degree = 1; degree <= 3; ++degree)
+        {
+          std::optional<FiniteElement<T>> e;
+          try
+          {
+            e = create_element<T>(f.family, cell, degree, f.lvariant,
+                                  f.dvariant, f.family == element::family::DPC);
+          }
+          catch (const std::exception&)
+          {
+            continue;
+          }
+
+          // When statistics are collected, the first tabulation of an
+          // element on a thread allocates its counters, so the element
+          // is tabulated once before allocations are counted
+          if (collect_stats)
+          {
+            const std::size_t tdim = cell::topological_dimension(cell);
+            std::vector<T> x(tdim, 0.1);
+            e->tabulate(0, std::span<const T>(x), {1, tdim});
+          }
+
+          const std::string name
+              = f.name + " " + cell_name + " degree " + std::to_string(degree)
+                + (collect_stats ? " (with statistics)" : "");
+          test_tabulate(*e, name, gen);
+          test_dof_transformations(*e, name, gen);
+          test_maps(*e, name);
+          ++num_elements;
+        }
+      }
+    }
+  }
+  stats::set_enabled(false);
+
+  if (num_failures > 0)
+  {
+    std::cerr << num_failures << " checks failed\n";
+    return 1;
+  }
+  std::cout << "Checked the allocations of " << num_elements
+            << " elements\n";
+  return 0;
+}
@@ -0,0 +1,97 @@
+# Copyright (c) 2024 Basix contributors
+# FEniCS Project
+# SPDX-License-Identifier: MIT
+
+import random
+
+import numpy as np
+import pytest
+
+import basix
+import basix.c_api
+from basix.codegen import DofTransformationType
+
+
+@pytest.mark.parametrize("dtype", [np.float32, np.float64])
+@pytest.mark.parametrize("cell", [basix.CellType.triangle, basix.CellType.hexahedron])
+def test_tabulate(cell, dtype):
+    e = basix.create_element(basix.ElementFamily.N1E, cell, 2, basix.LagrangeVariant.gll_warped, dtype=dtype)
+    points = basix.create_lattice(cell, 3, basix.LatticeType.equispaced, True).astype(dtype)
+    expected = e.tabulate(1, points)
+
+    if dtype == np.float32:
+        tabulate, handle = basix.c_api.tabulate_float32, e.handle_float32
+    else:
+        tabulate, handle = basix.c_api.tabulate_float64, e.handle_float64
+    basis = np.zeros_like(expected)
+    assert tabulate(handle, 1, points.ctypes.data, points.shape[0], basis.ctypes.data) == 0
+    assert np.allclose(basis, expected)
+
+
+@pytest.mark.parametrize("kind", list(DofTransformationType))
+def test_dof_transformation(kind):
+    e = basix.create_element(basix.ElementFamily.N1E, basix.CellType.tetrahedron, 2, basix.LagrangeVariant.gll_warped)
+    block_size = 3
+    cell_info = random.randrange(2 ** 30)
+    data = np.random.rand(e.dim * block_size)
+
+    result = data.copy()
+    assert basix.c_api.dof_transformation_float64(
+        e.handle_float64, int(kind.value), result.ctypes.data, block_size, cell_info) == 0
+    getattr(e, f"{kind.name}_dof_transformation")(data, block_size, cell_info)
+    assert np.allclose(result, data)
+
+
+def test_push_forward():
+    e = basix.create_element(basix.ElementFamily.RT, basix.CellType.triangle, 2, basix.LagrangeVariant.gll_warped)
+    npoints = 4
+    U = np.random.rand(npoints, e.dim, 2)
+    J = np.random.rand(npoints, 2, 2) + 2 * np.eye(2)
+    detJ = np.linalg.det(J)
+    K = np.linalg.inv(J)
+    expected = e.push_forward(U, J, detJ, K)
+
+    u = np.zeros_like(expected)
+    assert basix.c_api.push_forward_float64(e.handle_float64, U.ctypes.data, J.ctypes.data, detJ.ctypes.data,
+                                            K.ctypes.data, npoints, e.dim, 2, u.ctypes.data) == 0
+    assert np.allclose(u, expected)
+
+
+def test_error():
+    e = basix.create_element(basix.ElementFamily.P, basix.CellType.triangle, 1)
+    data = np.zeros(e.dim)
+    assert basix.c_api.dof_transformation_float64(e.handle_float64, 100, data.ctypes.data, 1, 0) != 0
+    assert basix.c_api.last_error() == "Unsupported transformation"
+
+    assert basix.c_api.dof_transformation_float64(0, 0, data.ctypes.data, 1, 0) != 0
+    assert basix.c_api.last_error() == "Element handle is null."
+
+
+def test_handle_dtype():
+    e = basix.create_element(basix.ElementFamily.P, basix.CellType.triangle, 1, dtype=np.float32)
+    assert e.handle_float32 != 0
+    with pytest.raises(ValueError):
+        e.handle_float64
+
+    e = basix.create_element(basix.ElementFamily.P, basix.CellType.triangle, 1)
+    assert e.handle_float64 != 0
+    with pytest.raises(ValueError):
+        e.handle_float32
+
+
+def test_numba():
+    numba = pytest.importorskip("numba")
+
+    e = basix.create_element(basix.ElementFamily.P, basix.CellType.triangle, 3, basix.LagrangeVariant.gll_warped)
+    tabulate = basix.c_api.tabulate_float64
+    handle = e.handle_float64
+
+    @numba.njit
+    def tabulate_points(x, basis):
+        for p in range(x.shape[0]):
+            tabulate(handle, 0, x[p:].ctypes, 1, basis[p:].ctypes)
+
+    points = basix.create_lattice(basix.CellType.triangle, 4, basix.LatticeType.equispaced, True)
+    basis = np.zeros((points.shape[0], e.dim))
+    tabulate_points(points, basis)
+    assert np.allclose(basis, e.tabulate(0, points)[0, :, :, 0])
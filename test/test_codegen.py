@@ -0,0 +1,121 @@
+# Copyright (c) 2024 Basix contributors
+# FEniCS Project
+# SPDX-License-Identifier: MIT
+
+import ctypes
+import random
+import shutil
+import subprocess
+
+import numpy as np
+import pytest
+
+import basix
+from basix.codegen import CodegenLanguage, DofTransformationType
+
+
+def test_tabulate():
+    e = basix.create_element(basix.ElementFamily.N1E, basix.CellType.triangle, 2)
+    pts = basix.create_lattice(basix.CellType.triangle, 3, basix.LatticeType.equispaced, True)
+    code = basix.codegen.tabulate(e, 1, pts, "table")
+
+    assert code.count("static const double table[3][10][8][2]") == 1
+    values = code.split("=", 1)[1]
+    for c in "{};":
+        values = values.replace(c, " ")
+    values = np.array([float(v) for v in values.replace(",", " ").split()])
+    assert np.allclose(values, e.tabulate(1, pts).flatten())
+
+
+@pytest.mark.parametrize("language", [CodegenLanguage.C, CodegenLanguage.CPP])
+def test_identity(language):
+    e = basix.create_element(basix.ElementFamily.P, basix.CellType.tetrahedron, 1)
+    code = basix.codegen.dof_transformation(e, "transform", language=language)
+    assert "cell_info >>" not in code
+
+
+def compile_kernels(tmp_path, code):
+    compiler = shutil.which("cc")
+    if compiler is None:
+        pytest.skip("A C compiler must be installed to run this test.")
+
+    source = tmp_path / "transform.c"
+    library = tmp_path / "transform.so"
+    source.write_text(code)
+    subprocess.run([compiler, "-std=c99", "-shared", "-fPIC", "-O1", str(source), "-o", str(library)], check=True)
+    return ctypes.CDLL(str(library))
+
+
+def call(kernel, data, block_size, cell_info):
+    c_type = ctypes.c_float if data.dtype == np.float32 else ctypes.c_double
+    kernel.argtypes = [ctypes.POINTER(c_type), ctypes.c_int, ctypes.c_uint32]
+    kernel.restype = None
+    kernel(data.ctypes.data_as(ctypes.POINTER(c_type)), block_size, cell_info)
+
+
+@pytest.mark.parametrize("cell, element, degree, element_args", [
+    (basix.CellType.triangle, basix.ElementFamily.P, 4, [basix.LagrangeVariant.gll_warped]),
+    (basix.CellType.tetrahedron, basix.ElementFamily.N1E, 3, []),
+    (basix.CellType.hexahedron, basix.ElementFamily.RT, 2, []),
+    (basix.CellType.prism, basix.ElementFamily.P, 3, [basix.LagrangeVariant.gll_warped]),
+])
+@pytest.mark.parametrize("kind", DofTransformationType)
+@pytest.mark.parametrize("block_size", [1, 3])
+@pytest.mark.parametrize("dtype", [np.float32, np.float64])
+def test_dof_transformation(tmp_path, cell, element, degree, element_args, kind, block_size, dtype):
+    e = basix.create_element(element, cell, degree, *element_args, dtype=dtype)
+    lib = compile_kernels(tmp_path, basix.codegen.preamble() + basix.codegen.dof_transformation(e, "transform", kind))
+
+    apply = getattr(e, f"{kind.name}_dof_transformation")
+    tol = 1e-5 if dtype == np.float32 else 1e-12
+    for _ in range(10):
+        cell_info = random.randrange(2 ** 30)
+        data = np.random.rand(e.dim * block_size).astype(dtype)
+        generated = data.copy()
+        apply(data, block_size, cell_info)
+        call(lib.transform, generated, block_size, cell_info)
+        assert np.allclose(data, generated, rtol=tol, atol=tol)
+
+
+def test_dof_transformation_double_precision(tmp_path):
+    # A custom degree 3 element on a triangle whose edge DOFs are moments
+    # against 1 and s + delta. Reversing an edge maps the second moment
+    # to (1 + 2 delta) times the first minus the second, so the kernel
+    # must keep coefficients that differ from 1 by less than the single
+    # precision epsilon.
+    delta = 1e-8
+    pts, wts = basix.make_quadrature(basix.CellType.interval, 6)
+    geometry = basix.geometry(basix.CellType.triangle)
+    x = [[geometry[v:v + 1] for v in range(3)], [], [np.array([[1 / 3, 1 / 3]])], []]
+    M = [[np.ones((1, 1, 1, 1)) for _ in range(3)], [], [np.ones((1, 1, 1, 1))], []]
+    for v0, v1 in basix.topology(basix.CellType.triangle)[1]:
+        x[1].append(geometry[v0] + pts * (geometry[v1] - geometry[v0]))
+        M[1].append(np.array([[wts], [wts * (pts[:, 0] + delta)]]).reshape(2, 1, -1, 1))
+    e = basix.create_custom_element(basix.CellType.triangle, [], np.eye(10), x, M, 0, basix.MapType.identity,
+                                    basix.SobolevSpace.H1, False, 3, 3, basix.PolysetType.standard)
+    code = basix.codegen.dof_transformation(e, "transform", DofTransformationType.pre_apply)
+    assert "w0 + w1" not in code
+    lib = compile_kernels(tmp_path, basix.codegen.preamble() + code)
+
+    for cell_info in range(1, 8):
+        data = np.random.rand(e.dim)
+        generated = data.copy()
+        e.pre_apply_dof_transformation(data, 1, cell_info)
+        call(lib.transform, generated, 1, cell_info)
+        assert np.allclose(data, generated, rtol=1e-14, atol=1e-14)
+
+
+def test_static_element_tables():
+    e = basix.create_element(basix.ElementFamily.N1E, basix.CellType.tetrahedron, 2, basix.LagrangeVariant.legendre)
+    code = basix.codegen.static_element_tables(e, "tables")
+    assert "basix::cell::type::tetrahedron, basix::element::family::N1E, 2," in code
+    assert "basix::element::lagrange_variant::legendre, double>::tables" in code
+
+    # The first list holds the coefficients of the basis functions
+    values = code.split("tables = {{", 1)[1].split("}", 1)[0]
+    values = np.array([float(v) for v in values.replace(",", " ").split()])
+    assert np.allclose(values, e.coefficient_matrix.flatten())
+
+    with pytest.raises(RuntimeError):
+        basix.codegen.static_element_tables(
+            basix.create_element(basix.ElementFamily.BDM, basix.CellType.triangle, 1), "tables")
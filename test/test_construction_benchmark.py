@@ -0,0 +1,40 @@
+import numpy as np
+import pytest
+
+import basix
+import basix.benchmark
+
+
+@pytest.mark.parametrize("dtype", [np.float32, np.float64])
+def test_construction_times(dtype):
+    basix.stats.enable()
+    try:
+        e = basix.create_element(basix.ElementFamily.N1E, basix.CellType.tetrahedron, 2,
+                                 basix.LagrangeVariant.legendre, dtype=dtype)
+    finally:
+        basix.stats.disable()
+    assert [name for name, _ in e.construction_times] == basix.benchmark.stages
+    assert all(t >= 0.0 for _, t in e.construction_times)
+
+
+def test_construction_times_disabled():
+    assert not basix.stats.enabled()
+    e = basix.create_element(basix.ElementFamily.N1E, basix.CellType.tetrahedron, 2, basix.LagrangeVariant.legendre)
+    assert e.construction_times == []
+
+
+def test_construction_benchmark():
+    rows = basix.benchmark.construction_benchmark([basix.ElementFamily.serendipity], [basix.CellType.hexahedron], 3)
+    assert [r["degree"] for r in rows] == [1, 2, 3]
+    for r in rows:
+        assert r["family"] == "serendipity" and r["cell"] == "hexahedron"
+        assert r["footprint_bytes"] > 0
+        stage_sum = sum(r[f"{s}_s"] for s in basix.benchmark.stages)
+        assert np.isclose(r["definition_s"] + stage_sum, r["total_s"])
+
+
+def test_main(capsys):
+    assert basix.benchmark.main(["--family", "P", "--cell", "triangle", "--max-degree", "2"]) == 0
+    lines = capsys.readouterr().out.strip().split("\n")
+    assert lines[0].startswith("family,cell,degree,dim,total_s")
+    assert len(lines) == 3
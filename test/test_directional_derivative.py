@@ -0,0 +1,45 @@
+# Copyright (c) 2024 Basix contributors
+# FEniCS Project
+# SPDX-License-Identifier: MIT
+
+import numpy as np
+import pytest
+
+import basix
+
+
+@pytest.mark.parametrize("cell, family, degree, element_args", [
+    (basix.CellType.interval, basix.ElementFamily.P, 3, [basix.LagrangeVariant.gll_warped]),
+    (basix.CellType.triangle, basix.ElementFamily.P, 3, [basix.LagrangeVariant.gll_warped]),
+    (basix.CellType.quadrilateral, basix.ElementFamily.RT, 2, [basix.LagrangeVariant.legendre]),
+    (basix.CellType.tetrahedron, basix.ElementFamily.N1E, 2, [basix.LagrangeVariant.legendre]),
+    (basix.CellType.pyramid, basix.ElementFamily.P, 2, [basix.LagrangeVariant.equispaced]),
+])
+@pytest.mark.parametrize("dtype", [np.float32, np.float64])
+def test_directional_derivative(cell, family, degree, element_args, dtype):
+    e = basix.create_element(family, cell, degree, *element_args, dtype=dtype)
+    tdim = len(basix.topology(cell)) - 1
+    x = (np.random.rand(6, tdim) / tdim).astype(dtype)
+    b = (np.random.rand(3, 6, tdim) - 0.5).astype(dtype)
+
+    grad = e.tabulate(1, x)[1:]
+    expected = np.einsum("cpd,dpiv->cpiv", b, grad)
+    tol = 1e-4 if dtype == np.float32 else 1e-10
+
+    tab = e.tabulate_directional_derivative(x, b)
+    assert tab.shape == expected.shape
+    assert np.allclose(tab, expected, atol=tol)
+
+    tab = e.tabulate_directional_derivative(x, b[1])
+    assert np.allclose(tab, expected[1], atol=tol)
+
+    out = np.zeros(expected.shape[1:], dtype=dtype)
+    e.tabulate_directional_derivative(x, b[2], out)
+    assert np.allclose(out, expected[2], atol=tol)
+
+
+def test_directional_derivative_invalid():
+    e = basix.create_element(basix.ElementFamily.P, basix.CellType.triangle, 1)
+    x = np.random.rand(4, 2) / 2
+    with pytest.raises(RuntimeError):
+        e.tabulate_directional_derivative(x, np.ones((3, 2)))
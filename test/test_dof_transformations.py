@@ -50,12 +50,12 @@ def test_post_apply(cell_type, element_type, degree, element_args):
     for i in range(10):
         cell_info = random.randrange(2**30)
 
-        data1 = np.array(list(range(size**2)), dtype=np.float32)
+        data1 = np.array(list(range(size**2)), dtype=np.float64)
         e.pre_apply_dof_transformation(data1, size, cell_info)
         data1 = data1.reshape((size, size))
 
         # This is the transpose of the data used above
-        data2 = np.array([size * j + i for i in range(size) for j in range(size)], dtype=np.float32)
+        data2 = np.array([size * j + i for i in range(size) for j in range(size)], dtype=np.float64)
         e.post_apply_transpose_dof_transformation(data2, size, cell_info)
         data2 = data2.reshape((size, size))
 
@@ -465,3 +465,56 @@ def test_transformation_of_tabulated_data_pyramid(element_type, degree, element_
                 j_slice = j[:, d]
                 assert np.allclose((bt[9].dot(i_slice))[start: start + ndofs],
                                    j_slice[start: start + ndofs])
+
+
+@pytest.mark.parametrize("cell_type, element_type, degree, element_args", [
+    (basix.CellType.tetrahedron, basix.ElementFamily.N1E, 2, []),
+    (basix.CellType.hexahedron, basix.ElementFamily.P, 3, [basix.LagrangeVariant.gll_warped]),
+])
+@pytest.mark.parametrize("name", [
+    "pre_apply_dof_transformation", "pre_apply_transpose_dof_transformation",
+    "pre_apply_inverse_dof_transformation", "pre_apply_inverse_transpose_dof_transformation",
+    "post_apply_dof_transformation", "post_apply_transpose_dof_transformation",
+    "post_apply_inverse_dof_transformation", "post_apply_inverse_transpose_dof_transformation"])
+def test_batched_transformation(cell_type, element_type, degree, element_args, name):
+    e = basix.create_element(element_type, cell_type, degree, *element_args)
+    ncells = 20
+    block_size = 2
+    cell_info = np.array([random.randrange(2 ** 30) for _ in range(ncells)], dtype=np.uint32)
+    data = np.random.rand(ncells, e.dim * block_size)
+
+    batched = data.copy()
+    getattr(e, name)(batched, block_size, cell_info)
+    for c in range(ncells):
+        getattr(e, name)(data[c], block_size, int(cell_info[c]))
+    assert np.allclose(batched, data)
+
+
+def test_batched_permutation():
+    e = basix.create_element(basix.ElementFamily.P, basix.CellType.tetrahedron, 4, basix.LagrangeVariant.equispaced)
+    ncells = 20
+    cell_info = np.array([random.randrange(2 ** 30) for _ in range(ncells)], dtype=np.uint32)
+    dofs = np.tile(np.arange(e.dim, dtype=np.int32), (ncells, 1))
+
+    permuted = dofs.copy()
+    e.permute_dofs(permuted, cell_info)
+    for c in range(ncells):
+        e.permute_dofs(dofs[c], int(cell_info[c]))
+    assert np.array_equal(permuted, dofs)
+
+    e.unpermute_dofs(permuted, cell_info)
+    assert np.array_equal(permuted, np.tile(np.arange(e.dim, dtype=np.int32), (ncells, 1)))
+
+
+def test_batched_wrong_row_length():
+    e = basix.create_element(basix.ElementFamily.N1E, basix.CellType.tetrahedron, 2, basix.LagrangeVariant.legendre)
+    ncells = 3
+    cell_info = np.zeros(ncells, dtype=np.uint32)
+
+    data = np.zeros((ncells, e.dim * 2 + 1))
+    with pytest.raises(RuntimeError):
+        e.pre_apply_dof_transformation(data, 2, cell_info)
+
+    dofs = np.zeros((ncells, e.dim + 1), dtype=np.int32)
+    with pytest.raises(RuntimeError):
+        e.permute_dofs(dofs, cell_info)
@@ -0,0 +1,54 @@
+import gc
+
+import numpy as np
+import pytest
+
+import basix
+
+
+def create_element():
+    return basix.create_element(basix.ElementFamily.N1E, basix.CellType.tetrahedron, 2,
+                                basix.LagrangeVariant.gll_warped)
+
+
+@pytest.mark.parametrize("name", ["points", "interpolation_matrix", "dual_matrix", "coefficient_matrix", "wcoeffs"])
+def test_matrix_views(name):
+    e = create_element()
+    a = getattr(e, name)
+    assert np.shares_memory(a, getattr(e, name))
+    assert not a.flags.writeable
+    with pytest.raises(ValueError):
+        a[0, 0] = 1.0
+
+    b = np.from_dlpack(a)
+    assert np.shares_memory(a, b)
+
+
+def test_entity_views():
+    e = create_element()
+    for key, t in e.entity_transformations().items():
+        assert np.shares_memory(t, e.entity_transformations()[key])
+        assert not t.flags.writeable
+    for M0, M1 in zip(e.M, e.M):
+        for a, b in zip(M0, M1):
+            assert np.shares_memory(a, b)
+    for x0, x1 in zip(e.x, e.x):
+        for a, b in zip(x0, x1):
+            assert np.shares_memory(a, b)
+
+
+def test_views_keep_element_alive():
+    e = create_element()
+    expected = e.coefficient_matrix.copy()
+    expected_t = {key: t.copy() for key, t in e.entity_transformations().items()}
+    c = e.coefficient_matrix
+    t = e.entity_transformations()
+    x = e.x
+    del e
+    gc.collect()
+
+    create_element()
+    assert np.allclose(c, expected)
+    for key, value in expected_t.items():
+        assert np.allclose(t[key], value)
+    assert x[1][0].shape[1] == 3
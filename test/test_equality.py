@@ -151,3 +151,14 @@ def test_nonequal_custom(p1_custom, cr_custom, cr, p1):
     assert p1_custom != cr
     assert p1_custom != p1
     assert cr_custom != cr
+
+
+def test_fingerprint(p1, p1_again, p1_quad, p4_gll, p4_equi, p1_custom, p1_custom_again, cr_custom):
+    assert p1.fingerprint == p1_again.fingerprint
+    assert p1_custom.fingerprint == p1_custom_again.fingerprint
+    assert len({p1.fingerprint, p1_quad.fingerprint, p4_gll.fingerprint, p4_equi.fingerprint,
+                p1_custom.fingerprint, cr_custom.fingerprint}) == 6
+
+
+def test_fingerprint_dtype(p1_f64, p1_f32):
+    assert p1_f64.fingerprint != p1_f32.fingerprint
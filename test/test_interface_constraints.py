@@ -0,0 +1,152 @@
+# Copyright (c) 2024 Basix contributors
+# FEniCS Project
+# SPDX-License-Identifier: MIT
+
+import numpy as np
+import pytest
+
+import basix
+
+
+def constrained_dofs(coarse, fine, constraint, u_coarse):
+    """Compute DOFs of the fine element that satisfy a constraint."""
+    u_fine = np.random.rand(fine.dim)
+    for i, dof in enumerate(constraint.dofs):
+        r = slice(constraint.offsets[i], constraint.offsets[i + 1])
+        u_fine[dof] = constraint.values[r] @ u_coarse[constraint.columns[r]]
+    return u_fine
+
+
+@pytest.mark.parametrize("cell, coarse_degree, fine_degree, subfacet, orientation", [
+    (basix.CellType.triangle, 2, 2, 0, 0),
+    (basix.CellType.triangle, 2, 3, 1, 0),
+    (basix.CellType.triangle, 2, 4, -1, 0),
+    (basix.CellType.triangle, 3, 3, 1, 1),
+    (basix.CellType.quadrilateral, 2, 3, 0, 1),
+])
+def test_interval_facet(cell, coarse_degree, fine_degree, subfacet, orientation):
+    coarse = basix.create_element(basix.ElementFamily.P, cell, coarse_degree, basix.LagrangeVariant.gll_warped)
+    fine = basix.create_element(basix.ElementFamily.P, cell, fine_degree, basix.LagrangeVariant.gll_warped)
+    c = basix.compute_interface_constraint(coarse, 0, fine, 0, subfacet, orientation)
+    assert len(c.offsets) == len(c.dofs) + 1
+
+    u_coarse = np.random.rand(coarse.dim)
+    u_fine = constrained_dofs(coarse, fine, c, u_coarse)
+
+    # Points on facet 0 of the fine cell, and the same points on the
+    # facet of the coarse cell
+    v = basix.geometry(cell)[basix.topology(cell)[1][0]]
+    tau = np.linspace(0, 1, 7)
+    s = 1 - tau if orientation == 1 else tau
+    if subfacet != -1:
+        s = (subfacet + s) / 2
+    x_fine = v[0] + tau[:, None] * (v[1] - v[0])
+    x_coarse = v[0] + s[:, None] * (v[1] - v[0])
+
+    values_fine = fine.tabulate(0, x_fine)[0, :, :, 0] @ u_fine
+    values_coarse = coarse.tabulate(0, x_coarse)[0, :, :, 0] @ u_coarse
+    assert np.allclose(values_fine, values_coarse)
+
+
+def facet_vertex_weights(facet_type, t):
+    """Compute the weights of the vertices of a facet at points in the facet."""
+    a, b = t[:, 0], t[:, 1]
+    if facet_type == basix.CellType.quadrilateral:
+        return np.stack([(1 - a) * (1 - b), a * (1 - b), (1 - a) * b, a * b], axis=1)
+    return np.stack([1 - a - b, a, b], axis=1)
+
+
+def subfacet_vertices(facet_type, subfacet):
+    """Compute the vertices of a sub-facet in the coordinates of the facet."""
+    v = basix.geometry(facet_type)
+    if subfacet == -1:
+        return v
+    if facet_type == basix.CellType.quadrilateral:
+        return (v + [subfacet % 2, subfacet // 2]) / 2
+    if subfacet == 3:
+        return (v[[1, 0, 0]] + v[[2, 2, 1]]) / 2
+    return (v + v[subfacet]) / 2
+
+
+def orientation_permutation(facet_type, orientation):
+    """Compute the vertex of the coarse (sub-)facet that each vertex of the fine facet is at."""
+    if facet_type == basix.CellType.quadrilateral:
+        rotation, reflection = [1, 3, 0, 2], [0, 2, 1, 3]
+    else:
+        rotation, reflection = [1, 2, 0], [0, 2, 1]
+    perm = list(range(len(rotation)))
+    for _ in range(orientation // 2):
+        perm = [rotation[i] for i in perm]
+    if orientation % 2 == 1:
+        perm = [reflection[i] for i in perm]
+    return perm
+
+
+@pytest.mark.parametrize("cell, facet_type, subfacet, orientation", [
+    (basix.CellType.hexahedron, basix.CellType.quadrilateral, s, o) for s in range(-1, 4) for o in range(8)
+] + [
+    (basix.CellType.tetrahedron, basix.CellType.triangle, s, o) for s in range(-1, 4) for o in range(6)
+])
+def test_hanging_face(cell, facet_type, subfacet, orientation):
+    coarse = basix.create_element(basix.ElementFamily.P, cell, 2, basix.LagrangeVariant.gll_warped)
+    fine = basix.create_element(basix.ElementFamily.P, cell, 3, basix.LagrangeVariant.gll_warped)
+    c = basix.compute_interface_constraint(coarse, 0, fine, 0, subfacet, orientation)
+    u_coarse = np.random.rand(coarse.dim)
+    u_fine = constrained_dofs(coarse, fine, c, u_coarse)
+
+    # Points on facet 0 of the fine cell, and the same points on the
+    # (sub-)facet of the coarse cell
+    v = basix.geometry(cell)[basix.topology(cell)[2][0]]
+    t = np.random.rand(10, 2)
+    if facet_type == basix.CellType.triangle:
+        t[t.sum(axis=1) > 1] = 1 - t[t.sum(axis=1) > 1]
+    sub = subfacet_vertices(facet_type, subfacet)[orientation_permutation(facet_type, orientation)]
+    w = facet_vertex_weights(facet_type, t)
+    x_fine = w @ v
+    x_coarse = w @ facet_vertex_weights(facet_type, sub) @ v
+
+    values_fine = fine.tabulate(0, x_fine)[0, :, :, 0] @ u_fine
+    values_coarse = coarse.tabulate(0, x_coarse)[0, :, :, 0] @ u_coarse
+    assert np.allclose(values_fine, values_coarse)
+
+
+def test_hanging_node():
+    e = basix.create_element(basix.ElementFamily.P, basix.CellType.triangle, 1)
+    c = basix.compute_interface_constraint(e, 0, e, 0, 0)
+    assert list(c.dofs) == [1, 2]
+    dense = np.zeros((2, 3))
+    for i in range(2):
+        dense[i, c.columns[c.offsets[i]:c.offsets[i + 1]]] = c.values[c.offsets[i]:c.offsets[i + 1]]
+    assert np.allclose(dense, [[0, 1, 0], [0, 0.5, 0.5]])
+
+
+@pytest.mark.parametrize("cell, num_constraints", [
+    (basix.CellType.interval, 4),
+    (basix.CellType.triangle, 54),
+    (basix.CellType.tetrahedron, 480),
+])
+def test_cached_constraints(cell, num_constraints):
+    coarse = basix.create_element(basix.ElementFamily.P, cell, 1)
+    fine = basix.create_element(basix.ElementFamily.P, cell, 2)
+    constraints = basix.InterfaceConstraints(coarse, fine)
+    assert len(constraints) == num_constraints
+
+    tdim = len(basix.topology(cell)) - 1
+    subfacet = -1 if tdim == 1 else 1
+    orientation = 1 if tdim > 1 else 0
+    c0 = constraints.constraint(0, tdim, subfacet, orientation)
+    c1 = basix.compute_interface_constraint(coarse, 0, fine, tdim, subfacet, orientation)
+    for a, b in zip(c0, c1):
+        assert np.allclose(a, b)
+
+
+def test_invalid():
+    e = basix.create_element(basix.ElementFamily.P, basix.CellType.triangle, 2)
+    with pytest.raises(RuntimeError):
+        basix.compute_interface_constraint(e, 0, e, 0, 4)
+    with pytest.raises(RuntimeError):
+        basix.compute_interface_constraint(e, 0, e, 0, 0, 2)
+
+    e = basix.create_element(basix.ElementFamily.N1E, basix.CellType.triangle, 1)
+    with pytest.raises(RuntimeError):
+        basix.compute_interface_constraint(e, 0, e, 0, 0)
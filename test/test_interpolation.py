@@ -56,3 +56,22 @@ def test_interpolation_is_identity(cell_type, degree, element_type, element_args
         assert element.interpolation_is_identity == np.allclose(i_m, np.eye(i_m.shape[0]))
     else:
         assert not element.interpolation_is_identity
+
+
+@pytest.mark.parametrize("degree", [1, 2, 3])
+@pytest.mark.parametrize("cell_type", [basix.CellType.triangle, basix.CellType.tetrahedron])
+@pytest.mark.parametrize("element_type, element_args", [
+    (basix.ElementFamily.N1E, [basix.LagrangeVariant.legendre]),
+    (basix.ElementFamily.RT, [basix.LagrangeVariant.legendre]),
+    (basix.ElementFamily.Regge, []),
+])
+def test_interpolation_matrix_after_clear_cache(cell_type, degree, element_type, element_args):
+    # The second element reuses the cached moments of the first, and the
+    # third recomputes them
+    cached = [basix.create_element(element_type, cell_type, degree, *element_args) for _ in range(2)]
+    basix.finite_element.clear_moment_cache()
+    element = basix.create_element(element_type, cell_type, degree, *element_args)
+
+    for e in cached:
+        assert np.allclose(e.points, element.points)
+        assert np.allclose(e.interpolation_matrix, element.interpolation_matrix)
@@ -45,6 +45,13 @@ def run_map_test(e, J, detJ, K, reference_value_size, physical_value_size):
     unmapped = e.pull_back(mapped, _J, _detJ, _K)
     assert np.allclose(values, unmapped)
 
+    out = np.empty_like(mapped)
+    assert e.push_forward(values, _J, _detJ, _K, out=out) is out
+    assert np.allclose(out, mapped)
+    out = np.empty_like(values)
+    assert e.pull_back(mapped, _J, _detJ, _K, out=out) is out
+    assert np.allclose(out, unmapped)
+
 
 @pytest.mark.parametrize("element_type, element_args", elements)
 def test_mappings_2d_to_2d(element_type, element_args):
@@ -86,3 +93,25 @@ def test_mappings_3d_to_3d(element_type, element_args):
     detJ = np.linalg.det(J)
     K = np.linalg.inv(J)
     run_map_test(e, J, detJ, K, e.value_size, e.value_size)
+
+
+def test_push_forward_wrong_shape():
+    e = basix.create_element(basix.ElementFamily.N1E, basix.CellType.triangle, 1, basix.LagrangeVariant.legendre)
+    J = np.array([[[1., 0.], [0., 1.]]])
+    detJ = np.array([1.])
+    values = e.tabulate(0, np.array([[0.2, 0.3]]))[0]
+    with pytest.raises(RuntimeError):
+        e.push_forward(values[:, :, :1].copy(), J, detJ, J)
+    with pytest.raises(RuntimeError):
+        e.push_forward(values, J, detJ, J, out=np.empty((1, e.dim, 3)))
+
+
+def test_pull_back_wrong_shape():
+    e = basix.create_element(basix.ElementFamily.N1E, basix.CellType.triangle, 1, basix.LagrangeVariant.legendre)
+    J = np.array([[[1., 0.], [0., 1.]]])
+    detJ = np.array([1.])
+    values = e.tabulate(0, np.array([[0.2, 0.3]]))[0]
+    with pytest.raises(RuntimeError):
+        e.pull_back(values, J, detJ, J, out=np.empty((1, e.dim, 3)))
+    with pytest.raises(RuntimeError):
+        e.pull_back(values[:, :, :1].copy(), J, detJ, J)
@@ -0,0 +1,227 @@
+# Copyright (c) 2024 Basix contributors
+# FEniCS Project
+# SPDX-License-Identifier: MIT
+
+import random
+
+import numpy as np
+import pytest
+
+import basix
+import basix.ufl
+
+from .utils import parametrize_over_elements
+
+transformations = [
+    "pre_apply_dof_transformation", "pre_apply_transpose_dof_transformation",
+    "pre_apply_inverse_dof_transformation", "pre_apply_inverse_transpose_dof_transformation",
+    "post_apply_dof_transformation", "post_apply_transpose_dof_transformation",
+    "post_apply_inverse_dof_transformation", "post_apply_inverse_transpose_dof_transformation"]
+
+
+def sub_elements(cell):
+    return [
+        basix.create_element(basix.ElementFamily.P, cell, 3, basix.LagrangeVariant.gll_warped),
+        basix.create_element(basix.ElementFamily.N1E, cell, 2, basix.LagrangeVariant.gll_warped),
+        basix.create_element(basix.ElementFamily.P, cell, 1),
+    ]
+
+
+@pytest.mark.parametrize("cell", [basix.CellType.triangle, basix.CellType.quadrilateral,
+                                  basix.CellType.tetrahedron, basix.CellType.hexahedron])
+def test_mixed_tabulate(cell):
+    elements = sub_elements(cell)
+    mixed = basix.create_mixed_element(elements)
+    assert mixed.dim == sum(e.dim for e in elements)
+    assert mixed.value_size == sum(e.value_size for e in elements)
+
+    points = basix.create_lattice(cell, 3, basix.LatticeType.equispaced, True)
+    tab = mixed.tabulate(1, points)
+    assert tab.shape == (points.shape[1] + 1, points.shape[0], mixed.dim, mixed.value_size)
+
+    expected = np.zeros_like(tab)
+    for i, e in enumerate(elements):
+        d0, d1 = mixed.dof_offsets[i], mixed.dof_offsets[i + 1]
+        v0, v1 = mixed.value_offsets[i], mixed.value_offsets[i + 1]
+        expected[:, :, d0:d1, v0:v1] = e.tabulate(1, points)
+    assert np.allclose(tab, expected)
+
+    out = np.empty_like(tab)
+    assert mixed.tabulate(1, points, out) is out
+    assert np.allclose(out, expected)
+
+
+def test_mixed_entity_dofs():
+    elements = sub_elements(basix.CellType.tetrahedron)
+    mixed = basix.create_mixed_element(elements)
+    for d, entities in enumerate(mixed.entity_dofs):
+        for n, dofs in enumerate(entities):
+            expected = []
+            for e, offset in zip(elements, mixed.dof_offsets):
+                expected += [offset + i for i in e.entity_dofs[d][n]]
+            assert dofs == expected
+
+
+@pytest.mark.parametrize("cell", [basix.CellType.tetrahedron, basix.CellType.hexahedron])
+@pytest.mark.parametrize("name", transformations)
+def test_mixed_transformation(cell, name):
+    elements = sub_elements(cell)
+    mixed = basix.create_mixed_element(elements)
+    block_size = 2
+    cell_info = random.randrange(2 ** 30)
+    data = np.random.rand(mixed.dim * block_size)
+
+    result = data.copy()
+    getattr(mixed, name)(result, block_size, cell_info)
+
+    if name.startswith("pre"):
+        for e, offset in zip(elements, mixed.dof_offsets):
+            getattr(e, name)(data[block_size * offset: block_size * (offset + e.dim)], block_size, cell_info)
+    else:
+        rows = data.reshape(block_size, mixed.dim)
+        for e, offset in zip(elements, mixed.dof_offsets):
+            sub_data = rows[:, offset: offset + e.dim].copy()
+            getattr(e, name)(sub_data.reshape(-1), block_size, cell_info)
+            rows[:, offset: offset + e.dim] = sub_data
+    assert np.allclose(result, data)
+
+
+@pytest.mark.parametrize("cell", [basix.CellType.interval, basix.CellType.triangle])
+def test_mixed_iso_tabulate(cell):
+    # The macro polysets are not ordered by degree, so sub-elements of
+    # different degrees cannot share a set
+    elements = [basix.create_element(basix.ElementFamily.iso, cell, degree, basix.LagrangeVariant.gll_warped)
+                for degree in [1, 2]]
+    mixed = basix.create_mixed_element(elements)
+    points = basix.create_lattice(cell, 4, basix.LatticeType.equispaced, True)
+    tab = mixed.tabulate(1, points)
+    for i, e in enumerate(elements):
+        d0, d1 = mixed.dof_offsets[i], mixed.dof_offsets[i + 1]
+        assert np.allclose(tab[:, :, d0:d1, i], e.tabulate(1, points)[:, :, :, 0])
+
+
+def test_mixed_different_cells():
+    with pytest.raises(RuntimeError):
+        basix.create_mixed_element([
+            basix.create_element(basix.ElementFamily.P, basix.CellType.triangle, 1),
+            basix.create_element(basix.ElementFamily.P, basix.CellType.quadrilateral, 1)])
+
+
+@pytest.mark.parametrize("cell", [basix.CellType.triangle, basix.CellType.quadrilateral,
+                                  basix.CellType.tetrahedron, basix.CellType.hexahedron])
+def test_mixed_interpolation(cell):
+    elements = sub_elements(cell)
+    mixed = basix.create_mixed_element(elements)
+    points = mixed.points
+    assert points.shape[0] < sum(e.points.shape[0] for e in elements)
+    assert mixed.interpolation_matrix.shape == (mixed.dim, mixed.value_size * points.shape[0])
+
+    for e, point_map in zip(elements, mixed.point_maps):
+        assert np.allclose(points[point_map], e.points)
+
+    def f(x):
+        return np.stack([np.sin(x[:, 0] + k) * np.exp(x[:, -1]) for k in range(mixed.value_size)], axis=1)
+
+    dofs = mixed.interpolation_matrix @ f(points).T.flatten()
+    for i, e in enumerate(elements):
+        v0, v1 = mixed.value_offsets[i], mixed.value_offsets[i + 1]
+        expected = e.interpolation_matrix @ f(e.points)[:, v0:v1].T.flatten()
+        assert np.allclose(dofs[mixed.dof_offsets[i]:mixed.dof_offsets[i + 1]], expected)
+
+
+@parametrize_over_elements(3)
+def test_blocked_tabulate(cell_type, element_type, degree, element_args):
+    e = basix.create_element(element_type, cell_type, degree, *element_args)
+    if e.value_size != 1:
+        pytest.skip("Blocked elements need a scalar sub-element.")
+    block_size = 3
+    blocked = basix.create_blocked_element(e, block_size)
+    assert blocked.dim == e.dim * block_size
+    assert blocked.value_size == block_size
+
+    points = basix.create_lattice(cell_type, 2, basix.LatticeType.equispaced, True)
+    tab = blocked.tabulate(1, points)
+    sub_tab = e.tabulate(1, points)
+    expected = np.zeros_like(tab)
+    for b in range(block_size):
+        expected[:, :, b::block_size, b] = sub_tab[:, :, :, 0]
+    assert np.allclose(tab, expected)
+
+
+@pytest.mark.parametrize("name", transformations)
+def test_blocked_transformation(name):
+    e = basix.create_element(basix.ElementFamily.P, basix.CellType.tetrahedron, 4, basix.LagrangeVariant.gll_warped)
+    block_size = 3
+    blocked = basix.create_blocked_element(e, block_size)
+    cell_info = random.randrange(2 ** 30)
+    nrows = 2
+    data = np.random.rand(blocked.dim * nrows)
+
+    result = data.copy()
+    getattr(blocked, name)(result, nrows, cell_info)
+
+    if name.startswith("pre"):
+        getattr(e, name)(data, nrows * block_size, cell_info)
+    else:
+        # Each row of data has the DOFs of the sub-element for each
+        # component interleaved
+        rows = data.reshape(nrows, e.dim, block_size).transpose((0, 2, 1)).copy()
+        getattr(e, name)(rows.reshape(-1), nrows * block_size, cell_info)
+        data = rows.transpose((0, 2, 1)).reshape(-1)
+    assert np.allclose(result, data)
+
+
+def test_blocked_permutation():
+    e = basix.create_element(basix.ElementFamily.P, basix.CellType.tetrahedron, 4, basix.LagrangeVariant.equispaced)
+    block_size = 2
+    blocked = basix.create_blocked_element(e, block_size)
+    cell_info = random.randrange(2 ** 30)
+
+    dofs = np.arange(blocked.dim, dtype=np.int32)
+    blocked.permute_dofs(dofs, cell_info)
+    sub_dofs = np.arange(e.dim, dtype=np.int32)
+    e.permute_dofs(sub_dofs, cell_info)
+    for b in range(block_size):
+        assert np.array_equal(dofs[b::block_size], sub_dofs * block_size + b)
+
+    blocked.unpermute_dofs(dofs, cell_info)
+    assert np.array_equal(dofs, np.arange(blocked.dim, dtype=np.int32))
+
+
+@pytest.mark.parametrize("sub_elements", [
+    [basix.ufl.element("Lagrange", "triangle", 2), basix.ufl.element("Lagrange", "triangle", 1)],
+    [basix.ufl.element("Lagrange", "triangle", 2, shape=(2, )), basix.ufl.element("Lagrange", "triangle", 1)],
+    [basix.ufl.element("N1curl", "triangle", 1), basix.ufl.element("Lagrange", "triangle", 3)],
+    [basix.ufl.element("N1curl", "triangle", 2), basix.ufl.element("Lagrange", "triangle", 1, shape=(2, )),
+     basix.ufl.element("Lagrange", "triangle", 2, shape=(3, ))],
+])
+def test_ufl_mixed_tabulate(sub_elements):
+    mixed = basix.ufl.mixed_element(sub_elements)
+    assert mixed._basix_mixed_element is not None
+    points = np.array([[0.1, 0.2], [0.3, 0.3]])
+    table = mixed.tabulate(1, points)
+    assert table.shape == (3, 2, mixed.value_size * mixed.dim)
+
+    # Each sub-element contributes only to its own DOFs and components
+    table = table.reshape((3, 2, mixed.value_size, mixed.dim))
+    expected = np.zeros_like(table)
+    dof_start = 0
+    value_start = 0
+    for e in sub_elements:
+        expected[:, :, value_start: value_start + e.value_size, dof_start: dof_start + e.dim] = e.tabulate(
+            1, points).reshape((3, 2, e.value_size, e.dim))
+        dof_start += e.dim
+        value_start += e.value_size
+    assert np.allclose(table, expected)
+
+
+def test_ufl_blocked_tabulate():
+    e = basix.ufl.element("Lagrange", "triangle", 2, shape=(2, ))
+    points = np.array([[0.1, 0.2], [0.3, 0.3]])
+    table = e.tabulate(1, points)
+    assert table.shape == (3, 2, 2, e.dim)
+
+    sub_table = basix.ufl.element("Lagrange", "triangle", 2).tabulate(1, points)
+    for b in range(2):
+        assert np.allclose(table[:, :, b, b::2], sub_table)
+        assert np.allclose(table[:, :, b, 1 - b::2], 0)
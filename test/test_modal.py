@@ -0,0 +1,88 @@
+# Copyright (c) 2024 Basix contributors
+# FEniCS Project
+# SPDX-License-Identifier: MIT
+
+import numpy as np
+import pytest
+
+import basix
+
+
+@pytest.mark.parametrize("cell, family, degree, element_args", [
+    (basix.CellType.interval, basix.ElementFamily.P, 4, [basix.LagrangeVariant.gll_warped]),
+    (basix.CellType.triangle, basix.ElementFamily.P, 3, [basix.LagrangeVariant.gll_warped]),
+    (basix.CellType.quadrilateral, basix.ElementFamily.P, 2, [basix.LagrangeVariant.gll_warped]),
+    (basix.CellType.prism, basix.ElementFamily.P, 2, [basix.LagrangeVariant.gll_warped]),
+    (basix.CellType.tetrahedron, basix.ElementFamily.N1E, 2, [basix.LagrangeVariant.legendre]),
+    (basix.CellType.quadrilateral, basix.ElementFamily.serendipity, 3, [basix.LagrangeVariant.legendre]),
+])
+@pytest.mark.parametrize("dtype", [np.float32, np.float64])
+def test_transfer_operators(cell, family, degree, element_args, dtype):
+    e = basix.create_element(family, cell, degree, *element_args, dtype=dtype)
+    b = basix.create_modal_basis(e)
+    assert b.dim == e.dim
+    assert b.degree == e.embedded_superdegree
+    assert len(b.mode_degrees) == b.num_modes
+    tol = 1e-4 if dtype == np.float32 else 1e-10
+
+    assert np.allclose(b.modal_to_nodal @ b.nodal_to_modal, np.eye(e.dim), atol=tol)
+
+    # The modal expansion and the element give the same values
+    tdim = len(basix.topology(cell)) - 1
+    x = (np.random.rand(5, tdim) / tdim).astype(dtype)
+    u = (np.random.rand(3, e.dim) - 0.5).astype(dtype)
+    m = b.to_modal(u)
+    P = basix.tabulate_polynomials(basix.PolynomialType.legendre, cell, e.embedded_superdegree, x)
+    psize = P.shape[0]
+    values = np.einsum("piv,ci->cpv", e.tabulate(0, x)[0], u)
+    modal_values = np.stack([m[:, c * psize:(c + 1) * psize] @ P for c in range(e.value_size)], axis=2)
+    assert np.allclose(values, modal_values, atol=tol)
+
+    assert np.allclose(b.to_nodal(m), u, atol=tol)
+    out = np.zeros_like(u)
+    b.to_nodal(m, out)
+    assert np.allclose(out, u, atol=tol)
+
+    assert np.allclose(b.apply_filter(b.exponential_filter(4, 0.0), u), u, atol=tol)
+    assert np.allclose(b.apply_filter(b.cutoff_filter(b.degree), u), u, atol=tol)
+
+
+@pytest.mark.parametrize("cutoff", [0, 1, 2])
+def test_filters(cutoff):
+    e = basix.create_element(basix.ElementFamily.P, basix.CellType.triangle, 4, basix.LagrangeVariant.gll_warped)
+    b = basix.create_modal_basis(e)
+    u = np.random.rand(4, e.dim) - 0.5
+
+    energy = b.modal_energy(b.apply_filter(b.cutoff_filter(cutoff), u))
+    assert np.allclose(energy[:, cutoff + 1:], 0)
+    assert np.allclose(energy[:, :cutoff + 1], b.modal_energy(u)[:, :cutoff + 1])
+
+    sigma = np.array([1.0, 1.0, 0.5, 0.25, 0.0])
+    filtered = b.to_modal(b.apply_filter(b.filter_matrix(sigma), u))
+    assert np.allclose(filtered, b.to_modal(u) * sigma[b.mode_degrees])
+
+    strength = -np.log(np.finfo(np.float64).eps)
+    energy = b.modal_energy(b.apply_filter(b.exponential_filter(8, strength, cutoff), u))
+    assert np.allclose(energy[:, :cutoff + 1], b.modal_energy(u)[:, :cutoff + 1])
+    assert np.allclose(energy[:, -1], 0)
+
+
+def test_indicators():
+    e = basix.create_element(basix.ElementFamily.P, basix.CellType.interval, 6, basix.LagrangeVariant.gll_warped)
+    b = basix.create_modal_basis(e)
+    x = e.points[:, 0]
+    u = np.array([e.interpolation_matrix @ np.exp(x), e.interpolation_matrix @ np.abs(x - 0.4),
+                  np.zeros(e.dim), np.ones(e.dim)])
+
+    energy = b.modal_energy(u)
+    assert energy.shape == (4, 7)
+    assert np.allclose(energy.sum(axis=1), np.sum(b.to_modal(u) ** 2, axis=1))
+
+    s = b.smoothness_indicator(u)
+    assert s[0] < s[1]
+    assert s[2] == -np.inf
+    assert s[3] < -10
+
+    rate = b.decay_rate(u)
+    assert rate[0] > rate[1] > 0
+    assert np.isnan(rate[2])
@@ -116,3 +116,41 @@ def test_dof_transformations_to_transpose(cell, element, degree, block_size, ele
         # Reshape numba output for comparison
         data2 = data2.reshape(-1)
         assert np.allclose(data1, data2)
+
+
+@pytest.mark.parametrize("cell", [basix.CellType.triangle, basix.CellType.tetrahedron,
+                                  basix.CellType.quadrilateral, basix.CellType.hexahedron,
+                                  basix.CellType.prism])
+@pytest.mark.parametrize("element, degree, element_args", [
+    (basix.ElementFamily.P, 3, [basix.LagrangeVariant.gll_warped]),
+    (basix.ElementFamily.N1E, 3, [])
+])
+@pytest.mark.parametrize("block_size", [1, 3])
+def test_batched_dof_transformations(cell, element, degree, element_args, block_size):
+    try:
+        import numba  # noqa: F401
+    except ImportError:
+        pytest.skip("Numba must be installed to run this test.")
+
+    from basix import numba_helpers
+
+    if cell == basix.CellType.prism and element == basix.ElementFamily.N1E:
+        pytest.skip("N1curl is not implemented on prisms.")
+
+    e = basix.create_element(element, cell, degree, *element_args)
+    ncells = 10
+    cell_info = np.random.randint(0, 2 ** 30, ncells).astype(np.uint32)
+
+    data = np.random.rand(ncells, e.dim, block_size)
+    result = data.copy()
+    numba_helpers.create_batched_pre_apply_dof_transformation(e)(result, cell_info)
+    for c in range(ncells):
+        e.pre_apply_dof_transformation(data[c].reshape(-1), block_size, int(cell_info[c]))
+    assert np.allclose(result, data)
+
+    data = np.random.rand(ncells, block_size, e.dim)
+    result = data.copy()
+    numba_helpers.create_batched_post_apply_transpose_dof_transformation(e)(result, cell_info)
+    for c in range(ncells):
+        e.post_apply_transpose_dof_transformation(data[c].reshape(-1), block_size, int(cell_info[c]))
+    assert np.allclose(result, data)
@@ -0,0 +1,111 @@
+# Copyright (c) 2024 Basix contributors
+# FEniCS Project
+# SPDX-License-Identifier: MIT
+
+import numpy as np
+import pytest
+
+import basix
+
+Op = basix.DifferentialOperator
+
+
+def reference_operator(tab, op, tdim, value_shape):
+    """Apply an operator to the first derivatives returned by tabulate."""
+    # du[p, i, c, d] is the derivative of component c in direction d
+    du = tab[1:tdim + 1].transpose(1, 2, 3, 0)
+    if op == Op.divergence and len(value_shape) == 1:
+        return np.trace(du, axis1=2, axis2=3)[:, :, None]
+    if op == Op.divergence:
+        du = du.reshape(du.shape[0], du.shape[1], tdim, tdim, tdim)
+        return np.trace(du, axis1=3, axis2=4)
+    if op == Op.curl and tdim == 2:
+        return (du[:, :, 1, 0] - du[:, :, 0, 1])[:, :, None]
+    if op == Op.curl:
+        return np.stack([du[:, :, 2, 1] - du[:, :, 1, 2], du[:, :, 0, 2] - du[:, :, 2, 0],
+                         du[:, :, 1, 0] - du[:, :, 0, 1]], axis=2)
+    if op == Op.symmetric_gradient:
+        return (0.5 * (du + du.transpose(0, 1, 3, 2))).reshape(du.shape[0], du.shape[1], -1)
+    u = tab[0].reshape(tab.shape[1], tab.shape[2], tdim, tdim)
+    return np.trace(u, axis1=2, axis2=3)[:, :, None]
+
+
+@pytest.mark.parametrize("cell, family, degree, ops", [
+    (basix.CellType.triangle, basix.ElementFamily.RT, 3, [Op.divergence, Op.curl, Op.symmetric_gradient]),
+    (basix.CellType.quadrilateral, basix.ElementFamily.N1E, 2, [Op.divergence, Op.curl]),
+    (basix.CellType.tetrahedron, basix.ElementFamily.N1E, 3, [Op.divergence, Op.curl, Op.symmetric_gradient]),
+    (basix.CellType.hexahedron, basix.ElementFamily.RT, 2, [Op.divergence, Op.curl]),
+    (basix.CellType.tetrahedron, basix.ElementFamily.Regge, 2, [Op.divergence, Op.trace]),
+    (basix.CellType.triangle, basix.ElementFamily.HHJ, 2, [Op.divergence, Op.trace]),
+])
+@pytest.mark.parametrize("dtype", [np.float32, np.float64])
+def test_tabulate_operator(cell, family, degree, ops, dtype):
+    e = basix.create_element(family, cell, degree, basix.LagrangeVariant.legendre
+                             if family in [basix.ElementFamily.RT, basix.ElementFamily.N1E]
+                             else basix.LagrangeVariant.unset, dtype=dtype)
+    tdim = len(basix.topology(cell)) - 1
+    x = (np.random.rand(6, tdim) / tdim).astype(dtype)
+    tab = e.tabulate(1, x)
+    for op in ops:
+        values = e.tabulate_operator(op, x)
+        assert values.shape[:2] == (x.shape[0], e.dim)
+        tol = 1e-4 if dtype == np.float32 else 1e-10
+        assert np.allclose(values, reference_operator(tab, op, tdim, e.value_shape), atol=tol)
+
+        out = np.zeros_like(values)
+        e.tabulate_operator(op, x, out)
+        assert np.allclose(out, values)
+
+
+def test_tabulate_operator_invalid():
+    e = basix.create_element(basix.ElementFamily.P, basix.CellType.triangle, 2)
+    with pytest.raises(RuntimeError):
+        e.tabulate_operator(Op.divergence, np.random.rand(3, 2) / 2)
+
+    e = basix.create_element(basix.ElementFamily.RT, basix.CellType.triangle, 1)
+    with pytest.raises(RuntimeError):
+        e.tabulate_operator(Op.trace, np.random.rand(3, 2) / 2)
+
+
+@pytest.mark.parametrize("cell, family, op", [
+    (basix.CellType.triangle, basix.ElementFamily.RT, Op.divergence),
+    (basix.CellType.tetrahedron, basix.ElementFamily.RT, Op.divergence),
+    (basix.CellType.triangle, basix.ElementFamily.N1E, Op.curl),
+    (basix.CellType.tetrahedron, basix.ElementFamily.N1E, Op.curl),
+])
+def test_push_forward_operator(cell, family, op):
+    e = basix.create_element(family, cell, 2, basix.LagrangeVariant.legendre)
+    tdim = len(basix.topology(cell)) - 1
+    x = np.random.rand(5, tdim) / tdim
+    J = np.random.rand(tdim, tdim) + 2 * np.eye(tdim)
+    detJ = np.linalg.det(J)
+    K = np.linalg.inv(J)
+
+    # Push forward the derivatives, then apply the operator in physical
+    # coordinates
+    tab = e.tabulate(1, x)
+    npoints, ndofs = tab.shape[1], tab.shape[2]
+    dU = tab[1:].transpose(1, 2, 3, 0)
+    if e.map_type == basix.MapType.contravariantPiola:
+        du = np.einsum("ij,pnjk,kl->pnil", J, dU, K) / detJ
+    else:
+        du = np.einsum("ji,pnjk,kl->pnil", K, dU, K)
+    expected = reference_operator(np.concatenate([np.zeros((1, npoints, ndofs, tdim)), du.transpose(3, 0, 1, 2)]),
+                                  op, tdim, e.value_shape)
+
+    U = e.tabulate_operator(op, x)
+    size = e.physical_operator_size(op, tdim)
+    assert size == expected.shape[2]
+    u = e.push_forward_operator(op, U, np.array([J] * npoints), np.full(npoints, detJ),
+                                np.array([K] * npoints))
+    assert np.allclose(u, expected)
+
+    out = np.zeros_like(u)
+    e.push_forward_operator(op, U, np.array([J] * npoints), np.full(npoints, detJ), np.array([K] * npoints), out)
+    assert np.allclose(out, u)
+
+
+def test_push_forward_operator_unsupported():
+    e = basix.create_element(basix.ElementFamily.N1E, basix.CellType.triangle, 1)
+    with pytest.raises(RuntimeError):
+        e.physical_operator_size(Op.divergence, 2)
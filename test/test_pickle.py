@@ -0,0 +1,86 @@
+import copyreg
+import pickle
+
+import numpy as np
+import pytest
+
+import basix
+import basix.ufl
+
+
+@pytest.mark.parametrize("dtype", [np.float32, np.float64])
+@pytest.mark.parametrize("family, cell, degree, args", [
+    (basix.ElementFamily.P, basix.CellType.quadrilateral, 3, [basix.LagrangeVariant.gll_warped]),
+    (basix.ElementFamily.P, basix.CellType.triangle, 2, [basix.LagrangeVariant.legendre, basix.DPCVariant.unset, True]),
+    (basix.ElementFamily.N1E, basix.CellType.tetrahedron, 2, [basix.LagrangeVariant.gll_warped]),
+    (basix.ElementFamily.RT, basix.CellType.hexahedron, 2, [basix.LagrangeVariant.gll_warped]),
+])
+def test_pickle_element(family, cell, degree, args, dtype):
+    e = basix.create_element(family, cell, degree, *args, dtype=dtype)
+    e2 = pickle.loads(pickle.dumps(e))
+    assert e2 == e
+    assert e2.dtype == e.dtype
+    assert e2.has_tensor_product_factorisation == e.has_tensor_product_factorisation
+
+    points = basix.create_lattice(cell, 3, basix.LatticeType.equispaced, True).astype(dtype)
+    assert np.array_equal(e2.tabulate(1, points), e.tabulate(1, points))
+
+    data = np.arange(e.dim * 2, dtype=dtype)
+    data2 = data.copy()
+    e.pre_apply_dof_transformation(data, 2, 12345)
+    e2.pre_apply_dof_transformation(data2, 2, 12345)
+    assert np.array_equal(data, data2)
+
+
+def test_pickle_custom_element():
+    wcoeffs = np.eye(3)
+    z = np.zeros((0, 2))
+    x = [[np.array([[0.0, 0.0]]), np.array([[1.0, 0.0]]), np.array([[0.0, 1.0]])], [z, z, z], [z], []]
+    z = np.zeros((0, 1, 0, 1))
+    M = [[np.array([[[[1.0]]]]), np.array([[[[1.0]]]]), np.array([[[[1.0]]]])], [z, z, z], [z], []]
+    e = basix.create_custom_element(basix.CellType.triangle, [], wcoeffs, x, M, 0, basix.MapType.identity,
+                                    basix.SobolevSpace.H1, False, 1, 1, basix.PolysetType.standard)
+    e2 = pickle.loads(pickle.dumps(e))
+    assert e2 == e
+    assert np.array_equal(e2.coefficient_matrix, e.coefficient_matrix)
+
+
+def test_pickle_ufl_element():
+    pytest.importorskip("ufl")
+    elements = [basix.ufl.element("Lagrange", "triangle", 2, shape=(2, )), basix.ufl.element("N1curl", "triangle", 1)]
+    mixed = basix.ufl.mixed_element(elements)
+    points = np.array([[0.1, 0.2], [0.3, 0.3]])
+    expected = mixed.tabulate(1, points)
+
+    mixed2 = pickle.loads(pickle.dumps(mixed))
+    assert mixed2 == mixed
+    assert np.allclose(mixed2.tabulate(1, points), expected)
+
+
+class _State:
+    """An object that is unpickled as a new instance of cls with the given state."""
+
+    def __init__(self, cls, state):
+        self._cls = cls
+        self._state = state
+
+    def __reduce__(self):
+        return copyreg.__newobj__, (self._cls, ), self._state
+
+
+def test_deserialize_invalid():
+    e = basix.create_element(basix.ElementFamily.P, basix.CellType.triangle, 1)
+    state = e._e.__getstate__()
+    e2 = pickle.loads(pickle.dumps(_State(type(e._e), state)))
+    assert e2.fingerprint == e._e.fingerprint
+
+    # The state of a float64 element loaded as a float32 element
+    e32 = basix.create_element(basix.ElementFamily.P, basix.CellType.triangle, 1, dtype=np.float32)
+    with pytest.raises(RuntimeError):
+        pickle.loads(pickle.dumps(_State(type(e32._e), state)))
+
+    # Truncated state, and state with trailing bytes
+    with pytest.raises(RuntimeError):
+        pickle.loads(pickle.dumps(_State(type(e._e), state[:-1])))
+    with pytest.raises(RuntimeError):
+        pickle.loads(pickle.dumps(_State(type(e._e), state + b"\0")))
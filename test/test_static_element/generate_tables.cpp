@@ -0,0 +1,42 @@
+// Copyright (c) 2024 Basix contributors
+// FEniCS Project
+// SPDX-License-Identifier:    MIT
+
+// Write the tables of the StaticElements that are created in a
+// constexpr context by the test to the header given as the argument.
+
+#include <basix/codegen.h>
+#include <basix/finite-element.h>
+#include <fstream>
+#include <iostream>
+
+using namespace basix;
+
+int main(int argc, char* argv[])
+{
+  if (argc != 2)
+  {
+    std::cerr << "Usage: " << argv[0] << " OUTPUT\n";
+    return 1;
+  }
+
+  using enum cell::type;
+  using enum element::family;
+  using L = element::lagrange_variant;
+  const auto create = [](element::family f, cell::type c, int degree,
+                         element::lagrange_variant v)
+  {
+    return create_element<double>(f, c, degree, v,
+                                  element::dpc_variant::unset, false);
+  };
+
+  std::ofstream out(argv[1]);
+  out << "#pragma once\n\n#include <basix/static-element.h>\n\n";
+  out << codegen::static_element_tables(
+      create(N1E, tetrahedron, 2, L::legendre), "n1e_tetrahedron_2");
+  out << codegen::static_element_tables(
+      create(P, hexahedron, 3, L::gll_warped), "p_hexahedron_3");
+  out << codegen::static_element_tables(create(RT, triangle, 2, L::legendre),
+                                        "rt_triangle_2");
+  return out ? 0 : 1;
+}
@@ -0,0 +1,163 @@
+// Copyright (c) 2024 Basix contributors
+// FEniCS Project
+// SPDX-License-Identifier:    MIT
+
+// Compare the tabulated basis functions and the DOF transformations of
+// StaticElement with those of the runtime FiniteElement it is created
+// from. Some of the StaticElements are built in a constexpr context
+// from the tables in static_tables.h, which are written by
+// generate_tables when the test is built.
+
+#include <basix/finite-element.h>
+#include <basix/static-element.h>
+#include "static_tables.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+using namespace basix;
+
+namespace
+{
+int num_failures = 0;
+
+//-----------------------------------------------------------------------------
+template <typename T>
+void check(const std::string& name, std::span<const T> a,
+           std::span<const T> b)
+{
+  T err = 0;
+  for (std::size_t i = 0; i < a.size(); ++i)
+    err = std::max(err, std::abs(a[i] - b[i]));
+  if (a.size() != b.size() or err > 1e-10)
+  {
+    std::cerr << "FAILED: " << name << " (error " << err << ")\n";
+    ++num_failures;
+  }
+}
+//-----------------------------------------------------------------------------
+/// Compare a StaticElement with the runtime element it is created from
+template <cell::type C, element::family F, int D,
+          element::lagrange_variant V>
+void compare(const std::string& name,
+             const StaticElement<C, F, D, V, double>& static_e,
+             std::mt19937& gen)
+{
+  using T = double;
+  using element_t = StaticElement<C, F, D, V, T>;
+  const FiniteElement<T> e
+      = create_element<T>(F, C, D, V, element::dpc_variant::unset, false);
+
+  // Tabulate at points in the interior of the cell
+  constexpr std::size_t npoints = 5;
+  std::uniform_real_distribution<T> dist(0.0, 1.0 / element_t::tdim);
+  std::array<T, npoints * element_t::tdim> x;
+  std::ranges::generate(x, [&]() { return dist(gen); });
+
+  std::array<T, element_t::template nderivs<1> * npoints * element_t::dim
+                    * element_t::value_size>
+      basis;
+  static_e.template tabulate<1, npoints>(
+      typename element_t::template points_type<npoints>(x.data()),
+      typename element_t::template basis_type<1, npoints>(basis.data()));
+  const auto [tab, shape] = e.tabulate(1, x, {npoints, element_t::tdim});
+  check<T>(name + " tabulate", basis, tab);
+
+  // Apply the DOF transformations for random cells
+  std::uniform_int_distribution<std::uint32_t> cell_info_dist(0, 1 << 30);
+  for (int i = 0; i < 10; ++i)
+  {
+    const std::uint32_t cell_info = cell_info_dist(gen);
+    std::array<T, element_t::dim> data;
+    std::ranges::generate(data, [&]() { return dist(gen); });
+    std::vector<T> expected(data.begin(), data.end());
+
+    std::array<T, element_t::dim> d = data;
+    std::vector<T> r = expected;
+    static_e.pre_apply_dof_transformation(std::span(d), cell_info);
+    e.pre_apply_dof_transformation(std::span(r), 1, cell_info);
+    check<T>(name + " pre_apply_dof_transformation", d, r);
+
+    d = data;
+    r = expected;
+    static_e.pre_apply_transpose_dof_transformation(std::span(d), cell_info);
+    e.pre_apply_transpose_dof_transformation(std::span(r), 1, cell_info);
+    check<T>(name + " pre_apply_transpose_dof_transformation", d, r);
+
+    d = data;
+    r = expected;
+    static_e.pre_apply_inverse_dof_transformation(std::span(d), cell_info);
+    e.pre_apply_inverse_dof_transformation(std::span(r), 1, cell_info);
+    check<T>(name + " pre_apply_inverse_dof_transformation", d, r);
+
+    d = data;
+    r = expected;
+    static_e.pre_apply_inverse_transpose_dof_transformation(std::span(d),
+                                                            cell_info);
+    e.pre_apply_inverse_transpose_dof_transformation(std::span(r), 1,
+                                                     cell_info);
+    check<T>(name + " pre_apply_inverse_transpose_dof_transformation", d, r);
+  }
+}
+//-----------------------------------------------------------------------------
+/// Compare a StaticElement that copies the data of a runtime element
+/// with the runtime element
+template <cell::type C, element::family F, int D,
+          element::lagrange_variant V>
+void test_element(const std::string& name, std::mt19937& gen)
+{
+  const FiniteElement<double> e = create_element<double>(
+      F, C, D, V, element::dpc_variant::unset, false);
+  compare(name, StaticElement<C, F, D, V, double>(e), gen);
+}
+//-----------------------------------------------------------------------------
+} // namespace
+
+int main()
+{
+  using enum cell::type;
+  using enum element::family;
+  using L = element::lagrange_variant;
+
+  std::mt19937 gen(42);
+  test_element<interval, P, 3, L::gll_warped>("P interval 3", gen);
+  test_element<triangle, P, 4, L::gll_warped>("P triangle 4", gen);
+  test_element<tetrahedron, P, 3, L::equispaced>("P tetrahedron 3", gen);
+  test_element<quadrilateral, P, 3, L::gll_warped>("P quadrilateral 3", gen);
+  test_element<hexahedron, P, 2, L::equispaced>("P hexahedron 2", gen);
+  test_element<triangle, RT, 2, L::legendre>("RT triangle 2", gen);
+  test_element<tetrahedron, RT, 2, L::legendre>("RT tetrahedron 2", gen);
+  test_element<quadrilateral, RT, 2, L::legendre>("RT quadrilateral 2", gen);
+  test_element<hexahedron, RT, 2, L::legendre>("RT hexahedron 2", gen);
+  test_element<triangle, N1E, 3, L::legendre>("N1E triangle 3", gen);
+  test_element<tetrahedron, N1E, 2, L::legendre>("N1E tetrahedron 2", gen);
+  test_element<quadrilateral, N1E, 2, L::legendre>("N1E quadrilateral 2",
+                                                    gen);
+  test_element<hexahedron, N1E, 2, L::legendre>("N1E hexahedron 2", gen);
+
+  // Elements built in a constexpr context from the tables written by
+  // codegen::static_element_tables
+  constexpr StaticElement<tetrahedron, N1E, 2, L::legendre> n1e_tetrahedron(
+      n1e_tetrahedron_2);
+  constexpr StaticElement<hexahedron, P, 3, L::gll_warped> p_hexahedron(
+      p_hexahedron_3);
+  constexpr StaticElement<triangle, RT, 2, L::legendre> rt_triangle(
+      rt_triangle_2);
+  compare("N1E tetrahedron 2 (generated)", n1e_tetrahedron, gen);
+  compare("P hexahedron 3 (generated)", p_hexahedron, gen);
+  compare("RT triangle 2 (generated)", rt_triangle, gen);
+
+  if (num_failures > 0)
+  {
+    std::cerr << num_failures << " checks failed\n";
+    return 1;
+  }
+  std::cout << "StaticElement matches FiniteElement\n";
+  return 0;
+}
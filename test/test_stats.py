@@ -0,0 +1,69 @@
+import pickle
+import threading
+
+import numpy as np
+import pytest
+
+import basix
+
+
+@pytest.fixture
+def stats():
+    basix.stats.reset()
+    basix.stats.enable()
+    yield basix.stats
+    basix.stats.disable()
+    basix.stats.reset()
+
+
+@pytest.mark.parametrize("dtype", [np.float32, np.float64])
+def test_tabulate_counters(stats, dtype):
+    e = basix.create_element(basix.ElementFamily.P, basix.CellType.triangle, 2, basix.LagrangeVariant.gll_warped,
+                             dtype=dtype)
+    points = basix.create_lattice(basix.CellType.triangle, 4, basix.LatticeType.equispaced, True).astype(dtype)
+    tab0 = e.tabulate(0, points)
+    tab1 = e.tabulate(1, points)
+
+    c = stats.counters(e)
+    assert c["tabulate_calls"] == 2
+    assert c["tabulate_points"] == 2 * points.shape[0]
+    assert c["tabulate_bytes"] == tab0.nbytes + tab1.nbytes
+    assert stats.all_counters()[e.fingerprint] == c
+
+
+def test_disabled(stats):
+    e = basix.create_element(basix.ElementFamily.P, basix.CellType.interval, 1)
+    points = np.array([[0.5]])
+    stats.disable()
+    assert not stats.enabled()
+    e.tabulate(0, points)
+    assert stats.counters(e)["tabulate_calls"] == 0
+
+    stats.enable()
+    e.tabulate(0, points)
+    stats.reset()
+    assert stats.counters(e)["tabulate_calls"] == 0
+
+
+def test_memory_footprint():
+    e = basix.create_element(basix.ElementFamily.N1E, basix.CellType.tetrahedron, 2, basix.LagrangeVariant.legendre)
+    footprint = e.memory_footprint()
+    for name in ["coeffs", "matM", "dual_matrix", "x", "M", "etrans", "eperm", "tensor_factors"]:
+        assert name in footprint
+    assert footprint["coeffs"] >= e.coefficient_matrix.nbytes
+    assert footprint["matM"] >= e.interpolation_matrix.nbytes
+    assert footprint["dual_matrix"] >= e.dual_matrix.nbytes
+    assert pickle.loads(pickle.dumps(e)).memory_footprint()["coeffs"] >= e.coefficient_matrix.nbytes
+
+
+def test_exited_threads(stats):
+    # The counters of a thread are kept when the thread exits
+    e = basix.create_element(basix.ElementFamily.P, basix.CellType.triangle, 1)
+    points = np.array([[0.25, 0.25]])
+    threads = [threading.Thread(target=e.tabulate, args=(0, points)) for _ in range(8)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    assert stats.counters(e)["tabulate_calls"] == 8
+    assert stats.all_counters()[e.fingerprint]["tabulate_points"] == 8
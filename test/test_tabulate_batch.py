@@ -0,0 +1,53 @@
+# Copyright (c) 2024 Basix contributors
+# FEniCS Project
+# SPDX-License-Identifier: MIT
+
+import numpy as np
+import pytest
+
+import basix
+
+
+@pytest.mark.parametrize("cell, element, degree, element_args", [
+    (basix.CellType.triangle, basix.ElementFamily.P, 3, [basix.LagrangeVariant.gll_warped]),
+    (basix.CellType.quadrilateral, basix.ElementFamily.RT, 2, []),
+    (basix.CellType.tetrahedron, basix.ElementFamily.N1E, 2, []),
+])
+@pytest.mark.parametrize("num_threads", [1, 4])
+def test_tabulate_batch(cell, element, degree, element_args, num_threads):
+    e = basix.create_element(element, cell, degree, *element_args)
+    tdim = len(basix.topology(cell)) - 1
+    npoints = [3, 1, 4, 0, 5, 2, 7]
+    offsets = np.concatenate([[0], np.cumsum(npoints)])
+    x = np.random.rand(offsets[-1], tdim) / tdim
+
+    tables = e.tabulate_batch(2, x, offsets, num_threads)
+    for c, n in enumerate(npoints):
+        if n == 0:
+            continue
+        t = e.tabulate(2, x[offsets[c]:offsets[c + 1]])
+        s = t.shape[0] * t.shape[2] * t.shape[3]
+        assert np.allclose(t.flatten(), tables[offsets[c] * s:offsets[c + 1] * s])
+
+
+def test_invalid_offsets():
+    e = basix.create_element(basix.ElementFamily.P, basix.CellType.triangle, 1)
+    x = np.random.rand(4, 2) / 2
+    with pytest.raises(RuntimeError):
+        e.tabulate_batch(0, x, [0, 2, 3])
+
+
+def test_tabulate_out():
+    e = basix.create_element(basix.ElementFamily.N1E, basix.CellType.triangle, 2)
+    x = np.random.rand(6, 2) / 2
+    out = np.empty((3, 6, e.dim, 2))
+    assert e.tabulate(1, x, out=out) is out
+    assert np.allclose(out, e.tabulate(1, x))
+
+    offsets = [0, 2, 6]
+    out = np.empty(3 * 6 * e.dim * 2)
+    assert e.tabulate_batch(1, x, offsets, out=out) is out
+    assert np.allclose(out, e.tabulate_batch(1, x, offsets))
+
+    with pytest.raises(RuntimeError):
+        e.tabulate(1, x, out=np.empty((3, 6, e.dim, 1)))
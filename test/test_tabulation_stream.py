@@ -0,0 +1,60 @@
+# Copyright (c) 2024 Basix contributors
+# FEniCS Project
+# SPDX-License-Identifier: MIT
+
+import numpy as np
+import pytest
+
+import basix
+
+
+@pytest.mark.parametrize("cell, family, degree", [
+    (basix.CellType.interval, basix.ElementFamily.P, 3),
+    (basix.CellType.triangle, basix.ElementFamily.N1E, 2),
+    (basix.CellType.tetrahedron, basix.ElementFamily.P, 3),
+    (basix.CellType.hexahedron, basix.ElementFamily.RT, 2),
+])
+@pytest.mark.parametrize("pipelined", [True, False])
+@pytest.mark.parametrize("dtype", [np.float32, np.float64])
+def test_stream(cell, family, degree, pipelined, dtype):
+    e = basix.create_element(family, cell, degree, basix.LagrangeVariant.gll_warped, dtype=dtype)
+    tdim = len(basix.topology(cell)) - 1
+    x = (np.random.rand(1003, tdim) / tdim).astype(dtype)
+    chunks = (x[i:i + 100] for i in range(0, x.shape[0], 100))
+
+    tables = [t.copy() for t in e.tabulate_stream(1, chunks, 100, pipelined)]
+    assert len(tables) == 11
+    assert np.allclose(np.concatenate(tables, axis=1), e.tabulate(1, x))
+
+
+@pytest.mark.parametrize("empty", [np.zeros((0, 2)), np.array([])])
+def test_empty_chunk_ends_stream(empty):
+    e = basix.create_element(basix.ElementFamily.P, basix.CellType.triangle, 2)
+    chunks = [np.random.rand(5, 2), empty, np.random.rand(5, 2)]
+    assert len(list(e.tabulate_stream(0, chunks, 5))) == 1
+
+
+def test_invalid():
+    e = basix.create_element(basix.ElementFamily.P, basix.CellType.triangle, 2)
+    with pytest.raises(RuntimeError):
+        list(e.tabulate_stream(0, [np.random.rand(5, 2)], 0))
+    with pytest.raises(RuntimeError):
+        list(e.tabulate_stream(0, [np.random.rand(6, 2)], 5))
+    with pytest.raises(RuntimeError):
+        list(e.tabulate_stream(0, [np.random.rand(5, 3)], 5))
+
+
+@pytest.mark.parametrize("pipelined", [True, False])
+def test_producer_error(pipelined):
+    e = basix.create_element(basix.ElementFamily.P, basix.CellType.triangle, 2)
+
+    def chunks():
+        yield np.random.rand(5, 2) / 2
+        yield np.random.rand(5, 2) / 2
+        raise ValueError("No more points")
+
+    tables = []
+    with pytest.raises(ValueError):
+        for t in e.tabulate_stream(0, chunks(), 5, pipelined):
+            tables.append(t.copy())
+    assert len(tables) == 2
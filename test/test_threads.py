@@ -0,0 +1,47 @@
+# Copyright (c) 2024 Basix contributors
+# FEniCS Project
+# SPDX-License-Identifier: MIT
+
+from concurrent.futures import ThreadPoolExecutor
+
+import numpy as np
+
+import basix
+
+
+def test_concurrent_tabulate():
+    e = basix.create_element(basix.ElementFamily.N1E, basix.CellType.tetrahedron, 3)
+    points = [np.random.rand(20, 3) / 3 for _ in range(16)]
+
+    with ThreadPoolExecutor(max_workers=4) as pool:
+        tables = list(pool.map(lambda x: e.tabulate(2, x), points))
+    for x, t in zip(points, tables):
+        assert np.allclose(t, e.tabulate(2, x))
+
+
+def test_concurrent_dof_transformations():
+    e = basix.create_element(basix.ElementFamily.P, basix.CellType.tetrahedron, 5, basix.LagrangeVariant.gll_warped)
+    data = [np.random.rand(e.dim * 3) for _ in range(64)]
+    cell_info = list(range(1, 65))
+
+    def apply(args):
+        d, info = args
+        out = d.copy()
+        e.pre_apply_dof_transformation(out, 3, info)
+        return out
+
+    with ThreadPoolExecutor(max_workers=4) as pool:
+        results = list(pool.map(apply, zip(data, cell_info)))
+    for d, info, result in zip(data, cell_info, results):
+        assert np.allclose(result, apply((d, info)))
+
+
+def test_concurrent_create_element():
+    degrees = list(range(1, 6)) * 2
+    with ThreadPoolExecutor(max_workers=4) as pool:
+        elements = list(pool.map(
+            lambda k: basix.create_element(basix.ElementFamily.RT, basix.CellType.triangle, k), degrees))
+    for k, e in zip(degrees, elements):
+        assert e == basix.create_element(basix.ElementFamily.RT, basix.CellType.triangle, k)
+        assert np.allclose(e.coefficient_matrix,
+                           basix.create_element(basix.ElementFamily.RT, basix.CellType.triangle, k).coefficient_matrix)